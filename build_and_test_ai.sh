@@ -43,7 +43,12 @@ if [ "$BUILD_TYPE" = "test" ]; then
         src/burner/metal/ai/ai_rl_algorithms.cpp \
         src/burner/metal/ai/ai_rl_integration.cpp \
         src/burner/metal/ai/ai_torch_policy.cpp \
-        src/burner/metal/ai/pytorch_to_coreml.cpp
+        src/burner/metal/ai/pytorch_to_coreml.cpp \
+        src/ai/ai_prioritized_replay.cpp \
+        src/ai/ai_input_frame.cpp \
+        src/ai/ai_output_action.cpp \
+        src/ai/ai_dataset_logger.cpp \
+        src/ai/ai_dataset_columnar.cpp -lz
     
     if [ $? -ne 0 ]; then
         echo "Error: Failed to build AI test application"
@@ -51,7 +56,18 @@ if [ "$BUILD_TYPE" = "test" ]; then
     fi
     
     echo "Running AI test application..."
-    ./build/test/ai_test
+    ./build/test/ai_test || exit 1
+
+    # The batch runner test brings its own stand-in for the core
+    clang++ $CXXFLAGS -o build/test/ai_batch_test tests/ai_batch_test.cpp \
+        src/ai/ai_batch_runner.cpp
+
+    if [ $? -ne 0 ]; then
+        echo "Error: Failed to build batch runner test"
+        exit 1
+    fi
+
+    ./build/test/ai_batch_test || exit 1
 fi
 
 echo "All done!"
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include "../burner/metal/ai/ai_controller.h"
+
 namespace AI {
 
 /**
@@ -47,4 +50,46 @@ enum AIAction {
     ACTION_COUNT = 22
 };
 
-} // namespace AI 
\ No newline at end of file
+/**
+ * Bit layout of a packed InputAction. AIDatasetLogger, the FBDS "buttons"
+ * column and AIBatchSample::buttons all store inputs this way.
+ */
+struct AIInputBit {
+    uint32_t bit;
+    bool fbneo::ai::InputAction::* member;
+};
+
+static const AIInputBit AIInputBits[] = {
+    { 0x0001, &fbneo::ai::InputAction::up },
+    { 0x0002, &fbneo::ai::InputAction::down },
+    { 0x0004, &fbneo::ai::InputAction::left },
+    { 0x0008, &fbneo::ai::InputAction::right },
+    { 0x0010, &fbneo::ai::InputAction::button1 },
+    { 0x0020, &fbneo::ai::InputAction::button2 },
+    { 0x0040, &fbneo::ai::InputAction::button3 },
+    { 0x0080, &fbneo::ai::InputAction::button4 },
+    { 0x0100, &fbneo::ai::InputAction::button5 },
+    { 0x0200, &fbneo::ai::InputAction::button6 },
+    { 0x0400, &fbneo::ai::InputAction::start },
+    { 0x0800, &fbneo::ai::InputAction::coin }
+};
+
+inline uint32_t PackInputAction(const fbneo::ai::InputAction& action) {
+    uint32_t buttons = 0;
+    for (const AIInputBit& input : AIInputBits) {
+        if (action.*(input.member)) {
+            buttons |= input.bit;
+        }
+    }
+    return buttons;
+}
+
+inline fbneo::ai::InputAction UnpackInputAction(uint32_t buttons) {
+    fbneo::ai::InputAction action;
+    for (const AIInputBit& input : AIInputBits) {
+        action.*(input.member) = (buttons & input.bit) != 0;
+    }
+    return action;
+}
+
+} // namespace AI
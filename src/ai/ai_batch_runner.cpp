@@ -0,0 +1,399 @@
+#include "ai_batch_runner.h"
+#include "burner.h"
+#include "ai_action.h"
+
+#include <iostream>
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <new>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using fbneo::ai::GameObservation;
+using fbneo::ai::InputAction;
+
+// Core entry points the instances drive directly (see childMain)
+extern char szAppRomPaths[DIRS_MAX][MAX_PATH];
+extern "C" INT32 BurnDrvGetIndexByName(const char* szName);
+INT32 BurnDrvSelect(INT32 nDrvNum);
+INT32 BurnDrvInit();
+INT32 BurnDrvExit();
+INT32 BurnDrvFrame();
+void MetalInput_SetButtonState(int player, uint32_t state);
+
+// Episode job handed to an instance; a negative episode tells the instance to exit
+struct AIBatchRunner::Job {
+    int32_t episode;
+    uint32_t frames;
+};
+
+// Single-producer/single-consumer ring living in the shared-memory region.
+// head is only written by the producer, tail only by the consumer, both are
+// free-running counters so (head - tail) is the fill level.
+struct AIBatchRunner::Ring {
+    alignas(64) std::atomic<uint32_t> head;
+    alignas(64) std::atomic<uint32_t> tail;
+    alignas(64) std::atomic<uint32_t> completed;    // episodes finished (sample rings only)
+    uint32_t mask;
+    uint32_t recordSize;
+
+    static size_t bytesFor(uint32_t slots, uint32_t recordSize) {
+        size_t size = sizeof(Ring) + (size_t)slots * recordSize;
+        return (size + 63) & ~(size_t)63;
+    }
+
+    uint8_t* data() {
+        return reinterpret_cast<uint8_t*>(this + 1);
+    }
+
+    uint32_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    bool push(const void* record) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) > mask) {
+            return false;
+        }
+        memcpy(data() + (size_t)(h & mask) * recordSize, record, recordSize);
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(void* record) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == t) {
+            return false;
+        }
+        memcpy(record, data() + (size_t)(t & mask) * recordSize, recordSize);
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "shared-memory rings need address-free atomics");
+
+static uint32_t roundUpPow2(int value) {
+    uint32_t n = 1;
+    while (n < (uint32_t)value) {
+        n <<= 1;
+    }
+    return n;
+}
+
+AIBatchRunner::AIBatchRunner()
+    : m_shared(nullptr)
+    , m_sharedSize(0)
+    , m_stop(false)
+    , m_sampleCount(0)
+    , m_completedEpisodes(0)
+{
+}
+
+AIBatchRunner::~AIBatchRunner() {
+    releaseShared();
+}
+
+bool AIBatchRunner::initialize(const AIBatchConfig& config) {
+#ifdef _WIN32
+    std::cerr << "AIBatchRunner: multi-instance mode needs fork(), not available on this platform" << std::endl;
+    return false;
+#else
+    releaseShared();
+
+    if (config.numInstances < 1 || config.numEpisodes < 0 || config.framesPerEpisode < 1) {
+        std::cerr << "AIBatchRunner: invalid configuration" << std::endl;
+        return false;
+    }
+
+    m_config = config;
+    m_config.jobRingSize = roundUpPow2(config.jobRingSize);
+    m_config.sampleRingSize = roundUpPow2(config.sampleRingSize);
+
+    const size_t jobBytes = Ring::bytesFor(m_config.jobRingSize, sizeof(Job));
+    const size_t sampleBytes = Ring::bytesFor(m_config.sampleRingSize, sizeof(AIBatchSample));
+    m_sharedSize = (jobBytes + sampleBytes) * m_config.numInstances;
+
+    // Anonymous shared mapping, inherited by every forked instance
+    m_shared = mmap(nullptr, m_sharedSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (m_shared == MAP_FAILED) {
+        std::cerr << "AIBatchRunner: failed to map " << m_sharedSize << " bytes of shared memory" << std::endl;
+        m_shared = nullptr;
+        m_sharedSize = 0;
+        return false;
+    }
+
+    uint8_t* p = static_cast<uint8_t*>(m_shared);
+    for (int i = 0; i < m_config.numInstances; i++) {
+        Ring* job = new (p) Ring();
+        job->head = 0;
+        job->tail = 0;
+        job->completed = 0;
+        job->mask = m_config.jobRingSize - 1;
+        job->recordSize = sizeof(Job);
+        m_jobRings.push_back(job);
+        p += jobBytes;
+
+        Ring* samples = new (p) Ring();
+        samples->head = 0;
+        samples->tail = 0;
+        samples->completed = 0;
+        samples->mask = m_config.sampleRingSize - 1;
+        samples->recordSize = sizeof(AIBatchSample);
+        m_sampleRings.push_back(samples);
+        p += sampleBytes;
+    }
+
+    m_sampleCount = 0;
+    m_completedEpisodes = 0;
+    m_stop = false;
+
+    return true;
+#endif
+}
+
+void AIBatchRunner::releaseShared() {
+#ifndef _WIN32
+    if (m_shared) {
+        munmap(m_shared, m_sharedSize);
+    }
+#endif
+    m_shared = nullptr;
+    m_sharedSize = 0;
+    m_jobRings.clear();
+    m_sampleRings.clear();
+    m_pids.clear();
+}
+
+void AIBatchRunner::setActionCallback(fbneo::ai::ActionCallback callback) {
+    m_actionCallback = callback;
+}
+
+void AIBatchRunner::setRewardCallback(fbneo::ai::RewardCallback callback) {
+    m_rewardCallback = callback;
+}
+
+void AIBatchRunner::setSampleCallback(SampleCallback callback) {
+    m_sampleCallback = callback;
+}
+
+void AIBatchRunner::stop() {
+    m_stop = true;
+}
+
+uint64_t AIBatchRunner::getSampleCount() const {
+    return m_sampleCount;
+}
+
+int AIBatchRunner::getCompletedEpisodes() const {
+    return m_completedEpisodes;
+}
+
+int AIBatchRunner::drainSamples() {
+    AIBatchSample sample;
+    int drained = 0;
+
+    for (Ring* ring : m_sampleRings) {
+        while (ring->pop(&sample)) {
+            if (m_sampleCallback) {
+                m_sampleCallback(sample);
+            }
+            drained++;
+        }
+    }
+
+    m_sampleCount += drained;
+    return drained;
+}
+
+bool AIBatchRunner::run(const std::string& romPath, const std::string& romName) {
+#ifdef _WIN32
+    return false;
+#else
+    if (!m_shared) {
+        std::cerr << "AIBatchRunner: run() called before initialize()" << std::endl;
+        return false;
+    }
+
+    std::cout.flush();
+    std::cerr.flush();
+
+    // Spawn the instances, each one gets a private copy of the Burn globals
+    for (int i = 0; i < m_config.numInstances; i++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            childMain(i, romPath, romName);
+            _exit(0);
+        }
+        if (pid < 0) {
+            std::cerr << "AIBatchRunner: fork failed for instance " << i << std::endl;
+            m_config.numInstances = i;
+            break;
+        }
+        m_pids.push_back(pid);
+    }
+
+    const int numInstances = (int)m_pids.size();
+    std::vector<bool> exited(numInstances, false);
+    std::vector<bool> terminated(numInstances, false);
+    int running = numInstances;
+    int nextEpisode = 0;
+    bool clean = true;
+
+    while (running > 0) {
+        // Keep at most two episodes queued per instance so work stays balanced
+        for (int i = 0; i < numInstances; i++) {
+            if (exited[i] || terminated[i]) {
+                continue;
+            }
+
+            while (!m_stop && nextEpisode < m_config.numEpisodes && m_jobRings[i]->size() < 2) {
+                Job job = { nextEpisode, (uint32_t)m_config.framesPerEpisode };
+                if (!m_jobRings[i]->push(&job)) {
+                    break;
+                }
+                nextEpisode++;
+            }
+
+            if (m_stop || nextEpisode >= m_config.numEpisodes) {
+                Job job = { -1, 0 };
+                terminated[i] = m_jobRings[i]->push(&job);
+            }
+        }
+
+        int drained = drainSamples();
+
+        for (int i = 0; i < numInstances; i++) {
+            if (exited[i]) {
+                continue;
+            }
+
+            int status = 0;
+            if (waitpid(m_pids[i], &status, WNOHANG) == m_pids[i]) {
+                exited[i] = true;
+                running--;
+
+                if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+                    std::cerr << "AIBatchRunner: instance " << i << " exited abnormally" << std::endl;
+                    clean = false;
+                }
+            }
+        }
+
+        if (drained == 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    }
+
+    // Pick up whatever the instances wrote before exiting
+    drainSamples();
+
+    m_completedEpisodes = 0;
+    for (Ring* ring : m_sampleRings) {
+        m_completedEpisodes += ring->completed.load(std::memory_order_acquire);
+    }
+
+    m_pids.clear();
+
+    return clean;
+#endif
+}
+
+void AIBatchRunner::childMain(int instance, const std::string& romPath, const std::string& romName) {
+#ifndef _WIN32
+    Ring* jobs = m_jobRings[instance];
+    Ring* samples = m_sampleRings[instance];
+    const pid_t trainer = getppid();
+
+    AIBatchSample sample;
+    memset(&sample, 0, sizeof(sample));
+    sample.instance = instance;
+
+    // Load the driver the same way the synchronous runner in headless_runner.cpp does.
+    // HeadlessRunner from headless_mode.h is not used here: it emulates on a worker
+    // thread of its own, which would race the snapshot, state loads and steps below.
+    strncpy(szAppRomPaths[0], romPath.c_str(), MAX_PATH - 1);
+    szAppRomPaths[0][MAX_PATH - 1] = 0;
+    if (BurnDrvSelect(BurnDrvGetIndexByName(romName.c_str())) < 0 || BurnDrvInit()) {
+        std::cerr << "AIBatchRunner: instance " << instance << " failed to load " << romName << std::endl;
+        _exit(1);
+    }
+
+    // Snapshot the state right after boot, every episode starts from it
+    std::vector<UINT8> start;
+    INT32 nStartLen = 0;
+    if (BurnStateDeltaInit(0) == 0) {
+        start.resize(BurnStateDeltaGetMaxLen());
+        if (BurnStateDeltaSave(start.data(), (INT32)start.size(), &nStartLen)) {
+            nStartLen = 0;
+        }
+    }
+
+    GameObservation obs;
+    memset(&obs, 0, sizeof(obs));
+
+    Job job;
+    for (;;) {
+        if (!jobs->pop(&job)) {
+            if (getppid() != trainer) {
+                break; // trainer is gone
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            continue;
+        }
+
+        if (job.episode < 0) {
+            break;
+        }
+
+        if (nStartLen == 0 || BurnStateDeltaLoad(start.data(), nStartLen)) {
+            BurnDrvReset();
+        }
+        MetalInput_SetButtonState(0, 0);
+        sample.episode = job.episode;
+
+        for (uint32_t frame = 0; frame < job.frames; frame++) {
+            sample.frame = frame;
+
+            // Same order as HeadlessRunner::step(): run the frame, look at it,
+            // then pick the input for the next one
+            BurnDrvFrame();
+            obs.frameNumber = frame + 1;
+
+            int count = obs.gameVariables ? obs.numVariables : 0;
+            if (count > AI_BATCH_MAX_VARIABLES) {
+                count = AI_BATCH_MAX_VARIABLES;
+            }
+            if (count > 0) {
+                memcpy(sample.variables, obs.gameVariables, count * sizeof(float));
+            }
+            sample.numVariables = count;
+
+            sample.reward = m_rewardCallback ? m_rewardCallback(obs) : 0.0f;
+
+            InputAction action = m_actionCallback ? m_actionCallback(obs) : InputAction();
+            sample.buttons = AI::PackInputAction(action);
+            MetalInput_SetButtonState(0, sample.buttons);
+
+            // Block when the trainer falls behind, samples are never dropped
+            while (!samples->push(&sample)) {
+                if (getppid() != trainer) {
+                    _exit(1);
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        samples->completed.fetch_add(1, std::memory_order_release);
+    }
+
+    BurnStateDeltaExit();
+    BurnDrvExit();
+#endif
+}
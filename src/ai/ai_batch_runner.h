@@ -0,0 +1,133 @@
+#pragma once
+
+#include "headless_mode.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * AIBatchRunner - Runs N isolated headless instances of one driver for RL rollouts
+ *
+ * The Burn core keeps its state in globals (nBurnDrvActive, pBurnDraw, pSekExt, ...),
+ * so one process can only emulate one game. The batch runner forks one child process
+ * per instance; each child loads the ROM once and then plays the episodes it is handed.
+ *
+ * Features:
+ * - One shared-memory region (created before fork) holding per-instance rings
+ * - Episode jobs flow trainer -> instance, samples flow instance -> trainer
+ * - Single-producer/single-consumer rings, no locks and no syscalls on the hot path
+ * - All samples are gathered in the trainer process through one callback
+ */
+
+// Maximum number of RAM features carried per sample
+#define AI_BATCH_MAX_VARIABLES 64
+
+// One transition as gathered from an instance
+struct AIBatchSample {
+    int32_t instance;                           // Instance index (0 .. numInstances - 1)
+    int32_t episode;                            // Global episode number
+    uint32_t frame;                             // Frame number within the episode
+    float reward;                               // Reward for this frame
+    uint32_t buttons;                           // Packed InputAction (see AI::PackInputAction in ai_action.h)
+    uint32_t numVariables;                      // Valid entries in variables[]
+    float variables[AI_BATCH_MAX_VARIABLES];    // RAM features from the observation
+};
+
+// Batch runner configuration
+struct AIBatchConfig {
+    int numInstances;           // Number of child processes
+    int numEpisodes;            // Total episodes to distribute
+    int framesPerEpisode;       // Frames to run per episode
+    int jobRingSize;            // Episode slots per instance (power of two)
+    int sampleRingSize;         // Sample slots per instance (power of two)
+    fbneo::ai::HeadlessConfig headless; // Settings shared with single-instance collect mode
+
+    AIBatchConfig()
+        : numInstances(2), numEpisodes(1), framesPerEpisode(3600),
+          jobRingSize(16), sampleRingSize(4096) {}
+};
+
+class AIBatchRunner {
+public:
+    // Called in the trainer process for every gathered sample
+    using SampleCallback = std::function<void(const AIBatchSample&)>;
+
+    AIBatchRunner();
+    ~AIBatchRunner();
+
+    /**
+     * Set up the shared-memory rings, must be called before run()
+     *
+     * @param config Batch configuration
+     * @return true if successful, false otherwise
+     */
+    bool initialize(const AIBatchConfig& config);
+
+    /**
+     * Set the policy used inside each instance (runs in the child process)
+     *
+     * @param callback Action callback; if unset instances send no input
+     */
+    void setActionCallback(fbneo::ai::ActionCallback callback);
+
+    /**
+     * Set the reward function used inside each instance (runs in the child process)
+     *
+     * @param callback Reward callback; if unset rewards are 0
+     */
+    void setRewardCallback(fbneo::ai::RewardCallback callback);
+
+    /**
+     * Set the sample sink (runs in the trainer process)
+     *
+     * @param callback Sample callback
+     */
+    void setSampleCallback(SampleCallback callback);
+
+    /**
+     * Fork the instances, distribute all episodes and gather samples until done
+     *
+     * @param romPath Path to ROM file
+     * @param romName Name of ROM
+     * @return true if every instance exited cleanly, false otherwise
+     */
+    bool run(const std::string& romPath, const std::string& romName);
+
+    /**
+     * Ask the trainer loop to stop handing out episodes
+     */
+    void stop();
+
+    // Number of samples gathered so far
+    uint64_t getSampleCount() const;
+
+    // Number of episodes completed by all instances
+    int getCompletedEpisodes() const;
+
+private:
+    struct Ring;
+    struct Job;
+
+    AIBatchConfig m_config;
+    fbneo::ai::ActionCallback m_actionCallback;
+    fbneo::ai::RewardCallback m_rewardCallback;
+    SampleCallback m_sampleCallback;
+
+    // Shared-memory region and the rings carved out of it
+    void* m_shared;
+    size_t m_sharedSize;
+    std::vector<Ring*> m_jobRings;
+    std::vector<Ring*> m_sampleRings;
+    std::vector<int> m_pids;
+
+    std::atomic<bool> m_stop;
+    uint64_t m_sampleCount;
+    int m_completedEpisodes;
+
+    void releaseShared();
+    int drainSamples();
+    void childMain(int instance, const std::string& romPath, const std::string& romName);
+};
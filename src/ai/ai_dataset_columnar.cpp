@@ -0,0 +1,182 @@
+#include "ai_dataset_columnar.h"
+#include "zlib.h"
+
+#include <cstring>
+#include <iostream>
+
+AIColumnarWriter::AIColumnarWriter()
+    : m_file(nullptr)
+    , m_bytesWritten(0)
+    , m_blockRows(0)
+    , m_numVariables(0)
+    , m_frameBytes(0)
+    , m_compressFrames(false)
+{
+}
+
+AIColumnarWriter::~AIColumnarWriter() {
+    close();
+}
+
+bool AIColumnarWriter::open(
+    const std::string& filename,
+    uint32_t numVariables,
+    uint32_t frameWidth,
+    uint32_t frameHeight,
+    uint32_t frameBpp,
+    bool compressFrames,
+    uint32_t blockRows)
+{
+    close();
+
+    if (blockRows == 0) {
+        return false;
+    }
+
+    m_file = fopen(filename.c_str(), "wb");
+    if (!m_file) {
+        std::cerr << "Error: Failed to create dataset file " << filename << std::endl;
+        return false;
+    }
+
+    m_bytesWritten = 0;
+    m_blockRows = blockRows;
+    m_numVariables = numVariables;
+    m_frameBytes = frameWidth * frameHeight * frameBpp;
+    m_compressFrames = compressFrames && m_frameBytes;
+
+    if (!m_frameBytes) {
+        frameWidth = frameHeight = frameBpp = 0;
+    }
+
+    uint32_t header[FBDS_HEADER_SIZE / sizeof(uint32_t)];
+    memset(header, 0, sizeof(header));
+    memcpy(&header[0], "FBDS", 4);
+    header[1] = FBDS_VERSION;
+    header[2] = FBDS_HEADER_SIZE;
+    header[3] = m_blockRows;
+    header[4] = m_numVariables;
+    header[5] = FBDS_NUM_BUTTONS;
+    header[6] = frameWidth;
+    header[7] = frameHeight;
+    header[8] = frameBpp;
+    header[9] = m_compressFrames ? FBDS_COMPRESSION_ZLIB : FBDS_COMPRESSION_NONE;
+
+    // Reserve the block buffers once, rows are appended without reallocating
+    m_frames.reserve(m_blockRows);
+    m_rewards.reserve(m_blockRows);
+    m_buttons.reserve(m_blockRows);
+    m_variables.reserve((size_t)m_blockRows * m_numVariables);
+    m_pixels.reserve((size_t)m_blockRows * m_frameBytes);
+
+    return writeColumn(header, sizeof(header));
+}
+
+bool AIColumnarWriter::appendRow(
+    uint64_t frame,
+    float reward,
+    uint16_t buttons,
+    const float* variables,
+    uint32_t numVariables,
+    const uint8_t* frameData)
+{
+    if (!m_file) {
+        return false;
+    }
+
+    m_frames.push_back(frame);
+    m_rewards.push_back(reward);
+    m_buttons.push_back(buttons);
+
+    uint32_t count = variables ? (numVariables < m_numVariables ? numVariables : m_numVariables) : 0;
+    m_variables.insert(m_variables.end(), variables, variables + count);
+    m_variables.resize(m_variables.size() + (m_numVariables - count), 0.0f);
+
+    if (m_frameBytes) {
+        if (frameData) {
+            m_pixels.insert(m_pixels.end(), frameData, frameData + m_frameBytes);
+        } else {
+            m_pixels.resize(m_pixels.size() + m_frameBytes, 0);
+        }
+    }
+
+    if (m_frames.size() >= m_blockRows) {
+        return flushBlock();
+    }
+
+    return true;
+}
+
+bool AIColumnarWriter::writeColumn(const void* data, size_t size) {
+    static const uint8_t padding[8] = { 0 };
+
+    if (size && fwrite(data, 1, size, m_file) != size) {
+        return false;
+    }
+    m_bytesWritten += size;
+
+    size_t pad = (8 - (size & 7)) & 7;
+    if (pad && fwrite(padding, 1, pad, m_file) != pad) {
+        return false;
+    }
+    m_bytesWritten += pad;
+
+    return true;
+}
+
+bool AIColumnarWriter::flushBlock() {
+    if (!m_file || m_frames.empty()) {
+        return true;
+    }
+
+    const uint32_t rows = (uint32_t)m_frames.size();
+    const uint8_t* frameColumn = m_pixels.data();
+    uint64_t frameColumnSize = m_pixels.size();
+
+    if (m_compressFrames) {
+        uLongf packedSize = compressBound((uLong)m_pixels.size());
+        m_packed.resize(packedSize);
+
+        if (compress2(m_packed.data(), &packedSize, m_pixels.data(), (uLong)m_pixels.size(), Z_BEST_SPEED) != Z_OK) {
+            std::cerr << "Error: Failed to compress frame column" << std::endl;
+            return false;
+        }
+
+        frameColumn = m_packed.data();
+        frameColumnSize = packedSize;
+    }
+
+    uint8_t blockHeader[FBDS_BLOCK_HEADER_SIZE];
+    memcpy(blockHeader + 0, "FBBK", 4);
+    memcpy(blockHeader + 4, &rows, sizeof(uint32_t));
+    memcpy(blockHeader + 8, &frameColumnSize, sizeof(uint64_t));
+
+    bool ok = writeColumn(blockHeader, sizeof(blockHeader))
+        && writeColumn(m_frames.data(), rows * sizeof(uint64_t))
+        && writeColumn(m_rewards.data(), rows * sizeof(float))
+        && writeColumn(m_buttons.data(), rows * sizeof(uint16_t))
+        && writeColumn(m_variables.data(), m_variables.size() * sizeof(float))
+        && writeColumn(frameColumn, (size_t)frameColumnSize);
+
+    m_frames.clear();
+    m_rewards.clear();
+    m_buttons.clear();
+    m_variables.clear();
+    m_pixels.clear();
+
+    if (!ok) {
+        std::cerr << "Error: Failed to write dataset block" << std::endl;
+    }
+
+    return ok;
+}
+
+void AIColumnarWriter::close() {
+    if (!m_file) {
+        return;
+    }
+
+    flushBlock();
+    fclose(m_file);
+    m_file = nullptr;
+}
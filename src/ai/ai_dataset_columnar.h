@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * AIColumnarWriter - Writes gameplay data in the FBDS binary columnar format
+ *
+ * Layout (little-endian, every column starts on an 8-byte boundary):
+ *
+ *   File header (64 bytes)
+ *     char[4]  magic "FBDS"
+ *     u32      version (1)
+ *     u32      header size (64)
+ *     u32      rows per full block
+ *     u32      number of RAM features per row
+ *     u32      number of input buttons (12)
+ *     u32      frame width, frame height, bytes per pixel (0 if no frame column)
+ *     u32      frame compression (0 = raw, 1 = zlib per block)
+ *     u8[24]   reserved
+ *
+ *   Block (repeated)
+ *     char[4]  magic "FBBK"
+ *     u32      rows in this block
+ *     u64      stored size of the frame column
+ *     u64[rows]                 frame number
+ *     f32[rows]                 reward
+ *     u16[rows]                 packed inputs (AI::PackInputAction layout, ai_action.h)
+ *     f32[rows * numVariables]  RAM features, one row after another
+ *     u8[frame column size]     frames, rows * w * h * bpp bytes before compression
+ *
+ * All columns but the frame column can be used straight from a memory map.
+ */
+
+#define FBDS_VERSION            1
+#define FBDS_HEADER_SIZE        64
+#define FBDS_BLOCK_HEADER_SIZE  16
+#define FBDS_NUM_BUTTONS        12
+
+#define FBDS_COMPRESSION_NONE   0
+#define FBDS_COMPRESSION_ZLIB   1
+
+class AIColumnarWriter {
+public:
+    AIColumnarWriter();
+    ~AIColumnarWriter();
+
+    /**
+     * Create a new dataset file and write its header
+     *
+     * @param filename Output file
+     * @param numVariables RAM features stored per row
+     * @param frameWidth Width of the frame column (0 disables it)
+     * @param frameHeight Height of the frame column
+     * @param frameBpp Bytes per pixel of the frame column
+     * @param compressFrames Compress the frame column of each block with zlib
+     * @param blockRows Rows per block
+     * @return true if successful, false otherwise
+     */
+    bool open(const std::string& filename,
+              uint32_t numVariables,
+              uint32_t frameWidth = 0,
+              uint32_t frameHeight = 0,
+              uint32_t frameBpp = 0,
+              bool compressFrames = true,
+              uint32_t blockRows = 4096);
+
+    /**
+     * Append one row, the block is written out once it is full
+     *
+     * @param frame Frame number
+     * @param reward Reward value
+     * @param buttons Packed inputs
+     * @param variables RAM features (missing entries are stored as 0)
+     * @param numVariables Entries in variables
+     * @param frameData Frame pixels (w * h * bpp bytes), ignored without a frame column
+     * @return true if successful, false otherwise
+     */
+    bool appendRow(uint64_t frame,
+                   float reward,
+                   uint16_t buttons,
+                   const float* variables,
+                   uint32_t numVariables,
+                   const uint8_t* frameData);
+
+    /**
+     * Write out the pending (possibly partial) block
+     */
+    bool flushBlock();
+
+    /**
+     * Flush and close the file
+     */
+    void close();
+
+    bool isOpen() const { return m_file != nullptr; }
+    uint64_t bytesWritten() const { return m_bytesWritten; }
+    uint32_t numVariables() const { return m_numVariables; }
+    uint32_t frameBytes() const { return m_frameBytes; }
+
+private:
+    FILE* m_file;
+    uint64_t m_bytesWritten;
+    uint32_t m_blockRows;
+    uint32_t m_numVariables;
+    uint32_t m_frameBytes;
+    bool m_compressFrames;
+
+    // Column buffers for the block being built
+    std::vector<uint64_t> m_frames;
+    std::vector<float> m_rewards;
+    std::vector<uint16_t> m_buttons;
+    std::vector<float> m_variables;
+    std::vector<uint8_t> m_pixels;
+    std::vector<uint8_t> m_packed;
+
+    bool writeColumn(const void* data, size_t size);
+};
@@ -1,4 +1,5 @@
 #include "ai_dataset_logger.h"
+#include "ai_action.h"
 #include "ai_input_frame.h"
 #include "ai_output_action.h"
 #include <iostream>
@@ -6,6 +7,7 @@
 #include <chrono>
 #include <iomanip>
 #include <filesystem>
+#include <cstring>
 #include <nlohmann/json.hpp>
 
 // For compression
@@ -24,14 +26,32 @@ AIDatasetLogger::AIDatasetLogger(
     const std::string& outputDir,
     const std::string& baseFilename,
     size_t maxFileSize,
-    bool useCompression)
+    bool useCompression,
+    size_t queueCapacity)
     : m_outputDir(outputDir)
     , m_baseFilename(baseFilename)
     , m_maxFileSize(maxFileSize)
     , m_useCompression(useCompression)
     , m_enabled(false)
     , m_shutdown(false)
+    , m_flushRequested(false)
+    , m_format(AI_DATASET_FORMAT_JSONL)
+    , m_fileFormat(AI_DATASET_FORMAT_JSONL)
+    , m_captureFrames(false)
+    , m_backpressure(AI_DATASET_DROP_WHEN_FULL)
+    , m_head(0)
+    , m_tail(0)
+    , m_droppedFrames(0)
+    , m_maxQueueDepth(0)
 {
+    // Preallocate the ring, capacity is rounded up to a power of two
+    size_t capacity = 1;
+    while (capacity < queueCapacity) {
+        capacity <<= 1;
+    }
+    m_slots.resize(capacity);
+    m_slotMask = capacity - 1;
+    
     // Create output directory if it doesn't exist
     if (!m_outputDir.empty()) {
         try {
@@ -49,8 +69,7 @@ AIDatasetLogger::~AIDatasetLogger() {
     // Set shutdown flag
     m_shutdown = true;
     
-    // Signal worker thread and wait for it to finish
-    m_queueCV.notify_one();
+    // Wait for the worker thread to drain the ring and finish
     if (m_workerThread.joinable()) {
         m_workerThread.join();
     }
@@ -59,6 +78,7 @@ AIDatasetLogger::~AIDatasetLogger() {
     if (m_outputFile.is_open()) {
         m_outputFile.close();
     }
+    m_columnar.close();
 }
 
 bool AIDatasetLogger::logFrame(
@@ -71,48 +91,91 @@ bool AIDatasetLogger::logFrame(
         return false;
     }
     
-    // Format the log entry
-    std::string logEntry = formatLogEntry(observation, action, frameNumber, reward);
+    // Claim a slot, the emulation thread is the only producer
+    const uint64_t head = m_head.load(std::memory_order_relaxed);
+    while (head - m_tail.load(std::memory_order_acquire) > m_slotMask) {
+        if (m_backpressure == AI_DATASET_DROP_WHEN_FULL || m_shutdown) {
+            m_droppedFrames.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        std::this_thread::yield();
+    }
     
-    // Queue the log entry
-    {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
-        m_logQueue.push(logEntry);
+    // Copy the raw frame data into the slot, all formatting happens on the worker thread
+    LogSlot& slot = m_slots[head & m_slotMask];
+    slot.frame = frameNumber;
+    slot.reward = reward;
+    slot.buttons = (uint16_t)PackInputAction(action);
+    slot.numVariables = (observation.gameVariables && observation.numVariables > 0) ? observation.numVariables : 0;
+    slot.width = observation.width;
+    slot.height = observation.height;
+    slot.bpp = 0;
+    
+    if (m_captureFrames && observation.screenBuffer && observation.width > 0 && observation.height > 0) {
+        slot.bpp = observation.pitch / observation.width;
     }
     
-    // Signal worker thread
-    m_queueCV.notify_one();
+    // Slots keep their capacity, so this only allocates while the ring warms up
+    const size_t variableBytes = slot.numVariables * sizeof(float);
+    const size_t lineBytes = slot.bpp ? (size_t)slot.width * slot.bpp : 0;
+    slot.payload.resize(variableBytes + lineBytes * slot.height);
     
-    return true;
-}
-
-void AIDatasetLogger::flush() {
-    // Signal worker thread to flush
-    m_queueCV.notify_one();
+    uint8_t* p = slot.payload.data();
+    if (variableBytes) {
+        memcpy(p, observation.gameVariables, variableBytes);
+        p += variableBytes;
+    }
     
-    // Wait until queue is empty
-    std::unique_lock<std::mutex> lock(m_queueMutex);
-    bool queueEmpty = m_queueCV.wait_for(lock, std::chrono::seconds(5), 
-        [this]() { return m_logQueue.empty(); });
+    for (int y = 0; lineBytes && y < slot.height; y++) {
+        memcpy(p, observation.screenBuffer + (size_t)y * observation.pitch, lineBytes);
+        p += lineBytes;
+    }
+    
+    m_head.store(head + 1, std::memory_order_release);
     
-    if (!queueEmpty) {
-        std::cerr << "Warning: Flush timed out, queue still has entries" << std::endl;
+    // High-water mark of the queue depth
+    const uint32_t depth = (uint32_t)(head + 1 - m_tail.load(std::memory_order_relaxed));
+    if (depth > m_maxQueueDepth.load(std::memory_order_relaxed)) {
+        m_maxQueueDepth.store(depth, std::memory_order_relaxed);
     }
     
-    // Flush file
-    if (m_outputFile.is_open()) {
-        m_outputFile.flush();
+    return true;
+}
+
+void AIDatasetLogger::flush() {
+    // Ask the worker to flush once the ring is drained, it writes out any partial columnar block too
+    m_flushRequested = true;
+    
+    // Wait until ring is empty and the worker has flushed
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (m_flushRequested || getQueueDepth() != 0) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            std::cerr << "Warning: Flush timed out, queue still has entries" << std::endl;
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
 }
 
 bool AIDatasetLogger::startNewLogFile() {
+    // The worker keeps writing this file's format, whatever setFormat() does meanwhile
+    m_fileFormat = m_format.load();
+    
     // Generate a new filename with timestamp
-    m_currentFilename = m_outputDir + "/" + m_baseFilename + "_" + generateTimestamp() + ".jsonl";
+    const char* extension = (m_fileFormat == AI_DATASET_FORMAT_COLUMNAR) ? ".fbds" : ".jsonl";
+    m_currentFilename = m_outputDir + "/" + m_baseFilename + "_" + generateTimestamp() + extension;
     
     // Close existing file if open
     if (m_outputFile.is_open()) {
         m_outputFile.close();
     }
+    m_columnar.close();
+    
+    // Columnar files are created by the worker on the first row, once the
+    // number of variables and the frame size are known
+    if (m_fileFormat == AI_DATASET_FORMAT_COLUMNAR) {
+        return true;
+    }
     
     // Open new file
     m_outputFile.open(m_currentFilename, std::ios::out | std::ios::app);
@@ -122,7 +185,8 @@ bool AIDatasetLogger::startNewLogFile() {
 
 void AIDatasetLogger::setEnabled(bool enabled) {
     if (enabled && !m_enabled) {
-        // Start a new log file when enabling
+        // Start a new log file when enabling, the worker may still be rotating the old one
+        std::lock_guard<std::mutex> lock(m_fileMutex);
         if (!startNewLogFile()) {
             std::cerr << "Error: Failed to start log file" << std::endl;
             return;
@@ -136,44 +200,113 @@ bool AIDatasetLogger::isEnabled() const {
     return m_enabled;
 }
 
+void AIDatasetLogger::setFormat(AIDatasetFormat format) {
+    m_format = format;
+}
+
+void AIDatasetLogger::setCaptureFrames(bool capture) {
+    m_captureFrames = capture;
+}
+
+void AIDatasetLogger::setBackpressure(AIDatasetBackpressure policy) {
+    m_backpressure = policy;
+}
+
+size_t AIDatasetLogger::getQueueDepth() const {
+    return (size_t)(m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire));
+}
+
+size_t AIDatasetLogger::getMaxQueueDepth() const {
+    return m_maxQueueDepth.load(std::memory_order_relaxed);
+}
+
+uint64_t AIDatasetLogger::getDroppedFrames() const {
+    return m_droppedFrames.load(std::memory_order_relaxed);
+}
+
 void AIDatasetLogger::workerThreadFunc() {
-    while (!m_shutdown) {
-        std::queue<std::string> localQueue;
+    for (;;) {
+        uint64_t tail = m_tail.load(std::memory_order_relaxed);
+        const uint64_t head = m_head.load(std::memory_order_acquire);
+        const bool flushRequested = m_flushRequested;
         
-        // Wait for data or shutdown
-        {
-            std::unique_lock<std::mutex> lock(m_queueMutex);
-            m_queueCV.wait(lock, [this]() {
-                return !m_logQueue.empty() || m_shutdown;
-            });
+        // Process every filled slot, releasing each one as soon as it is written.
+        // The files are only touched under the file lock, setEnabled() may be
+        // starting a new one from the main thread.
+        if (tail != head || flushRequested) {
+            std::lock_guard<std::mutex> lock(m_fileMutex);
+            
+            while (tail != head) {
+                writeSlot(m_slots[tail & m_slotMask]);
+                m_tail.store(++tail, std::memory_order_release);
+            }
             
-            // Swap queues to minimize lock time
-            if (!m_logQueue.empty()) {
-                localQueue.swap(m_logQueue);
+            if (flushRequested) {
+                if (m_outputFile.is_open()) {
+                    m_outputFile.flush();
+                }
+                m_columnar.flushBlock();
             }
         }
         
-        // Process local queue
-        while (!localQueue.empty()) {
-            if (m_outputFile.is_open()) {
-                m_outputFile << localQueue.front() << std::endl;
-                
-                // Check if we need to rotate the file
-                if (m_outputFile.tellp() >= static_cast<std::streampos>(m_maxFileSize)) {
-                    rotateLogFile();
-                }
+        if (flushRequested) {
+            if (getQueueDepth() == 0) {
+                m_flushRequested = false;
             }
-            
-            localQueue.pop();
+            continue;
         }
         
-        // Flush file periodically
-        if (m_outputFile.is_open()) {
-            m_outputFile.flush();
+        if (head == m_head.load(std::memory_order_acquire)) {
+            if (m_shutdown) {
+                break;
+            }
+            
+            // Nothing queued, flush file periodically and poll again shortly
+            {
+                std::lock_guard<std::mutex> lock(m_fileMutex);
+                if (m_outputFile.is_open()) {
+                    m_outputFile.flush();
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
         }
     }
 }
 
+void AIDatasetLogger::writeSlot(const LogSlot& slot) {
+    GameObservation observation;
+    memset(&observation, 0, sizeof(observation));
+    observation.width = slot.width;
+    observation.height = slot.height;
+    observation.pitch = slot.width * slot.bpp;
+    observation.numVariables = slot.numVariables;
+    observation.frameNumber = slot.frame;
+    
+    const uint8_t* payload = slot.payload.data();
+    if (slot.numVariables) {
+        observation.gameVariables = const_cast<float*>(reinterpret_cast<const float*>(payload));
+    }
+    if (slot.bpp) {
+        observation.screenBuffer = const_cast<uint8_t*>(payload + slot.numVariables * sizeof(float));
+    }
+    
+    if (m_fileFormat == AI_DATASET_FORMAT_COLUMNAR) {
+        writeColumnarRow(observation, slot.buttons, slot.frame, slot.reward);
+        return;
+    }
+    
+    if (!m_outputFile.is_open()) {
+        return;
+    }
+    
+    m_outputFile << formatLogEntry(observation, UnpackInputAction(slot.buttons), slot.frame, slot.reward) << '\n';
+    
+    // Check if we need to rotate the file
+    if (m_outputFile.tellp() >= static_cast<std::streampos>(m_maxFileSize)) {
+        rotateLogFile();
+    }
+}
+
 std::string AIDatasetLogger::generateTimestamp() {
     auto now = std::chrono::system_clock::now();
     auto now_time = std::chrono::system_clock::to_time_t(now);
@@ -242,14 +375,46 @@ std::string AIDatasetLogger::formatLogEntry(
     return entry.dump();
 }
 
+void AIDatasetLogger::writeColumnarRow(
+    const GameObservation& observation,
+    uint16_t buttons,
+    uint64_t frameNumber,
+    float reward)
+{
+    const uint32_t bpp = observation.screenBuffer ? observation.pitch / observation.width : 0;
+    
+    // The first row fixes the schema of the file
+    if (!m_columnar.isOpen()) {
+        if (!m_columnar.open(m_currentFilename, observation.numVariables,
+                             bpp ? observation.width : 0, bpp ? observation.height : 0, bpp,
+                             m_useCompression)) {
+            return;
+        }
+    }
+    
+    // Frames of a different size than the file's frame column are stored blank
+    const uint8_t* pixels = observation.screenBuffer;
+    if ((size_t)observation.width * observation.height * bpp != m_columnar.frameBytes()) {
+        pixels = nullptr;
+    }
+    
+    m_columnar.appendRow(frameNumber, reward, buttons, observation.gameVariables, observation.numVariables, pixels);
+    
+    if (m_columnar.bytesWritten() >= m_maxFileSize) {
+        rotateLogFile();
+    }
+}
+
 bool AIDatasetLogger::rotateLogFile() {
+    // Called by the worker with m_fileMutex held
+    
     // Close current file
     if (m_outputFile.is_open()) {
         m_outputFile.close();
     }
     
-    // Compress the file if enabled
-    if (m_useCompression) {
+    // Compress the file if enabled (columnar files compress their frame column themselves)
+    if (m_useCompression && m_fileFormat == AI_DATASET_FORMAT_JSONL) {
         compressFile(m_currentFilename);
     }
     
@@ -4,17 +4,32 @@
 #include <fstream>
 #include <mutex>
 #include <vector>
-#include <queue>
 #include <thread>
 #include <atomic>
-#include <condition_variable>
+#include <cstdint>
 #include "ai_controller.h"
+#include "ai_dataset_columnar.h"
+
+// On-disk format used by AIDatasetLogger
+enum AIDatasetFormat {
+    AI_DATASET_FORMAT_JSONL = 0,     // One JSON object per line (.jsonl)
+    AI_DATASET_FORMAT_COLUMNAR = 1   // FBDS binary columnar blocks (.fbds), see ai_dataset_columnar.h
+};
+
+// What logFrame() does when the writer has fallen behind and the ring is full
+enum AIDatasetBackpressure {
+    AI_DATASET_DROP_WHEN_FULL = 0,   // Drop the frame and count it, never stalls emulation
+    AI_DATASET_BLOCK_WHEN_FULL = 1   // Wait for a free slot, no frame is lost
+};
 
 /**
- * AIDatasetLogger - Records gameplay data (observations and actions) to JSONL files
+ * AIDatasetLogger - Records gameplay data (observations and actions) to JSONL or FBDS files
  * 
  * Features:
- * - Thread-safe logging via worker thread
+ * - Lock-free single-producer/single-consumer ring to the worker thread,
+ *   preallocated slots so logFrame() takes no lock and (once warm) no allocation
+ * - Drop-or-block backpressure with queue depth and dropped frame counters
+ * - Binary columnar output with optional zlib-compressed frame column
  * - File rotation when size exceeds threshold
  * - Optional compression of rotated files
  * - Buffered writing for performance
@@ -28,11 +43,13 @@ public:
      * @param baseFilename Base name for log files (will be appended with timestamp)
      * @param maxFileSize Maximum file size in bytes before rotation (default: 100MB)
      * @param useCompression Whether to compress rotated files (default: true)
+     * @param queueCapacity Number of frames the ring can hold (default: 1024)
      */
     AIDatasetLogger(const std::string& outputDir, 
                    const std::string& baseFilename,
                    size_t maxFileSize = 100 * 1024 * 1024,  // 100MB default
-                   bool useCompression = true);
+                   bool useCompression = true,
+                   size_t queueCapacity = 1024);
     
     /**
      * Destructor - ensures all pending logs are written and resources cleaned up
@@ -46,7 +63,7 @@ public:
      * @param action Action taken in response to observation
      * @param frameNumber The current frame number
      * @param reward Optional reward value
-     * @return true if successfully queued for logging, false otherwise
+     * @return true if successfully queued for logging, false if disabled or dropped
      */
     bool logFrame(const GameObservation& observation, 
                  const InputAction& action,
@@ -79,6 +96,36 @@ public:
      */
     bool isEnabled() const;
 
+    /**
+     * Select the output format, takes effect with the next log file
+     *
+     * @param format AI_DATASET_FORMAT_JSONL or AI_DATASET_FORMAT_COLUMNAR
+     */
+    void setFormat(AIDatasetFormat format);
+
+    /**
+     * Store the screen buffer as a frame column (columnar format only)
+     *
+     * @param capture Whether frames should be captured
+     */
+    void setCaptureFrames(bool capture);
+
+    /**
+     * Select what happens when the ring is full
+     *
+     * @param policy AI_DATASET_DROP_WHEN_FULL (default) or AI_DATASET_BLOCK_WHEN_FULL
+     */
+    void setBackpressure(AIDatasetBackpressure policy);
+
+    // Frames queued but not yet written
+    size_t getQueueDepth() const;
+
+    // Highest queue depth seen so far
+    size_t getMaxQueueDepth() const;
+
+    // Frames dropped because the ring was full
+    uint64_t getDroppedFrames() const;
+
 private:
     // Logger state
     std::string m_outputDir;
@@ -89,11 +136,34 @@ private:
     std::ofstream m_outputFile;
     std::atomic<bool> m_enabled;
     std::atomic<bool> m_shutdown;
+    std::atomic<bool> m_flushRequested;
+    std::atomic<AIDatasetFormat> m_format;  // requested by setFormat()
+    AIDatasetFormat m_fileFormat;           // format of the open file, latched by startNewLogFile()
+    std::mutex m_fileMutex;                 // held while the current file is written, started or rotated
+    bool m_captureFrames;
+    AIColumnarWriter m_columnar;
+    
+    AIDatasetBackpressure m_backpressure;
+    
+    // Raw frame data as copied by logFrame(), formatted by the worker
+    struct LogSlot {
+        uint64_t frame;
+        float reward;
+        uint16_t buttons;
+        uint32_t numVariables;
+        int width;
+        int height;
+        uint32_t bpp;                   // 0 if no frame was captured
+        std::vector<uint8_t> payload;   // variables, then frame lines
+    };
     
-    // Thread synchronization
-    std::mutex m_queueMutex;
-    std::condition_variable m_queueCV;
-    std::queue<std::string> m_logQueue;
+    // SPSC ring: head is written by logFrame() only, tail by the worker only
+    std::vector<LogSlot> m_slots;
+    size_t m_slotMask;
+    alignas(64) std::atomic<uint64_t> m_head;
+    alignas(64) std::atomic<uint64_t> m_tail;
+    std::atomic<uint64_t> m_droppedFrames;
+    std::atomic<uint32_t> m_maxQueueDepth;
     std::thread m_workerThread;
     
     // Worker thread function
@@ -105,6 +175,11 @@ private:
                               const InputAction& action,
                               uint64_t frameNumber,
                               float reward);
+    void writeSlot(const LogSlot& slot);
+    void writeColumnarRow(const GameObservation& observation,
+                          uint16_t buttons,
+                          uint64_t frameNumber,
+                          float reward);
     bool rotateLogFile();
     bool compressFile(const std::string& filename);
 };
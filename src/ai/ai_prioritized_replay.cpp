@@ -0,0 +1,197 @@
+#include "ai_prioritized_replay.h"
+#include <algorithm>
+#include <cmath>
+
+namespace AI {
+
+// Keeps zero-error transitions drawable
+static const float kMinPriority = 1e-6f;
+
+AIPrioritizedReplay::AIPrioritizedReplay(size_t capacity, float alpha, float beta)
+    : m_capacity(std::max<size_t>(capacity, 1)),
+      m_size(0),
+      m_writePos(0),
+      m_alpha(alpha),
+      m_beta(beta),
+      m_maxPriority(1.0f),
+      m_leafCount(1) {
+    while (m_leafCount < m_capacity) {
+        m_leafCount <<= 1;
+    }
+
+    // Frames are constructed as the store fills, the other columns are small
+    m_states.reserve(m_capacity);
+    m_actions.reserve(m_capacity);
+    m_rewards.resize(m_capacity, 0.0f);
+    m_values.resize(m_capacity, 0.0f);
+    m_dones.resize(m_capacity, 0);
+    m_nextLink.resize(m_capacity, 0);
+    m_tree.resize(m_leafCount * 2, 0.0);
+}
+
+size_t AIPrioritizedReplay::add(
+    const AIInputFrame& state,
+    const AIOutputAction& action,
+    float reward,
+    const AIInputFrame& nextState,
+    bool done,
+    float value) {
+
+    const size_t index = m_writePos;
+
+    // Overwriting the oldest transition; nothing links to it since its
+    // predecessor was overwritten before it
+    if (m_size == m_capacity) {
+        releaseLink(index);
+    }
+
+    // Link the previous transition's next state to this slot if we continue it
+    if (m_size > 0 && m_capacity > 1) {
+        const size_t prev = (index + m_capacity - 1) % m_capacity;
+        const int32_t link = m_nextLink[prev];
+
+        if (!m_dones[prev] && link < 0 &&
+            m_tailFrames[~link].getFrameNumber() == state.getFrameNumber()) {
+            releaseLink(prev);
+            m_nextLink[prev] = (int32_t)index;
+        }
+    }
+
+    if (index == m_states.size()) {
+        m_states.push_back(state);
+        m_actions.push_back(action);
+    } else {
+        m_states[index] = state;
+        m_actions[index] = action;
+    }
+
+    m_rewards[index] = reward;
+    m_values[index] = value;
+    m_dones[index] = done ? 1 : 0;
+    m_nextLink[index] = storeTail(nextState);
+
+    // New transitions get the highest priority seen so they are replayed at least once
+    setLeaf(index, std::pow((double)m_maxPriority, (double)m_alpha));
+
+    m_writePos = (index + 1) % m_capacity;
+    m_size = std::min(m_size + 1, m_capacity);
+
+    return index;
+}
+
+void AIPrioritizedReplay::sample(size_t batchSize, std::mt19937& rng, AIReplayBatch& batch) const {
+    batch.clear();
+
+    const double total = m_tree[1];
+    if (batchSize == 0 || m_size == 0 || total <= 0.0) {
+        return;
+    }
+
+    batch.indices.reserve(batchSize);
+    batch.weights.reserve(batchSize);
+
+    // One draw per equal-mass segment keeps the batch spread over the whole range
+    const double segment = total / batchSize;
+    float maxWeight = 0.0f;
+
+    for (size_t i = 0; i < batchSize; ++i) {
+        std::uniform_real_distribution<double> dist(segment * i, segment * (i + 1));
+        const size_t index = findLeaf(dist(rng));
+
+        const double probability = m_tree[m_leafCount + index] / total;
+        const float weight = (float)std::pow(m_size * probability, -(double)m_beta);
+
+        batch.indices.push_back(index);
+        batch.weights.push_back(weight);
+        maxWeight = std::max(maxWeight, weight);
+    }
+
+    // Normalize so weights only ever scale updates down
+    if (maxWeight > 0.0f) {
+        for (float& weight : batch.weights) {
+            weight /= maxWeight;
+        }
+    }
+}
+
+void AIPrioritizedReplay::updatePriority(size_t index, float priority) {
+    if (index >= m_size) {
+        return;
+    }
+
+    priority = std::fabs(priority) + kMinPriority;
+    m_maxPriority = std::max(m_maxPriority, priority);
+
+    setLeaf(index, std::pow((double)priority, (double)m_alpha));
+}
+
+const AIInputFrame& AIPrioritizedReplay::nextState(size_t index) const {
+    const int32_t link = m_nextLink[index];
+    return link >= 0 ? m_states[link] : m_tailFrames[~link];
+}
+
+size_t AIPrioritizedReplay::slot(size_t n) const {
+    return (m_writePos + m_capacity - m_size + n) % m_capacity;
+}
+
+void AIPrioritizedReplay::clear() {
+    m_size = 0;
+    m_writePos = 0;
+    m_maxPriority = 1.0f;
+
+    m_states.clear();
+    m_actions.clear();
+    m_tailFrames.clear();
+    m_freeTails.clear();
+    std::fill(m_tree.begin(), m_tree.end(), 0.0);
+}
+
+int32_t AIPrioritizedReplay::storeTail(const AIInputFrame& frame) {
+    if (!m_freeTails.empty()) {
+        const int32_t tail = m_freeTails.back();
+        m_freeTails.pop_back();
+        m_tailFrames[tail] = frame;
+        return ~tail;
+    }
+
+    m_tailFrames.push_back(frame);
+    return ~(int32_t)(m_tailFrames.size() - 1);
+}
+
+void AIPrioritizedReplay::releaseLink(size_t index) {
+    const int32_t link = m_nextLink[index];
+    if (link < 0) {
+        m_freeTails.push_back(~link);
+    }
+}
+
+void AIPrioritizedReplay::setLeaf(size_t index, double value) {
+    size_t node = m_leafCount + index;
+    m_tree[node] = value;
+
+    // Recompute the sums rather than applying a delta so rounding cannot drift
+    for (node >>= 1; node >= 1; node >>= 1) {
+        m_tree[node] = m_tree[node * 2] + m_tree[node * 2 + 1];
+    }
+}
+
+size_t AIPrioritizedReplay::findLeaf(double mass) const {
+    size_t node = 1;
+
+    while (node < m_leafCount) {
+        const size_t left = node * 2;
+
+        // Only step right into a non-empty subtree, so rounding at the top
+        // of the range never lands on an unused leaf
+        if (mass < m_tree[left] || m_tree[left + 1] <= 0.0) {
+            node = left;
+        } else {
+            mass -= m_tree[left];
+            node = left + 1;
+        }
+    }
+
+    return std::min(node - m_leafCount, m_size - 1);
+}
+
+} // namespace AI
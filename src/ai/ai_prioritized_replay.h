@@ -0,0 +1,141 @@
+#pragma once
+
+#include "ai_input_frame.h"
+#include "ai_output_action.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace AI {
+
+/**
+ * @struct AIReplayBatch
+ * @brief Transitions drawn from an AIPrioritizedReplay
+ *
+ * Holds slot indices into the replay store rather than copies of the frames,
+ * plus the importance-sampling weight of each drawn transition.
+ */
+struct AIReplayBatch {
+    std::vector<size_t> indices;
+    std::vector<float> weights;
+
+    size_t size() const { return indices.size(); }
+    void clear() { indices.clear(); weights.clear(); }
+};
+
+/**
+ * @class AIPrioritizedReplay
+ * @brief Circular prioritized experience replay with struct-of-arrays storage
+ *
+ * Every transition field lives in its own preallocated array indexed by slot,
+ * so adding a transition never allocates once the store has filled up.
+ *
+ * Each frame is stored once: the state of a transition lives in its slot, and
+ * the next state is a link to the slot of the following transition when the
+ * trajectory continues (the usual case during a rollout). Only the last next
+ * state of a trajectory (episode end, or the newest transition) is kept in a
+ * small side pool.
+ *
+ * Sampling is proportional to priority^alpha through a sum-tree, O(log n) per
+ * draw and per priority update.
+ */
+class AIPrioritizedReplay {
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of transitions kept
+     * @param alpha Priority exponent (0 = uniform sampling)
+     * @param beta Importance-sampling exponent (1 = full correction)
+     */
+    AIPrioritizedReplay(size_t capacity, float alpha = 0.6f, float beta = 0.4f);
+
+    /**
+     * @brief Add a transition, overwriting the oldest one when full
+     *
+     * When the previous transition is not done and its next state has the
+     * frame number of state, state is taken to continue that trajectory and
+     * is stored only once.
+     *
+     * @param state Current state
+     * @param action Action taken
+     * @param reward Reward received
+     * @param nextState Next state
+     * @param done Whether episode is done
+     * @param value Value estimate recorded with the transition
+     * @return Slot index of the new transition
+     */
+    size_t add(const AIInputFrame& state, const AIOutputAction& action,
+               float reward, const AIInputFrame& nextState, bool done,
+               float value = 0.0f);
+
+    /**
+     * @brief Draw a batch proportional to priority (stratified, with replacement)
+     * @param batchSize Number of transitions to draw
+     * @param rng Random number generator
+     * @param batch Receives the slot indices and importance-sampling weights
+     */
+    void sample(size_t batchSize, std::mt19937& rng, AIReplayBatch& batch) const;
+
+    /**
+     * @brief Set the priority of a transition (e.g. its TD error)
+     * @param index Slot index
+     * @param priority New priority (absolute value is used)
+     */
+    void updatePriority(size_t index, float priority);
+
+    // Slot accessors, frames are returned by reference
+    const AIInputFrame& state(size_t index) const { return m_states[index]; }
+    const AIInputFrame& nextState(size_t index) const;
+    const AIOutputAction& action(size_t index) const { return m_actions[index]; }
+    float reward(size_t index) const { return m_rewards[index]; }
+    float value(size_t index) const { return m_values[index]; }
+    bool done(size_t index) const { return m_dones[index] != 0; }
+
+    /**
+     * @brief Slot index of the n-th oldest transition
+     * @param n Age rank (0 = oldest, size() - 1 = newest)
+     */
+    size_t slot(size_t n) const;
+
+    size_t size() const { return m_size; }
+    size_t capacity() const { return m_capacity; }
+    void clear();
+
+    void setAlpha(float alpha) { m_alpha = alpha; }
+    void setBeta(float beta) { m_beta = beta; }
+    float getAlpha() const { return m_alpha; }
+    float getBeta() const { return m_beta; }
+
+private:
+    size_t m_capacity;
+    size_t m_size;
+    size_t m_writePos;
+    float m_alpha;
+    float m_beta;
+    float m_maxPriority;
+
+    // Transition columns, one entry per slot
+    std::vector<AIInputFrame> m_states;
+    std::vector<AIOutputAction> m_actions;
+    std::vector<float> m_rewards;
+    std::vector<float> m_values;
+    std::vector<uint8_t> m_dones;
+
+    // Next-state link: >= 0 is the slot holding it, < 0 is ~index into m_tailFrames
+    std::vector<int32_t> m_nextLink;
+
+    // Next states that end a trajectory, recycled through a free list
+    std::vector<AIInputFrame> m_tailFrames;
+    std::vector<int32_t> m_freeTails;
+
+    // Sum-tree over priority^alpha, leaves start at m_leafCount
+    size_t m_leafCount;
+    std::vector<double> m_tree;
+
+    int32_t storeTail(const AIInputFrame& frame);
+    void releaseLink(size_t index);
+    void setLeaf(size_t index, double value);
+    size_t findLeaf(double mass) const;
+};
+
+} // namespace AI
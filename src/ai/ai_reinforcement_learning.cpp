@@ -25,6 +25,7 @@ AIReinforcementLearning::AIReinforcementLearning(
     float gamma,
     float learningRate)
     : m_policyModel(policyModel),
+      m_replay(bufferSize),
       m_bufferSize(bufferSize),
       m_batchSize(batchSize),
       m_gamma(gamma),
@@ -33,9 +34,6 @@ AIReinforcementLearning::AIReinforcementLearning(
     // Initialize random generator with seed
     std::random_device rd;
     m_rng = std::mt19937(rd());
-    
-    // Reserve space for experience buffer
-    m_experienceBuffer.reserve(m_bufferSize);
 }
 
 AIReinforcementLearning::~AIReinforcementLearning() {
@@ -49,13 +47,8 @@ void AIReinforcementLearning::addExperience(
     const AIInputFrame& nextState,
     bool done) {
     
-    // Add experience to buffer
-    m_experienceBuffer.emplace_back(state, action, reward, nextState, done);
-    
-    // If buffer exceeds max size, remove oldest entries
-    if (m_experienceBuffer.size() > m_bufferSize) {
-        m_experienceBuffer.pop_front();
-    }
+    // Add experience to buffer, the oldest entry is overwritten once it is full
+    m_replay.add(state, action, reward, nextState, done);
 }
 
 float AIReinforcementLearning::train(int epochs) {
@@ -64,17 +57,18 @@ float AIReinforcementLearning::train(int epochs) {
         return -1.0f;
     }
     
-    if (m_experienceBuffer.size() < m_batchSize) {
+    if (m_replay.size() < m_batchSize) {
         std::cerr << "Cannot train: Not enough experiences (" 
-                  << m_experienceBuffer.size() << " < " << m_batchSize << ")" << std::endl;
+                  << m_replay.size() << " < " << m_batchSize << ")" << std::endl;
         return -1.0f;
     }
     
     float totalLoss = 0.0f;
+    AIReplayBatch batch;
     
     for (int epoch = 0; epoch < epochs; ++epoch) {
-        // Sample batch of experiences
-        std::vector<Experience> batch = sampleBatch();
+        // Sample batch of experiences (slot indices, no frame copies)
+        sampleBatch(batch);
         
         // Calculate advantages
         std::vector<float> advantages;
@@ -85,8 +79,9 @@ float AIReinforcementLearning::train(int epochs) {
         totalLoss += loss;
         
         // Update policy model
-        for (const auto& exp : batch) {
-            m_policyModel->update(exp.state, exp.action, exp.reward, exp.nextState, exp.done);
+        for (size_t index : batch.indices) {
+            m_policyModel->update(m_replay.state(index), m_replay.action(index), m_replay.reward(index),
+                                  m_replay.nextState(index), m_replay.done(index));
         }
     }
     
@@ -128,11 +123,20 @@ bool AIReinforcementLearning::loadModel(const std::string& path) {
 }
 
 void AIReinforcementLearning::clearExperiences() {
-    m_experienceBuffer.clear();
+    m_replay.clear();
 }
 
 size_t AIReinforcementLearning::getExperienceCount() const {
-    return m_experienceBuffer.size();
+    return m_replay.size();
+}
+
+const AIPrioritizedReplay& AIReinforcementLearning::getReplayBuffer() const {
+    return m_replay;
+}
+
+void AIReinforcementLearning::setPriorityExponents(float alpha, float beta) {
+    m_replay.setAlpha(alpha);
+    m_replay.setBeta(beta);
 }
 
 float AIReinforcementLearning::getClipRatio() const {
@@ -150,23 +154,25 @@ bool AIReinforcementLearning::exportExperiencesToJson(const std::string& filenam
     try {
         json experiencesJson = json::array();
         
-        for (const auto& exp : m_experienceBuffer) {
+        // Oldest first, so a re-import links trajectories the same way
+        for (size_t n = 0; n < m_replay.size(); ++n) {
+            const size_t index = m_replay.slot(n);
             json expJson;
             
             // Convert state to JSON
-            std::string stateJson = exp.state.toJson();
+            std::string stateJson = m_replay.state(index).toJson();
             expJson["state"] = json::parse(stateJson);
             
             // Convert action to JSON
-            std::string actionJson = exp.action.toJson();
+            std::string actionJson = m_replay.action(index).toJson();
             expJson["action"] = json::parse(actionJson);
             
             // Add reward and done flag
-            expJson["reward"] = exp.reward;
-            expJson["done"] = exp.done;
+            expJson["reward"] = m_replay.reward(index);
+            expJson["done"] = m_replay.done(index);
             
             // Convert next state to JSON
-            std::string nextStateJson = exp.nextState.toJson();
+            std::string nextStateJson = m_replay.nextState(index).toJson();
             expJson["nextState"] = json::parse(nextStateJson);
             
             experiencesJson.push_back(expJson);
@@ -255,28 +261,18 @@ int AIReinforcementLearning::importExperiencesFromJson(const std::string& filena
 
 // Private Methods
 
-std::vector<Experience> AIReinforcementLearning::sampleBatch() {
-    std::vector<Experience> batch;
-    
-    // Ensure we have enough experiences
-    if (m_experienceBuffer.size() <= m_batchSize) {
-        // If we don't have enough, return all experiences
-        batch.insert(batch.end(), m_experienceBuffer.begin(), m_experienceBuffer.end());
-        return batch;
-    }
-    
-    // Sample without replacement
-    std::vector<size_t> indices(m_experienceBuffer.size());
-    std::iota(indices.begin(), indices.end(), 0);
-    std::shuffle(indices.begin(), indices.end(), m_rng);
-    
-    // Take the first m_batchSize elements
-    batch.reserve(m_batchSize);
-    for (size_t i = 0; i < m_batchSize; ++i) {
-        batch.push_back(m_experienceBuffer[indices[i]]);
+void AIReinforcementLearning::sampleBatch(AIReplayBatch& batch) {
+    // Draw proportional to priority; small buffers are returned whole
+    if (m_replay.size() <= m_batchSize) {
+        batch.clear();
+        for (size_t n = 0; n < m_replay.size(); ++n) {
+            batch.indices.push_back(m_replay.slot(n));
+            batch.weights.push_back(1.0f);
+        }
+        return;
     }
     
-    return batch;
+    m_replay.sample(m_batchSize, m_rng, batch);
 }
 
 float AIReinforcementLearning::calculateGAE(const std::vector<Experience>& batch, std::vector<float>& advantages) {
@@ -286,8 +282,6 @@ float AIReinforcementLearning::calculateGAE(const std::vector<Experience>& batch
     advantages.clear();
     advantages.reserve(batch.size());
     
-    float totalAdvantage = 0.0f;
-    
     for (const auto& exp : batch) {
         // Simple advantage: reward + gamma * nextValue - currentValue
         // For simplicity, assuming value is 0.0f for now
@@ -297,9 +291,32 @@ float AIReinforcementLearning::calculateGAE(const std::vector<Experience>& batch
         }
         
         advantages.push_back(advantage);
-        totalAdvantage += advantage;
     }
     
+    return normalizeAdvantages(advantages);
+}
+
+float AIReinforcementLearning::calculateGAE(const AIReplayBatch& batch, std::vector<float>& advantages) {
+    advantages.clear();
+    advantages.reserve(batch.size());
+    
+    for (size_t index : batch.indices) {
+        float advantage = m_replay.reward(index);
+        if (!m_replay.done(index)) {
+            advantage += m_gamma * 0.0f; // Placeholder for next state value
+        }
+        
+        // The unnormalized advantage doubles as the transition's new priority
+        m_replay.updatePriority(index, advantage);
+        advantages.push_back(advantage);
+    }
+    
+    return normalizeAdvantages(advantages);
+}
+
+float AIReinforcementLearning::normalizeAdvantages(std::vector<float>& advantages) {
+    float totalAdvantage = std::accumulate(advantages.begin(), advantages.end(), 0.0f);
+    
     // Normalize advantages
     if (!advantages.empty()) {
         float mean = totalAdvantage / advantages.size();
@@ -330,46 +347,8 @@ float AIReinforcementLearning::calculatePPOLoss(const std::vector<Experience>& b
     // Process each experience
     for (size_t i = 0; i < batch.size(); ++i) {
         const auto& exp = batch[i];
-        float advantage = advantages[i];
-        
-        // Get current policy and value predictions
-        float currentLogProb = 0.0f;
-        float currentValue = 0.0f;
-        
-        if (m_policyModel && m_policyModel->isModelLoaded()) {
-            // Get log probability and value from policy model
-            currentLogProb = m_policyModel->computeLogProb(exp.state, exp.action);
-            currentValue = m_policyModel->computeValue(exp.state);
-        } else {
-            // Fallback to stored values if model not available
-            currentLogProb = exp.action.getLogProb();
-            currentValue = exp.value;
-        }
-        
-        // Get old log probability from saved experience
-        float oldLogProb = exp.action.getLogProb();
-        
-        // Calculate probability ratio (new / old)
-        float ratio = std::exp(currentLogProb - oldLogProb);
-        
-        // Calculate surrogate objectives for PPO clipping
-        float surr1 = ratio * advantage;
-        float surr2 = std::clamp(ratio, 1.0f - m_clipRatio, 1.0f + m_clipRatio) * advantage;
-        
-        // Use minimum for pessimistic bound (PPO clipping)
-        float policySurrogate = -std::min(surr1, surr2);
-        
-        // Calculate value function loss (MSE)
-        float valueTarget = advantage + exp.value; // Advantage + old value = return
-        float valueMSE = (currentValue - valueTarget) * (currentValue - valueTarget);
-        
-        // Calculate entropy for exploration
-        float entropy = -currentLogProb * 0.01f; // Simple approximate entropy
-        
-        // Accumulate losses
-        policyLoss += policySurrogate;
-        valueLoss += valueMSE;
-        entropyLoss += entropy;
+        accumulatePPOLoss(exp.state, exp.action, exp.value, advantages[i], 1.0f,
+                          policyLoss, valueLoss, entropyLoss);
     }
     
     // Calculate average losses
@@ -384,6 +363,76 @@ float AIReinforcementLearning::calculatePPOLoss(const std::vector<Experience>& b
     return totalLoss;
 }
 
+float AIReinforcementLearning::calculatePPOLoss(const AIReplayBatch& batch, const std::vector<float>& advantages) {
+    float policyLoss = 0.0f;
+    float valueLoss = 0.0f;
+    float entropyLoss = 0.0f;
+    
+    // Importance-sampling weights undo the bias of prioritized sampling
+    for (size_t i = 0; i < batch.size(); ++i) {
+        size_t index = batch.indices[i];
+        accumulatePPOLoss(m_replay.state(index), m_replay.action(index), m_replay.value(index),
+                          advantages[i], batch.weights[i],
+                          policyLoss, valueLoss, entropyLoss);
+    }
+    
+    float avgPolicyLoss = policyLoss / batch.size();
+    float avgValueLoss = valueLoss / batch.size();
+    float avgEntropyLoss = entropyLoss / batch.size();
+    
+    return avgPolicyLoss + 0.5f * avgValueLoss - 0.01f * avgEntropyLoss;
+}
+
+void AIReinforcementLearning::accumulatePPOLoss(
+    const AIInputFrame& state,
+    const AIOutputAction& action,
+    float value,
+    float advantage,
+    float weight,
+    float& policyLoss,
+    float& valueLoss,
+    float& entropyLoss) {
+    
+    // Get current policy and value predictions
+    float currentLogProb = 0.0f;
+    float currentValue = 0.0f;
+    
+    if (m_policyModel && m_policyModel->isModelLoaded()) {
+        // Get log probability and value from policy model
+        currentLogProb = m_policyModel->computeLogProb(state, action);
+        currentValue = m_policyModel->computeValue(state);
+    } else {
+        // Fallback to stored values if model not available
+        currentLogProb = action.getLogProb();
+        currentValue = value;
+    }
+    
+    // Get old log probability from saved experience
+    float oldLogProb = action.getLogProb();
+    
+    // Calculate probability ratio (new / old)
+    float ratio = std::exp(currentLogProb - oldLogProb);
+    
+    // Calculate surrogate objectives for PPO clipping
+    float surr1 = ratio * advantage;
+    float surr2 = std::clamp(ratio, 1.0f - m_clipRatio, 1.0f + m_clipRatio) * advantage;
+    
+    // Use minimum for pessimistic bound (PPO clipping)
+    float policySurrogate = -std::min(surr1, surr2);
+    
+    // Calculate value function loss (MSE)
+    float valueTarget = advantage + value; // Advantage + old value = return
+    float valueMSE = (currentValue - valueTarget) * (currentValue - valueTarget);
+    
+    // Calculate entropy for exploration
+    float entropy = -currentLogProb * 0.01f; // Simple approximate entropy
+    
+    // Accumulate losses
+    policyLoss += weight * policySurrogate;
+    valueLoss += weight * valueMSE;
+    entropyLoss += entropy;
+}
+
 // Implementation of Proximal Policy Optimization (PPO) training
 float AIReinforcementLearning::TrainPPO(const std::vector<Experience>& batch, float clipEpsilon, float learningRate) {
     if (!m_policyModel || !m_policyModel->isModelLoaded()) {
@@ -3,9 +3,9 @@
 #include "ai_input_frame.h"
 #include "ai_output_action.h"
 #include "ai_torch_policy_model.h"
+#include "ai_prioritized_replay.h"
 #include <string>
 #include <vector>
-#include <deque>
 #include <random>
 #include <memory>
 
@@ -15,7 +15,8 @@ namespace AI {
  * @struct Experience
  * @brief Represents a single transition in reinforcement learning
  * 
- * Contains state, action, reward, next state, and done flag
+ * Contains state, action, reward, next state, done flag and the value
+ * estimate recorded when the action was taken
  */
 struct Experience {
     AIInputFrame state;
@@ -23,10 +24,11 @@ struct Experience {
     float reward;
     AIInputFrame nextState;
     bool done;
+    float value;
     
     Experience(const AIInputFrame& s, const AIOutputAction& a, float r, 
-               const AIInputFrame& ns, bool d)
-        : state(s), action(a), reward(r), nextState(ns), done(d) {}
+               const AIInputFrame& ns, bool d, float v = 0.0f)
+        : state(s), action(a), reward(r), nextState(ns), done(d), value(v) {}
 };
 
 /**
@@ -145,6 +147,19 @@ public:
      */
     void setClipRatio(float ratio);
     
+    /**
+     * @brief Get the replay buffer
+     * @return Reference to the prioritized replay store
+     */
+    const AIPrioritizedReplay& getReplayBuffer() const;
+    
+    /**
+     * @brief Set the prioritized replay exponents
+     * @param alpha Priority exponent (0 = uniform sampling)
+     * @param beta Importance-sampling exponent (1 = full correction)
+     */
+    void setPriorityExponents(float alpha, float beta);
+    
     /**
      * @brief Export experiences to JSON
      * @param filename File to save experiences to
@@ -164,7 +179,7 @@ private:
     std::shared_ptr<AITorchPolicyModel> m_policyModel;
     
     // Experience buffer
-    std::deque<Experience> m_experienceBuffer;
+    AIPrioritizedReplay m_replay;
     
     // Training parameters
     size_t m_bufferSize;
@@ -177,9 +192,15 @@ private:
     std::mt19937 m_rng;
     
     // Private methods
-    std::vector<Experience> sampleBatch();
+    void sampleBatch(AIReplayBatch& batch);
     float calculateGAE(const std::vector<Experience>& batch, std::vector<float>& advantages);
+    float calculateGAE(const AIReplayBatch& batch, std::vector<float>& advantages);
     float calculatePPOLoss(const std::vector<Experience>& batch, const std::vector<float>& advantages);
+    float calculatePPOLoss(const AIReplayBatch& batch, const std::vector<float>& advantages);
+    float normalizeAdvantages(std::vector<float>& advantages);
+    void accumulatePPOLoss(const AIInputFrame& state, const AIOutputAction& action, float value,
+                           float advantage, float weight,
+                           float& policyLoss, float& valueLoss, float& entropyLoss);
 };
 
 } // namespace AI 
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "cli_modes.h"
 #include "ai_dataset_logger.h"
+#include "ai_batch_runner.h"
+#include "ai_action.h"
 #include "neural_ai_controller.h"
 #include "headless_mode.h"
 
@@ -21,14 +23,17 @@ static std::string g_replayPath;
 static std::string g_configPath;
 static std::string g_outputDir = "output";
 static int g_frames = 0;
+static int g_instances = 1;
+static int g_episodes = 1;
 static bool g_ai1 = false;
 static bool g_ai2 = false;
 
 // Print usage information
 void printUsage() {
     std::cout << "FBNeo AI Integration Usage:" << std::endl;
-    std::cout << "  --collect --rom <romname or path> [--frames N] [--output <dir>]" << std::endl;
+    std::cout << "  --collect --rom <romname or path> [--frames N] [--output <dir>] [--instances N] [--episodes N]" << std::endl;
     std::cout << "      Run the game in headless mode for N frames (or until game over) and log data." << std::endl;
+    std::cout << "      With --instances > 1, episodes are spread over N forked headless instances." << std::endl;
     std::cout << "  --play --rom <rom> --model <file.pt> [--ai1] [--ai2]" << std::endl;
     std::cout << "      Launch game with AI controlling player 1 and/or 2 using the given model." << std::endl;
     std::cout << "  --train --config <config.json>" << std::endl;
@@ -52,6 +57,8 @@ bool parseCLIArgs(int argc, char* argv[]) {
         {"output", required_argument, nullptr, 'o'},
         {"ai1", no_argument, nullptr, '1'},
         {"ai2", no_argument, nullptr, '2'},
+        {"instances", required_argument, nullptr, 'i'},
+        {"episodes", required_argument, nullptr, 'e'},
         {"help", no_argument, nullptr, 'h'},
         {nullptr, 0, nullptr, 0}
     };
@@ -59,7 +66,7 @@ bool parseCLIArgs(int argc, char* argv[]) {
     int optionIndex = 0;
     int opt;
 
-    while ((opt = getopt_long(argc, argv, "cptrhm:d:f:g:n:o:12", longOptions, &optionIndex)) != -1) {
+    while ((opt = getopt_long(argc, argv, "cptrhm:d:f:g:n:o:12i:e:", longOptions, &optionIndex)) != -1) {
         switch (opt) {
             case 'c':
                 g_modeCollect = true;
@@ -97,6 +104,12 @@ bool parseCLIArgs(int argc, char* argv[]) {
             case '2':
                 g_ai2 = true;
                 break;
+            case 'i':
+                g_instances = std::stoi(optarg);
+                break;
+            case 'e':
+                g_episodes = std::stoi(optarg);
+                break;
             case 'h':
                 printUsage();
                 return false;
@@ -145,6 +158,11 @@ bool parseCLIArgs(int argc, char* argv[]) {
         }
     }
 
+    if (g_instances < 1 || g_episodes < 1) {
+        std::cerr << "Error: --instances and --episodes must be at least 1." << std::endl;
+        return false;
+    }
+
     if (g_modePlay && g_modelPath.empty()) {
         std::cerr << "Error: --model argument is required for --play mode." << std::endl;
         return false;
@@ -169,8 +187,57 @@ bool parseCLIArgs(int argc, char* argv[]) {
     return true;
 }
 
+// Run collect mode over several forked headless instances
+static int runBatchCollectMode() {
+    std::cout << "Running batch collect mode for ROM: " << g_romPath
+              << " with " << g_instances << " instances, " << g_episodes << " episodes" << std::endl;
+
+    AIBatchConfig config;
+    config.numInstances = g_instances;
+    config.numEpisodes = g_episodes;
+    if (g_frames > 0) {
+        config.framesPerEpisode = g_frames;
+    }
+    config.headless.outputDir = g_outputDir;
+    config.headless.maxEpisodeLength = config.framesPerEpisode;
+
+    AIBatchRunner batch;
+    if (!batch.initialize(config)) {
+        std::cerr << "Failed to initialize batch runner" << std::endl;
+        return 1;
+    }
+
+    // Samples from every instance end up in one dataset in this process
+    AIDatasetLogger logger(g_outputDir, g_romName);
+    logger.setEnabled(true);
+
+    batch.setSampleCallback([&logger](const AIBatchSample& sample) {
+        fbneo::ai::GameObservation obs = {};
+        obs.gameVariables = const_cast<float*>(sample.variables);
+        obs.numVariables = sample.numVariables;
+        obs.frameNumber = sample.frame;
+        logger.logFrame(obs, AI::UnpackInputAction(sample.buttons), sample.frame, sample.reward);
+    });
+
+    bool clean = batch.run(g_romPath, g_romName);
+
+    std::cout << "Batch collection completed:" << std::endl;
+    std::cout << "  Episodes: " << batch.getCompletedEpisodes() << std::endl;
+    std::cout << "  Samples: " << batch.getSampleCount() << std::endl;
+
+    logger.flush();
+    logger.setEnabled(false);
+
+    std::cout << "Data collection finished. Output saved to: " << g_outputDir << std::endl;
+    return clean ? 0 : 1;
+}
+
 // Run collect mode
 int runCollectMode() {
+    if (g_instances > 1) {
+        return runBatchCollectMode();
+    }
+
     std::cout << "Running collect mode for ROM: " << g_romPath;
     if (g_frames > 0) {
         std::cout << " for " << g_frames << " frames";
@@ -15,6 +15,9 @@ from PIL import Image
 import glob
 from pathlib import Path
 import random
+import bisect
+import struct
+import zlib
 
 class GameplayDataset(Dataset):
     """
@@ -301,6 +304,326 @@ class GameplayDataset(Dataset):
             return action.shape[0]
         return 0
 
+# FBDS binary columnar format written by AIDatasetLogger (see src/ai/ai_dataset_columnar.h)
+FBDS_MAGIC = b'FBDS'
+FBDS_BLOCK_MAGIC = b'FBBK'
+FBDS_VERSION = 1
+FBDS_HEADER_SIZE = 64
+FBDS_BLOCK_HEADER_SIZE = 16
+FBDS_COMPRESSION_NONE = 0
+FBDS_COMPRESSION_ZLIB = 1
+
+# Bit order of the packed input column, same indices as GameplayDataset._extract_action
+ACTION_KEYS = ['up', 'down', 'left', 'right',
+               'button1', 'button2', 'button3', 'button4', 'button5', 'button6',
+               'start', 'coin']
+
+def _align8(n):
+    return (n + 7) & ~7
+
+class ColumnarDataset(Dataset):
+    """
+    Dataset class for FBDS binary columnar files written by AIDatasetLogger
+    
+    Features:
+    - Files are memory-mapped, the frame/reward/input/variable columns of every
+      block are numpy views into the mapping (no parsing, no copies)
+    - Frame column is decompressed per block on demand
+    - Same item layout as GameplayDataset
+    """
+    
+    def __init__(self,
+                data_path,
+                image_size=(96, 128),
+                max_frames=None,
+                include_screen=True):
+        """
+        Initialize the dataset
+        
+        Args:
+            data_path: Path to .fbds file or directory containing .fbds files
+            image_size: Tuple (height, width) for image resizing
+            max_frames: Maximum number of frames to expose (None for all)
+            include_screen: Whether to return image data
+        """
+        self.data_path = data_path
+        self.image_size = image_size
+        self.include_screen = include_screen
+        
+        self.data_files = []
+        if os.path.isdir(data_path):
+            self.data_files = sorted(glob.glob(os.path.join(data_path, "**/*.fbds"), recursive=True))
+        elif os.path.isfile(data_path) and data_path.endswith(".fbds"):
+            self.data_files = [data_path]
+        
+        self.files = []
+        self.blocks = []
+        self.block_starts = []
+        self.num_rows = 0
+        
+        for file_path in self.data_files:
+            self._map_file(file_path)
+        
+        if max_frames is not None:
+            self.num_rows = min(self.num_rows, max_frames)
+        
+        self._frame_cache_block = None
+        self._frame_cache = None
+        
+        print(f"Mapped {self.num_rows} frames in {len(self.blocks)} blocks from {len(self.data_files)} files")
+    
+    def _map_file(self, file_path):
+        """Memory-map one file and record views of each block's columns"""
+        mm = np.memmap(file_path, dtype=np.uint8, mode='r')
+        if len(mm) < FBDS_HEADER_SIZE or bytes(mm[:4]) != FBDS_MAGIC:
+            print(f"Warning: {file_path} is not an FBDS file")
+            return
+        
+        header = mm[:FBDS_HEADER_SIZE].view(np.uint32)
+        if header[1] != FBDS_VERSION:
+            print(f"Warning: {file_path} has unsupported version {header[1]}")
+            return
+        
+        info = {
+            'path': file_path,
+            'num_variables': int(header[4]),
+            'frame_width': int(header[6]),
+            'frame_height': int(header[7]),
+            'frame_bpp': int(header[8]),
+            'compression': int(header[9]),
+            'game_id': os.path.basename(file_path).split('_')[0],
+        }
+        file_index = len(self.files)
+        self.files.append(info)
+        
+        nvars = info['num_variables']
+        frame_bytes = info['frame_width'] * info['frame_height'] * info['frame_bpp']
+        pos = int(header[2])
+        
+        while pos + FBDS_BLOCK_HEADER_SIZE <= len(mm):
+            if bytes(mm[pos:pos + 4]) != FBDS_BLOCK_MAGIC:
+                print(f"Warning: bad block header in {file_path} at {pos:#x}")
+                break
+            
+            rows = int(mm[pos + 4:pos + 8].view(np.uint32)[0])
+            frame_size = int(mm[pos + 8:pos + 16].view(np.uint64)[0])
+            pos += FBDS_BLOCK_HEADER_SIZE
+            
+            sizes = [rows * 8, rows * 4, rows * 2, rows * nvars * 4, frame_size]
+            if pos + sum(_align8(n) for n in sizes) > len(mm):
+                print(f"Warning: truncated block in {file_path}, ignoring the rest")
+                break
+            
+            block = {'file': file_index, 'rows': rows}
+            block['frame'] = mm[pos:pos + sizes[0]].view(np.uint64)
+            pos += _align8(sizes[0])
+            block['reward'] = mm[pos:pos + sizes[1]].view(np.float32)
+            pos += _align8(sizes[1])
+            block['buttons'] = mm[pos:pos + sizes[2]].view(np.uint16)
+            pos += _align8(sizes[2])
+            block['variables'] = mm[pos:pos + sizes[3]].view(np.float32).reshape(rows, nvars)
+            pos += _align8(sizes[3])
+            block['frames'] = mm[pos:pos + frame_size] if frame_bytes else None
+            pos += _align8(sizes[4])
+            
+            self.block_starts.append(self.num_rows)
+            self.blocks.append(block)
+            self.num_rows += rows
+    
+    def __len__(self):
+        """Return the number of entries in the dataset"""
+        return self.num_rows
+    
+    def column(self, name):
+        """Return the per-block views of a column ('frame', 'reward', 'buttons' or 'variables')"""
+        return [block[name] for block in self.blocks]
+    
+    def _locate(self, idx):
+        if idx < 0:
+            idx += self.num_rows
+        if idx < 0 or idx >= self.num_rows:
+            raise IndexError(idx)
+        b = bisect.bisect_right(self.block_starts, idx) - 1
+        return b, idx - self.block_starts[b]
+    
+    def _block_frames(self, b):
+        """Return the (decompressed) frame column of block b"""
+        if self._frame_cache_block == b:
+            return self._frame_cache
+        
+        block = self.blocks[b]
+        info = self.files[block['file']]
+        data = block['frames']
+        if info['compression'] == FBDS_COMPRESSION_ZLIB:
+            data = np.frombuffer(zlib.decompress(data), dtype=np.uint8)
+        
+        self._frame_cache_block = b
+        self._frame_cache = data
+        return data
+    
+    def _extract_image(self, b, row):
+        block = self.blocks[b]
+        info = self.files[block['file']]
+        w, h, bpp = info['frame_width'], info['frame_height'], info['frame_bpp']
+        
+        if block['frames'] is None or bpp not in (1, 3, 4):
+            return torch.zeros((1, *self.image_size), dtype=torch.float32)
+        
+        frame_bytes = w * h * bpp
+        pixels = self._block_frames(b)[row * frame_bytes:(row + 1) * frame_bytes]
+        mode = {1: 'L', 3: 'RGB', 4: 'RGBA'}[bpp]
+        image = Image.frombuffer(mode, (w, h), pixels.tobytes(), 'raw', mode, 0, 1).convert('L')
+        image = image.resize(self.image_size[::-1])
+        
+        image_tensor = torch.FloatTensor(np.array(image)) / 255.0
+        return image_tensor.unsqueeze(0)
+    
+    def __getitem__(self, idx):
+        """Get a dataset item by index"""
+        b, row = self._locate(idx)
+        block = self.blocks[b]
+        
+        buttons = int(block['buttons'][row])
+        action = np.array([(buttons >> i) & 1 for i in range(len(ACTION_KEYS))], dtype=np.float32)
+        
+        result = {
+            'variables': torch.from_numpy(np.array(block['variables'][row])),
+            'action': torch.from_numpy(action),
+            'reward': float(block['reward'][row]),
+            'frame': int(block['frame'][row]),
+        }
+        
+        if self.include_screen:
+            result['image'] = self._extract_image(b, row)
+        
+        return result
+    
+    def get_dataloader(self, batch_size=32, shuffle=True, num_workers=4):
+        """Create a DataLoader for this dataset"""
+        return DataLoader(
+            self,
+            batch_size=batch_size,
+            shuffle=shuffle,
+            num_workers=num_workers,
+            pin_memory=True,
+        )
+    
+    def get_variable_dim(self):
+        """Get the dimension of the variable input"""
+        return self.files[0]['num_variables'] if self.files else 0
+    
+    def get_action_dim(self):
+        """Get the dimension of the action output"""
+        return len(ACTION_KEYS)
+
+def convert_jsonl_to_columnar(input_path, output_path, block_rows=4096, include_screen=True, compress=True):
+    """
+    Convert JSONL logs from AIDatasetLogger into a single FBDS columnar file
+    
+    Args:
+        input_path: Path to JSONL file or directory containing JSONL files
+        output_path: Path of the .fbds file to write
+        block_rows: Rows per block
+        include_screen: Whether to store embedded screen_data as the frame column
+        compress: Whether to zlib-compress the frame column
+    
+    Returns:
+        Number of rows written
+    """
+    if os.path.isdir(input_path):
+        files = sorted(glob.glob(os.path.join(input_path, "**/*.jsonl"), recursive=True))
+    else:
+        files = [input_path]
+    
+    def entries():
+        for file_path in files:
+            with open(file_path, 'r') as f:
+                for line in f:
+                    try:
+                        yield json.loads(line)
+                    except json.JSONDecodeError:
+                        print(f"Warning: Could not parse line in {file_path}")
+    
+    def decode_screen(entry):
+        import base64
+        import io
+        image = Image.open(io.BytesIO(base64.b64decode(entry['screen_data']))).convert('RGBA')
+        return image.size, image.tobytes()
+    
+    # First pass: fix the schema (widest variable row, size of the first embedded frame)
+    num_variables = 0
+    frame_size = None
+    for entry in entries():
+        num_variables = max(num_variables, len(entry.get('variables', [])))
+        if include_screen and frame_size is None and 'screen_data' in entry:
+            frame_size = decode_screen(entry)[0]
+    
+    width, height = frame_size if frame_size else (0, 0)
+    bpp = 4 if frame_size else 0
+    frame_bytes = width * height * bpp
+    compression = FBDS_COMPRESSION_ZLIB if (compress and frame_bytes) else FBDS_COMPRESSION_NONE
+    
+    def write_column(f, data):
+        f.write(data)
+        f.write(b'\0' * (_align8(len(data)) - len(data)))
+    
+    rows = 0
+    with open(output_path, 'wb') as f:
+        header = struct.pack('<4s9I', FBDS_MAGIC, FBDS_VERSION, FBDS_HEADER_SIZE, block_rows,
+                             num_variables, len(ACTION_KEYS), width, height, bpp, compression)
+        f.write(header.ljust(FBDS_HEADER_SIZE, b'\0'))
+        
+        block = []
+        
+        def flush_block():
+            n = len(block)
+            if n == 0:
+                return
+            frames = np.array([e[0] for e in block], dtype=np.uint64)
+            rewards = np.array([e[1] for e in block], dtype=np.float32)
+            buttons = np.array([e[2] for e in block], dtype=np.uint16)
+            variables = np.zeros((n, num_variables), dtype=np.float32)
+            for i, e in enumerate(block):
+                variables[i, :len(e[3])] = e[3]
+            pixels = b''.join(e[4] for e in block) if frame_bytes else b''
+            if compression == FBDS_COMPRESSION_ZLIB:
+                pixels = zlib.compress(pixels, 1)
+            
+            write_column(f, struct.pack('<4sIQ', FBDS_BLOCK_MAGIC, n, len(pixels)))
+            write_column(f, frames.tobytes())
+            write_column(f, rewards.tobytes())
+            write_column(f, buttons.tobytes())
+            write_column(f, variables.tobytes())
+            write_column(f, pixels)
+            block.clear()
+        
+        for entry in entries():
+            action = entry.get('action', {})
+            if isinstance(action, dict):
+                buttons = sum(1 << i for i, key in enumerate(ACTION_KEYS) if action.get(key))
+            else:
+                buttons = sum(1 << i for i, value in enumerate(action[:len(ACTION_KEYS)]) if value)
+            
+            pixels = b''
+            if frame_bytes:
+                pixels = bytes(frame_bytes)
+                if 'screen_data' in entry:
+                    size, data = decode_screen(entry)
+                    if size == frame_size:
+                        pixels = data
+            
+            block.append((entry.get('frame', rows), entry.get('reward', 0.0), buttons,
+                          entry.get('variables', []), pixels))
+            rows += 1
+            
+            if len(block) >= block_rows:
+                flush_block()
+        
+        flush_block()
+    
+    print(f"Converted {rows} entries from {len(files)} files to {output_path}")
+    return rows
+
 class ReplayDatasetWriter:
     """
     Utility class for writing processed dataset entries for training
@@ -471,17 +794,36 @@ def main():
     parser.add_argument('--height', type=int, default=96, help='Image height')
     parser.add_argument('--normalize', action='store_true', help='Normalize variables')
     parser.add_argument('--info', action='store_true', help='Print dataset info')
+    parser.add_argument('--convert', action='store_true', help='Convert JSONL logs to the FBDS columnar format')
+    parser.add_argument('--no-screen', action='store_true', help='Leave out the frame column when converting')
     
     args = parser.parse_args()
     
-    if args.info:
+    is_columnar = args.input.endswith('.fbds') or (
+        os.path.isdir(args.input) and glob.glob(os.path.join(args.input, "**/*.fbds"), recursive=True))
+    
+    if args.convert:
+        if not args.output:
+            print("Error: --output is required for conversion")
+            return 1
+        
+        convert_jsonl_to_columnar(args.input, args.output, include_screen=not args.no_screen)
+    
+    elif args.info:
         # Load and print dataset info
-        dataset = GameplayDataset(
-            args.input,
-            image_size=(args.height, args.width),
-            filter_game=args.game,
-            include_screen=False
-        )
+        if is_columnar:
+            dataset = ColumnarDataset(
+                args.input,
+                image_size=(args.height, args.width),
+                include_screen=False
+            )
+        else:
+            dataset = GameplayDataset(
+                args.input,
+                image_size=(args.height, args.width),
+                filter_game=args.game,
+                include_screen=False
+            )
         
         print(f"Dataset info:")
         print(f"  Entries: {len(dataset)}")
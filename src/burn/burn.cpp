@@ -10,6 +10,7 @@
 #include "dac.h"
 #include "burn_memory.h"
 #include "burn_sound.h"
+#include "burn_pal.h"
 #include "metal_fixes.h"
 
 #ifdef BUILD_A68K
@@ -782,6 +783,8 @@ extern "C" INT32 BurnDrvExit()
 	nBurnCPUSpeedAdjust = 0x0100;
 
 	pBurnDrvPalette = NULL;
+	BurnPalDeferWrites = 0;
+	BurnPaletteDirtyAll();
 
 	if (-1 != nBurnDrvSubActive) {
 		pszCustomNameA = szBackupNameA;
@@ -797,6 +800,8 @@ extern "C" INT32 BurnDrvExit()
 #endif
 	}
 
+	BurnAsyncExit();								// Nothing may still be running on the device thread
+
 	INT32 nRet = pDriver[nBurnDrvActive]->Exit();			// Forward to drivers function
 
 	nBurnDrvSubActive = -1;	// Rest to -1;
@@ -847,9 +852,13 @@ INT32 BurnDrvCartridgeSetup(BurnCartrigeCommand nCommand)
 // Do one frame of game emulation
 extern "C" INT32 BurnDrvFrame()
 {
+	BurnAsyncJoinFrame();							// Last frame's per-frame device jobs
 	CheatApply();									// Apply cheats (if any)
 	HiscoreApply();
-	return pDriver[nBurnDrvActive]->Frame();		// Forward to drivers function
+	INT32 nRet = pDriver[nBurnDrvActive]->Frame();	// Forward to drivers function
+	BurnAsyncFlush();								// Start this frame's device jobs
+
+	return nRet;
 }
 
 // Force redraw of the screen
@@ -1047,6 +1056,285 @@ void BurnDumpLoad_(char *filename, UINT8 *buffer, INT32 bufsize)
 }
 #endif
 
+// --------- State-ing for RunAhead ----------
+// for drivers, hiscore, etc, to recognize that this is the "runahead frame"
+INT32 bBurnRunAheadFrame = 0;
+
+INT32 nRunAheadFrames = 1;			// frames to run ahead, 1 - RUNAHEAD_MAX_FRAMES
+
+#if defined (INCLUDE_RUNAHEAD_SUPPORT)
+// The areas the driver scans are captured once into a copy table, areas which sit
+// back-to-back in memory are merged into one run, so the state is saved and loaded
+// with a flat memcpy() per run instead of a memcpy() per area from BurnAcb.
+//
+// The driver still gets one BurnAreaScan() per save / load, it packs variables before
+// a save and re-maps banks, etc. after a load - but the callback only checks the area
+// against the table.  Areas on the stack (SCAN_OFF() and friends) can't go in the
+// table, those are copied from the callback.  If the driver's list of areas changes,
+// the table is captured again; a load that finds it changed restores area by area.
+
+struct RunAheadArea { UINT8 *Data; UINT32 nLen; UINT32 nPos; INT32 bTemp; };
+struct RunAheadCopy { UINT8 *Data; UINT32 nLen; UINT32 nPos; };
+
+static RunAheadArea *RunAheadAreas = NULL;
+static RunAheadCopy *RunAheadCopies = NULL;
+static INT32 nRunAheadAreas = 0;
+static INT32 nRunAheadCopies = 0;
+static INT32 nRunAheadAreaMax = 0;
+static INT32 nRunAheadArea = 0;		// area index during a scan
+static UINT32 nRunAheadPos = 0;		// buffer position during an area by area load
+static INT32 bRunAheadStale = 0;		// area list doesn't match the table anymore
+static UINT32 nTotalLenRunAhead = 0;
+static UINT8 *RunAheadBuffer = NULL;
+static UINT8 *pRunAheadStackTop = NULL;
+
+static void StateRunAheadFree()
+{
+	if (RunAheadAreas) free(RunAheadAreas);
+	if (RunAheadCopies) free(RunAheadCopies);
+	if (RunAheadBuffer) free(RunAheadBuffer);
+
+	RunAheadAreas = NULL;
+	RunAheadCopies = NULL;
+	RunAheadBuffer = NULL;
+	nRunAheadAreas = 0;
+	nRunAheadCopies = 0;
+	nRunAheadAreaMax = 0;
+	nTotalLenRunAhead = 0;
+}
+
+void StateRunAheadInit()
+{
+	if (bRunAhead && (BurnDrvGetFlags() & BDF_RUNAHEAD_DRAWSYNC)) {
+		bprintf(PRINT_ERROR, _T(" ** RunAhead: Driver requests DRAW SYNC for this game.\n"));
+	}
+
+	if (bRunAhead && (BurnDrvGetFlags() & BDF_RUNAHEAD_DISABLED)) {
+		bprintf(PRINT_ERROR, _T(" ** RunAhead: Driver requests RunAhead DISABLED for this game.\n"));
+	}
+
+	StateRunAheadFree();
+
+	bBurnRunAheadFrame = 0;
+}
+
+void StateRunAheadExit()
+{
+	StateRunAheadFree();
+
+	bBurnRunAheadFrame = 0;
+}
+
+INT32 StateRunAheadFrames()
+{
+	if (nRunAheadFrames < 1) return 1;
+	if (nRunAheadFrames > RUNAHEAD_MAX_FRAMES) return RUNAHEAD_MAX_FRAMES;
+
+	return nRunAheadFrames;
+}
+
+static INT32 __cdecl RunAheadCaptureAcb(struct BurnArea* pba)
+{
+	UINT8 nStackBottom = 0;
+	UINT8 *pData = (UINT8*)pba->Data;
+
+	if (nRunAheadAreas == nRunAheadAreaMax) {
+		nRunAheadAreaMax = nRunAheadAreaMax ? nRunAheadAreaMax * 2 : 256;
+		RunAheadAreas = (RunAheadArea*)realloc(RunAheadAreas, nRunAheadAreaMax * sizeof(RunAheadArea));
+	}
+
+	RunAheadArea *pa = &RunAheadAreas[nRunAheadAreas++];
+
+	pa->Data = pData;
+	pa->nLen = pba->nLen;
+	pa->nPos = nTotalLenRunAhead;
+	// anything between this frame and StateRunAheadCapture()'s is a temporary in the driver's scan
+	pa->bTemp = (pData < pRunAheadStackTop && pData + pba->nLen > &nStackBottom) || (pData > pRunAheadStackTop && pData < &nStackBottom);
+
+	nTotalLenRunAhead += pba->nLen;
+
+	return 0;
+}
+
+static INT32 StateRunAheadCapture()
+{
+	UINT8 nStackTop = 0;
+
+	StateRunAheadFree();
+
+	pRunAheadStackTop = &nStackTop;
+	BurnAcb = RunAheadCaptureAcb;
+	BurnAreaScan(ACB_FULLSCAN | ACB_READ | ACB_RUNAHEAD, NULL);
+
+	RunAheadBuffer = (UINT8*)malloc(nTotalLenRunAhead ? nTotalLenRunAhead : 1);
+	RunAheadCopies = (RunAheadCopy*)malloc((nRunAheadAreas ? nRunAheadAreas : 1) * sizeof(RunAheadCopy));
+
+	if (RunAheadBuffer == NULL || RunAheadCopies == NULL || (nRunAheadAreas && RunAheadAreas == NULL)) {
+		bprintf(PRINT_ERROR, _T(" ** RunAhead: can't allocate state buffer ($%x bytes).\n"), nTotalLenRunAhead);
+		StateRunAheadFree();
+		return 1;
+	}
+
+	INT32 nTemps = 0;
+
+	for (INT32 i = 0; i < nRunAheadAreas; i++) {
+		RunAheadArea *pa = &RunAheadAreas[i];
+
+		if (pa->bTemp) {
+			nTemps++;
+			continue;
+		}
+
+		if (nRunAheadCopies) {
+			RunAheadCopy *pc = &RunAheadCopies[nRunAheadCopies - 1];
+
+			if (pc->Data + pc->nLen == pa->Data && pc->nPos + pc->nLen == pa->nPos) {
+				pc->nLen += pa->nLen;
+				continue;
+			}
+		}
+
+		RunAheadCopies[nRunAheadCopies].Data = pa->Data;
+		RunAheadCopies[nRunAheadCopies].nLen = pa->nLen;
+		RunAheadCopies[nRunAheadCopies].nPos = pa->nPos;
+		nRunAheadCopies++;
+	}
+
+	bprintf(0, _T(" ** RunAhead initted, state size $%x, %d areas in %d copies (%d on the stack).\n"), nTotalLenRunAhead, nRunAheadAreas, nRunAheadCopies, nTemps);
+
+	return 0;
+}
+
+static INT32 RunAheadCheckArea(struct BurnArea* pba)
+{
+	if (bRunAheadStale) return 1;
+
+	if (nRunAheadArea >= nRunAheadAreas) {
+		bRunAheadStale = 1;
+		return 1;
+	}
+
+	RunAheadArea *pa = &RunAheadAreas[nRunAheadArea];
+
+	if (pa->nLen != pba->nLen || (!pa->bTemp && pa->Data != (UINT8*)pba->Data)) {
+		bRunAheadStale = 1;
+		return 1;
+	}
+
+	return 0;
+}
+
+static INT32 __cdecl RunAheadReadAcb(struct BurnArea* pba)
+{
+	if (RunAheadCheckArea(pba)) return 1;
+
+	RunAheadArea *pa = &RunAheadAreas[nRunAheadArea++];
+
+	if (pa->bTemp) {
+		memcpy(RunAheadBuffer + pa->nPos, pba->Data, pba->nLen);
+	}
+
+	return 0;
+}
+
+static INT32 __cdecl RunAheadWriteAcb(struct BurnArea* pba)
+{
+	if (RunAheadCheckArea(pba)) return 1;
+
+	RunAheadArea *pa = &RunAheadAreas[nRunAheadArea++];
+
+	if (pa->bTemp) {
+		memcpy(pba->Data, RunAheadBuffer + pa->nPos, pba->nLen);
+	}
+
+	return 0;
+}
+
+static INT32 __cdecl RunAheadCheckAcb(struct BurnArea* pba)
+{
+	if (RunAheadCheckArea(pba)) return 1;
+
+	nRunAheadArea++;
+
+	return 0;
+}
+
+// Area by area, in scan order, like a normal state load
+static INT32 __cdecl RunAheadLoadAcb(struct BurnArea* pba)
+{
+	if (nRunAheadPos + pba->nLen > nTotalLenRunAhead) return 1;
+
+	memcpy(pba->Data, RunAheadBuffer + nRunAheadPos, pba->nLen);
+	nRunAheadPos += pba->nLen;
+
+	return 0;
+}
+
+// Does the table still match the areas the driver scans?  Nothing is copied
+static INT32 StateRunAheadCheck()
+{
+	nRunAheadArea = 0;
+	bRunAheadStale = 0;
+	BurnAcb = RunAheadCheckAcb;
+	BurnAreaScan(ACB_FULLSCAN | ACB_READ | ACB_RUNAHEAD, NULL);
+
+	return (bRunAheadStale || nRunAheadArea != nRunAheadAreas);
+}
+
+static INT32 StateRunAheadScan(INT32 nAction)
+{
+	nRunAheadArea = 0;
+	bRunAheadStale = 0;
+	BurnAcb = (nAction & ACB_WRITE) ? RunAheadWriteAcb : RunAheadReadAcb;
+	BurnAreaScan(ACB_FULLSCAN | nAction | ACB_RUNAHEAD, NULL);
+
+	return (bRunAheadStale || nRunAheadArea != nRunAheadAreas);
+}
+
+void StateRunAheadSave()
+{
+	// Capture on the first RunAhead frame instead of driver init, to ensure emulation is ready
+	if (RunAheadAreas == NULL && StateRunAheadCapture()) return;
+
+	if (StateRunAheadScan(ACB_READ)) {
+		bprintf(0, _T(" ** RunAhead: area list changed, capturing again.\n"));
+		if (StateRunAheadCapture() || StateRunAheadScan(ACB_READ)) {
+			StateRunAheadFree();
+			return;
+		}
+	}
+
+	for (INT32 i = 0; i < nRunAheadCopies; i++) {
+		memcpy(RunAheadBuffer + RunAheadCopies[i].nPos, RunAheadCopies[i].Data, RunAheadCopies[i].nLen);
+	}
+}
+
+void StateRunAheadLoad()
+{
+	if (RunAheadBuffer == NULL) return;
+
+	// the hidden frames may have moved or freed areas, check before copying anything
+	if (StateRunAheadCheck()) {
+		bprintf(0, _T(" ** RunAhead: area list changed during the hidden frames, loading area by area.\n"));
+		nRunAheadPos = 0;
+		BurnAcb = RunAheadLoadAcb;
+		BurnAreaScan(ACB_FULLSCAN | ACB_WRITE | ACB_RUNAHEAD, NULL);
+		StateRunAheadFree();		// captured again on the next save
+		return;
+	}
+
+	// restore before the driver's post-load
+	for (INT32 i = 0; i < nRunAheadCopies; i++) {
+		memcpy(RunAheadCopies[i].Data, RunAheadBuffer + RunAheadCopies[i].nPos, RunAheadCopies[i].nLen);
+	}
+
+	if (StateRunAheadScan(ACB_WRITE)) {
+		bprintf(0, _T(" ** RunAhead: area list changed while loading.\n"));
+		StateRunAheadFree();
+	}
+}
+#endif
+
 // ----------------------------------------------------------------------------
 // Wrapper for MAME state_save_register_* calls
 
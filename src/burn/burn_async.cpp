@@ -0,0 +1,127 @@
+// FB Neo per-frame device jobs, see burn_async.h
+
+#include "burnint.h"
+#include "burn_async.h"
+#include "thready.h"
+
+INT32 bBurnAsyncDevices = 0;
+
+struct AsyncJob {
+	void (*pJob)(void*);
+	void *pParam;
+	INT32 nJoin;
+	INT32 bKicked;
+};
+
+static AsyncJob AsyncJobs[BURN_ASYNC_MAX_JOBS];
+static INT32 nAsyncJobs = 0;
+static INT32 nAsyncRunning = 0;		// jobs handed to the thread, in AsyncRun[]
+static INT32 AsyncRun[BURN_ASYNC_MAX_JOBS];
+static INT32 bAsyncThread = 0;
+
+// on the thread - the kicked jobs run in the order they were kicked
+static void AsyncWorker()
+{
+	for (INT32 i = 0; i < nAsyncRunning; i++) {
+		AsyncJob *pj = &AsyncJobs[AsyncRun[i]];
+		pj->pJob(pj->pParam);
+	}
+}
+
+static void AsyncJoinAll()
+{
+	if (nAsyncRunning) {
+		thready.notify_wait();
+		nAsyncRunning = 0;
+	}
+}
+
+INT32 BurnAsyncRegister(void (*pJob)(void*), void *pParam, INT32 nJoin)
+{
+	if (!bBurnAsyncDevices || nAsyncJobs >= BURN_ASYNC_MAX_JOBS) {
+		return -1;
+	}
+
+	if (!bAsyncThread) {
+		thready.init(AsyncWorker);
+		bAsyncThread = 1;
+	}
+
+	AsyncJob *pj = &AsyncJobs[nAsyncJobs];
+	pj->pJob = pJob;
+	pj->pParam = pParam;
+	pj->nJoin = nJoin;
+	pj->bKicked = 0;
+
+	return nAsyncJobs++;
+}
+
+void BurnAsyncKick(INT32 nJob)
+{
+	if (nJob < 0 || nJob >= nAsyncJobs) return;
+
+	// the device didn't join its last run before kicking again
+	if (nAsyncRunning) {
+		AsyncJoinAll();
+	}
+
+	AsyncJobs[nJob].bKicked = 1;
+}
+
+void BurnAsyncJoin(INT32 nJob)
+{
+	if (nJob < 0 || nJob >= nAsyncJobs) return;
+
+	// one thread runs all the jobs, so joining one joins them all
+	if (nAsyncRunning) {
+		AsyncJoinAll();
+	}
+
+	// kicked but never started (the frame didn't return through BurnDrvFrame)
+	if (AsyncJobs[nJob].bKicked) {
+		AsyncJobs[nJob].bKicked = 0;
+		AsyncJobs[nJob].pJob(AsyncJobs[nJob].pParam);
+	}
+}
+
+void BurnAsyncJoinFrame()
+{
+	if (nAsyncRunning == 0) return;
+
+	for (INT32 i = 0; i < nAsyncRunning; i++) {
+		if (AsyncJobs[AsyncRun[i]].nJoin == BURN_ASYNC_JOIN_FRAME) {
+			AsyncJoinAll();
+			return;
+		}
+	}
+}
+
+void BurnAsyncFlush()
+{
+	if (nAsyncJobs == 0) return;
+
+	AsyncJoinAll();
+
+	for (INT32 i = 0; i < nAsyncJobs; i++) {
+		if (AsyncJobs[i].bKicked) {
+			AsyncJobs[i].bKicked = 0;
+			AsyncRun[nAsyncRunning++] = i;
+		}
+	}
+
+	if (nAsyncRunning) {
+		thready.notify();		// runs them right here if the thread isn't available
+	}
+}
+
+void BurnAsyncExit()
+{
+	AsyncJoinAll();
+
+	if (bAsyncThread) {
+		thready.exit();
+		bAsyncThread = 0;
+	}
+
+	nAsyncJobs = 0;
+}
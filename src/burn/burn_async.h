@@ -0,0 +1,35 @@
+#ifndef _BURN_ASYNC_H
+#define _BURN_ASYNC_H
+
+// Per-frame device jobs on a helper thread (see devices/thready.h)
+//
+// A device which can finish its frame's work later (sound rendering etc.) registers
+// a job and kicks it at the end of its frame, the result is used one frame later.
+// Kicked jobs start once the driver's frame returns and run while the frontend
+// presents the frame.  The job has to be joined before anything touches the
+// device's state again:
+//  BURN_ASYNC_JOIN_FRAME  - joined before the next BurnDrvFrame()
+//  BURN_ASYNC_JOIN_ACCESS - the device calls BurnAsyncJoin() itself before its state
+//                           is touched (reads, writes, scan, reset, new frame), so the
+//                           job can also overlap the next frame's cpu emulation.
+// Jobs only ever run between those points, so the results don't depend on threading.
+
+#define BURN_ASYNC_JOIN_FRAME	0
+#define BURN_ASYNC_JOIN_ACCESS	1
+
+#define BURN_ASYNC_MAX_JOBS		8
+
+// non-zero = devices that support it render through a job (set before driver init)
+extern INT32 bBurnAsyncDevices;
+
+// returns the job, or -1 if the device should do the work itself
+INT32 BurnAsyncRegister(void (*pJob)(void*), void *pParam, INT32 nJoin);
+void BurnAsyncKick(INT32 nJob);
+void BurnAsyncJoin(INT32 nJob);
+
+// burn.cpp
+void BurnAsyncJoinFrame();		// before the driver's frame
+void BurnAsyncFlush();			// after the driver's frame, starts the kicked jobs
+void BurnAsyncExit();			// joins everything and forgets the jobs
+
+#endif // _BURN_ASYNC_H
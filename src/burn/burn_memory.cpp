@@ -80,6 +80,11 @@ void _BurnFree(void* ptr)
 	if (!ptr) {
 		return;
 	}
+
+	// regions mapped from the rom cache or shared memory aren't ours to free()
+	if (BurnRomCacheUnmap(ptr) == 0 || BurnShareUnmap(ptr) == 0) {
+		return;
+	}
 	
 	free(ptr);
 	
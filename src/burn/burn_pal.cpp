@@ -1,306 +1,472 @@
 #include "burnint.h"
 #include "burn_pal.h"
+#include "burn_simd.h"
 
 UINT32 *BurnPalette = NULL;
 UINT8 *BurnPalRAM = NULL;
 UINT8 BurnRecalc;
+UINT8 BurnPalDeferWrites = 0;
+
+/*================================================================================================
+Palette Formats
+
+Every format is described by a PalFormat: per channel (r, g, b) the number of bits, the shift of
+the channel in the palette entry and, for the RGBx formats, the shift of a shared low bit. The
+update functions convert a range of entries with PaletteConvert(), which uses SSE2/NEON kernels
+when BurnHighCol is one of the plain 15/16/24-bit formats, and BurnHighCol per entry otherwise.
+================================================================================================*/
+
+struct PalFormat {
+	INT32 nBits[3];
+	INT32 nShift[3];
+	INT32 nLowShift[3];						// -1 = no shared low bit
+	INT32 nWide;							// 16-bit entries (else 8-bit)
+	INT32 nInvert;							// xor'ed with each entry
+};
+
+static const PalFormat fmt_xxxxBBBBGGGGRRRR = { { 4, 4, 4 }, {  0,  4,  8 }, { -1, -1, -1 }, 1, 0 };
+static const PalFormat fmt_xxxxBBBBRRRRGGGG = { { 4, 4, 4 }, {  4,  0,  8 }, { -1, -1, -1 }, 1, 0 };
+static const PalFormat fmt_xxxxRRRRGGGGBBBB = { { 4, 4, 4 }, {  8,  4,  0 }, { -1, -1, -1 }, 1, 0 };
+static const PalFormat fmt_xRRRRRGGGGGBBBBB = { { 5, 5, 5 }, { 10,  5,  0 }, { -1, -1, -1 }, 1, 0 };
+static const PalFormat fmt_xBBBBBGGGGGRRRRR = { { 5, 5, 5 }, {  0,  5, 10 }, { -1, -1, -1 }, 1, 0 };
+static const PalFormat fmt_xGGGGGBBBBBRRRRR = { { 5, 5, 5 }, {  0, 10,  5 }, { -1, -1, -1 }, 1, 0 };
+static const PalFormat fmt_xGGGGGRRRRRBBBBB = { { 5, 5, 5 }, {  5, 10,  0 }, { -1, -1, -1 }, 1, 0 };
+static const PalFormat fmt_GGGGGRRRRRBBBBBx = { { 5, 5, 5 }, {  6, 11,  1 }, { -1, -1, -1 }, 1, 0 };
+static const PalFormat fmt_RRRRGGGGBBBBRGBx = { { 5, 5, 5 }, { 12,  8,  4 }, {  3,  2,  1 }, 1, 0 };
+static const PalFormat fmt_BBGGGRRR         = { { 3, 3, 2 }, {  0,  3,  6 }, { -1, -1, -1 }, 0, 0 };
+static const PalFormat fmt_RRRGGGBB         = { { 3, 3, 2 }, {  5,  2,  0 }, { -1, -1, -1 }, 0, 0 };
+static const PalFormat fmt_BBGGGRRR_inv     = { { 3, 3, 2 }, {  0,  3,  6 }, { -1, -1, -1 }, 0, 0xff };
+static const PalFormat fmt_RRRGGGBB_inv     = { { 3, 3, 2 }, {  5,  2,  0 }, { -1, -1, -1 }, 0, 0xff };
+
+// Entries written since the last update (with BurnPalDeferWrites), nDirtyEnd is exclusive
+static INT32 nDirtyStart = 0;
+static INT32 nDirtyEnd = 0x7fffffff;
+
+// Channel value of entry p, expanded to 8 bits by repeating its bits (pal5bit() etc.)
+static inline UINT32 PaletteChannel(UINT32 p, INT32 nBits, INT32 nShift, INT32 nLowShift)
+{
+	UINT32 c;
+
+	if (nLowShift < 0) {
+		c = (p >> nShift) & ((1 << nBits) - 1);
+	} else {
+		c = (((p >> nShift) & ((1 << (nBits - 1)) - 1)) << 1) | ((p >> nLowShift) & 1);
+	}
 
-//-------------------------------------------------------------------------------------
+	UINT32 v = 0;
+	for (INT32 s = 8 - nBits; s > -nBits; s -= nBits) {
+		v |= (s >= 0) ? (c << s) : (c >> -s);
+	}
+
+	return v;
+}
 
-static inline UINT32 PaletteWrite4Bit(INT32 offset, INT32 rshift, INT32 gshift, INT32 bshift)
+static inline UINT32 PaletteEntry(const PalFormat *f, INT32 i)
 {
-	if (BurnPalRAM == NULL) return 0;
+	UINT32 p = f->nWide ? BURN_ENDIAN_SWAP_INT16(((UINT16*)BurnPalRAM)[i]) : BurnPalRAM[i];
+	p ^= f->nInvert;
+
+	UINT32 r = PaletteChannel(p, f->nBits[0], f->nShift[0], f->nLowShift[0]);
+	UINT32 g = PaletteChannel(p, f->nBits[1], f->nShift[1], f->nLowShift[1]);
+	UINT32 b = PaletteChannel(p, f->nBits[2], f->nShift[2], f->nLowShift[2]);
+
+	return BurnHighCol(r, g, b, 0);
+}
+
+/*================================================================================================
+Batch Kernels
+
+BurnHighCol is probed once per change and, if it matches one of the plain formats below, the
+kernels pack the colours themselves. Gamma-corrected or otherwise custom BurnHighCol functions
+keep going through BurnHighCol for every entry.
+================================================================================================*/
+
+#define PAL_PACK_HIGHCOL	0					// call BurnHighCol for every entry
+#define PAL_PACK_15			1					// 0RRRRRGGGGGBBBBB
+#define PAL_PACK_16			2					// RRRRRGGGGGGBBBBB
+#define PAL_PACK_24			3					// 00000000RRRRRRRRGGGGGGGGBBBBBBBB
 
-	UINT16 *pal = (UINT16*)BurnPalRAM;
-	UINT16 p = BURN_ENDIAN_SWAP_INT16(pal[offset]);
+// the kernels read the palette ram as little endian words
+#if defined (LSB_FIRST) && defined (BURN_SSE2)
+ #define PAL_SSE2
+#elif defined (LSB_FIRST) && defined (BURN_NEON)
+ #define PAL_NEON
+#endif
 
-	UINT8 r = (p >> rshift) & 0xf;
-	UINT8 g = (p >> gshift) & 0xf;
-	UINT8 b = (p >> bshift) & 0xf;
+static UINT32 PalettePack(INT32 nMode, UINT32 r, UINT32 g, UINT32 b)
+{
+	switch (nMode) {
+		case PAL_PACK_15: return ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+		case PAL_PACK_16: return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+		case PAL_PACK_24: return (r << 16) | (g << 8) | b;
+	}
 
-	return BurnHighCol(r+(r*16), g+(g*16), b+(b*16), 0);
+	return 0;
 }
 
-static inline void PaletteUpdate4Bit(INT32 rshift, INT32 gshift, INT32 bshift)
+static INT32 PalettePackMode()
 {
-	if (BurnPalette == NULL) return;
+	static UINT32 (__cdecl *pProbed)(INT32, INT32, INT32, INT32) = NULL;
+	static INT32 nProbedMode = PAL_PACK_HIGHCOL;
+
+	if (BurnHighCol == pProbed) return nProbedMode;
 
-	for (INT32 i = 0; i < BurnDrvGetPaletteEntries(); i++)
-	{
-		BurnPalette[i] = PaletteWrite4Bit(i, rshift, gshift,  bshift);
+	pProbed = BurnHighCol;
+	nProbedMode = PAL_PACK_HIGHCOL;
+
+	for (INT32 nMode = PAL_PACK_15; nMode <= PAL_PACK_24; nMode++) {
+		bool bMatch = true;
+
+		for (INT32 v = 0; v < 0x100 && bMatch; v++) {
+			INT32 w = v ^ 0xa5;
+			bMatch = BurnHighCol(v, 0, 0, 0) == PalettePack(nMode, v, 0, 0) &&
+					 BurnHighCol(0, v, 0, 0) == PalettePack(nMode, 0, v, 0) &&
+					 BurnHighCol(0, 0, v, 0) == PalettePack(nMode, 0, 0, v) &&
+					 BurnHighCol(v, w, 0xff - v, 0) == PalettePack(nMode, v, w, 0xff - v);
+		}
+
+		if (bMatch) {
+			nProbedMode = nMode;
+			break;
+		}
 	}
+
+	return nProbedMode;
 }
 
-void BurnPaletteUpdate_xxxxBBBBGGGGRRRR()
+#if defined (PAL_SSE2)
+
+static inline __m128i PaletteChannel_SSE2(__m128i p, INT32 nBits, INT32 nShift, INT32 nLowShift)
 {
-	PaletteUpdate4Bit(0, 4, 8);
+	__m128i c;
+
+	if (nLowShift < 0) {
+		c = _mm_and_si128(_mm_srl_epi16(p, _mm_cvtsi32_si128(nShift)), _mm_set1_epi16((1 << nBits) - 1));
+	} else {
+		c = _mm_slli_epi16(_mm_and_si128(_mm_srl_epi16(p, _mm_cvtsi32_si128(nShift)), _mm_set1_epi16((1 << (nBits - 1)) - 1)), 1);
+		c = _mm_or_si128(c, _mm_and_si128(_mm_srl_epi16(p, _mm_cvtsi32_si128(nLowShift)), _mm_set1_epi16(1)));
+	}
+
+	__m128i v = _mm_setzero_si128();
+	for (INT32 s = 8 - nBits; s > -nBits; s -= nBits) {
+		v = _mm_or_si128(v, (s >= 0) ? _mm_sll_epi16(c, _mm_cvtsi32_si128(s)) : _mm_srl_epi16(c, _mm_cvtsi32_si128(-s)));
+	}
+
+	return v;
+}
+
+// Converts 8 entries at a time, returns the number of entries converted
+static INT32 PaletteConvert_SSE2(const PalFormat *f, INT32 nStart, INT32 nEnd, INT32 nMode)
+{
+	const __m128i invert = _mm_set1_epi16(f->nInvert);
+	const __m128i zero = _mm_setzero_si128();
+	INT32 i = nStart;
+
+	for (; i + 8 <= nEnd; i += 8) {
+		__m128i p;
+		if (f->nWide) {
+			p = _mm_loadu_si128((const __m128i*)((UINT16*)BurnPalRAM + i));
+		} else {
+			p = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(BurnPalRAM + i)), zero);
+		}
+		p = _mm_xor_si128(p, invert);
+
+		__m128i r = PaletteChannel_SSE2(p, f->nBits[0], f->nShift[0], f->nLowShift[0]);
+		__m128i g = PaletteChannel_SSE2(p, f->nBits[1], f->nShift[1], f->nLowShift[1]);
+		__m128i b = PaletteChannel_SSE2(p, f->nBits[2], f->nShift[2], f->nLowShift[2]);
+
+		__m128i lo, hi;
+		if (nMode == PAL_PACK_24) {
+			lo = _mm_or_si128(_mm_slli_epi16(g, 8), b);
+			hi = r;
+		} else {
+			if (nMode == PAL_PACK_15) {
+				lo = _mm_or_si128(_mm_slli_epi16(_mm_srli_epi16(r, 3), 10), _mm_slli_epi16(_mm_srli_epi16(g, 3), 5));
+			} else {
+				lo = _mm_or_si128(_mm_slli_epi16(_mm_srli_epi16(r, 3), 11), _mm_slli_epi16(_mm_srli_epi16(g, 2), 5));
+			}
+			lo = _mm_or_si128(lo, _mm_srli_epi16(b, 3));
+			hi = zero;
+		}
+
+		_mm_storeu_si128((__m128i*)(BurnPalette + i + 0), _mm_unpacklo_epi16(lo, hi));
+		_mm_storeu_si128((__m128i*)(BurnPalette + i + 4), _mm_unpackhi_epi16(lo, hi));
+	}
+
+	return i - nStart;
 }
 
-void BurnPaletteUpdate_xxxxBBBBRRRRGGGG()
+#endif
+
+#if defined (PAL_NEON)
+
+static inline uint16x8_t PaletteChannel_NEON(uint16x8_t p, INT32 nBits, INT32 nShift, INT32 nLowShift)
 {
-	PaletteUpdate4Bit(4, 0, 8);
+	uint16x8_t c;
+
+	if (nLowShift < 0) {
+		c = vandq_u16(vshlq_u16(p, vdupq_n_s16(-nShift)), vdupq_n_u16((1 << nBits) - 1));
+	} else {
+		c = vshlq_n_u16(vandq_u16(vshlq_u16(p, vdupq_n_s16(-nShift)), vdupq_n_u16((1 << (nBits - 1)) - 1)), 1);
+		c = vorrq_u16(c, vandq_u16(vshlq_u16(p, vdupq_n_s16(-nLowShift)), vdupq_n_u16(1)));
+	}
+
+	uint16x8_t v = vdupq_n_u16(0);
+	for (INT32 s = 8 - nBits; s > -nBits; s -= nBits) {
+		v = vorrq_u16(v, vshlq_u16(c, vdupq_n_s16(s)));
+	}
+
+	return v;
+}
+
+// Converts 8 entries at a time, returns the number of entries converted
+static INT32 PaletteConvert_NEON(const PalFormat *f, INT32 nStart, INT32 nEnd, INT32 nMode)
+{
+	const uint16x8_t invert = vdupq_n_u16(f->nInvert);
+	INT32 i = nStart;
+
+	for (; i + 8 <= nEnd; i += 8) {
+		uint16x8_t p;
+		if (f->nWide) {
+			p = vld1q_u16((UINT16*)BurnPalRAM + i);
+		} else {
+			p = vmovl_u8(vld1_u8(BurnPalRAM + i));
+		}
+		p = veorq_u16(p, invert);
+
+		uint16x8_t r = PaletteChannel_NEON(p, f->nBits[0], f->nShift[0], f->nLowShift[0]);
+		uint16x8_t g = PaletteChannel_NEON(p, f->nBits[1], f->nShift[1], f->nLowShift[1]);
+		uint16x8_t b = PaletteChannel_NEON(p, f->nBits[2], f->nShift[2], f->nLowShift[2]);
+
+		uint16x8_t lo, hi;
+		if (nMode == PAL_PACK_24) {
+			lo = vorrq_u16(vshlq_n_u16(g, 8), b);
+			hi = r;
+		} else {
+			if (nMode == PAL_PACK_15) {
+				lo = vorrq_u16(vshlq_n_u16(vshrq_n_u16(r, 3), 10), vshlq_n_u16(vshrq_n_u16(g, 3), 5));
+			} else {
+				lo = vorrq_u16(vshlq_n_u16(vshrq_n_u16(r, 3), 11), vshlq_n_u16(vshrq_n_u16(g, 2), 5));
+			}
+			lo = vorrq_u16(lo, vshrq_n_u16(b, 3));
+			hi = vdupq_n_u16(0);
+		}
+
+		uint16x8x2_t z = vzipq_u16(lo, hi);
+		vst1q_u32(BurnPalette + i + 0, vreinterpretq_u32_u16(z.val[0]));
+		vst1q_u32(BurnPalette + i + 4, vreinterpretq_u32_u16(z.val[1]));
+	}
+
+	return i - nStart;
 }
 
-void BurnPaletteUpdate_xxxxRRRRGGGGBBBB()
+#endif
+
+static void PaletteConvert(const PalFormat *f, INT32 nStart, INT32 nEnd)
 {
-	PaletteUpdate4Bit(8, 4, 0);
+	INT32 nMode = PalettePackMode();
+
+	if (nMode != PAL_PACK_HIGHCOL) {
+#if defined (PAL_SSE2)
+		nStart += PaletteConvert_SSE2(f, nStart, nEnd, nMode);
+#elif defined (PAL_NEON)
+		nStart += PaletteConvert_NEON(f, nStart, nEnd, nMode);
+#endif
+	}
+
+	for (INT32 i = nStart; i < nEnd; i++) {
+		BurnPalette[i] = PaletteEntry(f, i);
+	}
 }
 
-void BurnPaletteWrite_xxxxBBBBGGGGRRRR(INT32 offset)
-{
-	offset /= 2;
+/*================================================================================================
+Update / Write
 
-	BurnPalette[offset] = PaletteWrite4Bit(offset, 0, 4, 8);
+With BurnPalDeferWrites clear, the write functions convert their entry straight away and the
+update functions convert the whole palette, as before. With it set, the write functions only
+extend the dirty range and the update functions convert just that range, unless BurnRecalc is
+set or BurnHighCol changed since the last update.
+================================================================================================*/
+
+void BurnPaletteDirtyAll()
+{
+	nDirtyStart = 0;
+	nDirtyEnd = 0x7fffffff;
 }
 
-void BurnPaletteWrite_xxxxBBBBRRRRGGGG(INT32 offset)
+static void PaletteUpdate(const PalFormat *f)
 {
-	offset /= 2;
+	static UINT32 (__cdecl *pLastHighCol)(INT32, INT32, INT32, INT32) = NULL;
+
+	if (BurnPalRAM == NULL || BurnPalette == NULL) return;
+
+	INT32 nEntries = BurnDrvGetPaletteEntries();
+	INT32 nStart = 0;
+	INT32 nEnd = nEntries;
 
-	BurnPalette[offset] = PaletteWrite4Bit(offset, 4, 0, 8);
+	if (BurnPalDeferWrites && !BurnRecalc && BurnHighCol == pLastHighCol) {
+		nStart = nDirtyStart;
+		nEnd = (nDirtyEnd < nEntries) ? nDirtyEnd : nEntries;
+	}
+
+	if (nStart < nEnd) {
+		PaletteConvert(f, nStart, nEnd);
+	}
+
+	pLastHighCol = BurnHighCol;
+	nDirtyStart = 0x7fffffff;
+	nDirtyEnd = 0;
 }
 
-void BurnPaletteWrite_xxxxRRRRGGGGBBBB(INT32 offset)
+static inline void PaletteWrite(const PalFormat *f, INT32 offset)
 {
-	offset /= 2;
+	if (BurnPalRAM == NULL || BurnPalette == NULL) return;
 
-	BurnPalette[offset] = PaletteWrite4Bit(offset, 8, 4, 0);
+	if (BurnPalDeferWrites) {
+		if (offset < nDirtyStart) nDirtyStart = offset;
+		if (offset >= nDirtyEnd) nDirtyEnd = offset + 1;
+		return;
+	}
+
+	BurnPalette[offset] = PaletteEntry(f, offset);
 }
 
 //-------------------------------------------------------------------------------------
 
-static inline UINT32 PaletteWrite5Bit(INT32 offset, INT32 rshift, INT32 gshift, INT32 bshift)
+void BurnPaletteUpdate_xxxxBBBBGGGGRRRR()
 {
-	if (BurnPalRAM == NULL) return 0;
-
-	UINT16 *pal = (UINT16*)BurnPalRAM;
-	UINT16 p = BURN_ENDIAN_SWAP_INT16(pal[offset]);
+	PaletteUpdate(&fmt_xxxxBBBBGGGGRRRR);
+}
 
-	UINT8 r = (p >> rshift) & 0x1f;
-	UINT8 g = (p >> gshift) & 0x1f;
-	UINT8 b = (p >> bshift) & 0x1f;
+void BurnPaletteUpdate_xxxxBBBBRRRRGGGG()
+{
+	PaletteUpdate(&fmt_xxxxBBBBRRRRGGGG);
+}
 
-	r = (r * 8) + (r / 4);
-	g = (g * 8) + (g / 4);
-	b = (b * 8) + (b / 4);
+void BurnPaletteUpdate_xxxxRRRRGGGGBBBB()
+{
+	PaletteUpdate(&fmt_xxxxRRRRGGGGBBBB);
+}
 
-	return BurnHighCol(r, g, b, 0);
+void BurnPaletteWrite_xxxxBBBBGGGGRRRR(INT32 offset)
+{
+	PaletteWrite(&fmt_xxxxBBBBGGGGRRRR, offset / 2);
 }
 
-static inline void PaletteUpdate5Bit(INT32 rshift, INT32 gshift, INT32 bshift)
+void BurnPaletteWrite_xxxxBBBBRRRRGGGG(INT32 offset)
 {
-	if (BurnPalette == NULL) return;
+	PaletteWrite(&fmt_xxxxBBBBRRRRGGGG, offset / 2);
+}
 
-	for (INT32 i = 0; i < BurnDrvGetPaletteEntries(); i++)
-	{
-		BurnPalette[i] = PaletteWrite5Bit(i, rshift, gshift,  bshift);
-	}
+void BurnPaletteWrite_xxxxRRRRGGGGBBBB(INT32 offset)
+{
+	PaletteWrite(&fmt_xxxxRRRRGGGGBBBB, offset / 2);
 }
 
+//-------------------------------------------------------------------------------------
+
 void BurnPaletteUpdate_xRRRRRGGGGGBBBBB()
 {
-	PaletteUpdate5Bit(10, 5, 0);
+	PaletteUpdate(&fmt_xRRRRRGGGGGBBBBB);
 }
 
 void BurnPaletteUpdate_xBBBBBGGGGGRRRRR()
 {
-	PaletteUpdate5Bit(0, 5, 10);
+	PaletteUpdate(&fmt_xBBBBBGGGGGRRRRR);
 }
 
 void BurnPaletteUpdate_xGGGGGBBBBBRRRRR()
 {
-	PaletteUpdate5Bit(0, 10, 5);
+	PaletteUpdate(&fmt_xGGGGGBBBBBRRRRR);
 }
 
 void BurnPaletteUpdate_xGGGGGRRRRRBBBBB()
 {
-	PaletteUpdate5Bit(5, 10, 0);
+	PaletteUpdate(&fmt_xGGGGGRRRRRBBBBB);
 }
 
 void BurnPaletteUpdate_GGGGGRRRRRBBBBBx()
 {
-	PaletteUpdate5Bit(6, 11, 1);
+	PaletteUpdate(&fmt_GGGGGRRRRRBBBBBx);
 }
 
 void BurnPaletteWrite_xRRRRRGGGGGBBBBB(INT32 offset)
 {
-	offset /= 2;
-
-	if (BurnPalette) {
-		BurnPalette[offset] = PaletteWrite5Bit(offset, 10, 5, 0);
-	}
+	PaletteWrite(&fmt_xRRRRRGGGGGBBBBB, offset / 2);
 }
 
 void BurnPaletteWrite_xBBBBBGGGGGRRRRR(INT32 offset)
 {
-	offset /= 2;
-
-	if (BurnPalette) {
-		BurnPalette[offset] = PaletteWrite5Bit(offset, 0, 5, 10);
-	}
+	PaletteWrite(&fmt_xBBBBBGGGGGRRRRR, offset / 2);
 }
 
 void BurnPaletteWrite_xGGGGGBBBBBRRRRR(INT32 offset)
 {
-	offset /= 2;
-
-	if (BurnPalette) {
-		BurnPalette[offset] = PaletteWrite5Bit(offset, 0, 10, 5);
-	}
+	PaletteWrite(&fmt_xGGGGGBBBBBRRRRR, offset / 2);
 }
 
 void BurnPaletteWrite_xGGGGGRRRRRBBBBB(INT32 offset)
 {
-	offset /= 2;
-
-	if (BurnPalette) {
-		BurnPalette[offset] = PaletteWrite5Bit(offset, 5, 10, 0);
-	}
+	PaletteWrite(&fmt_xGGGGGRRRRRBBBBB, offset / 2);
 }
 
 void BurnPaletteWrite_GGGGGRRRRRBBBBBx(INT32 offset)
 {
-	offset /= 2;
-
-	if (BurnPalette) {
-		BurnPalette[offset] = PaletteWrite5Bit(offset, 6, 11, 1);
-	}
+	PaletteWrite(&fmt_GGGGGRRRRRBBBBBx, offset / 2);
 }
 
 //-------------------------------------------------------------------------------------
 
 void BurnPaletteUpdate_RRRRGGGGBBBBRGBx()
 {
-	if (BurnPalRAM == NULL || BurnPalette == NULL) return;
-
-	UINT16 *pal = (UINT16*)BurnPalRAM;
-
-	for (INT32 i = 0; i < BurnDrvGetPaletteEntries(); i++)
-	{
-		UINT16 p = BURN_ENDIAN_SWAP_INT16(pal[i]);
-
-		UINT8 r = ((p >>  11) & 0x1e) | ((p >> 3) & 0x01);
-		UINT8 g = ((p >>   7) & 0x1e) | ((p >> 2) & 0x01);
-		UINT8 b = ((p >>   3) & 0x1e) | ((p >> 1) & 0x01);
-
-		r = (r * 8) + (r / 4);
-		g = (g * 8) + (g / 4);
-		b = (b * 8) + (b / 4);
-
-		BurnPalette[i] = BurnHighCol(r, g, b, 0);
-	}	
+	PaletteUpdate(&fmt_RRRRGGGGBBBBRGBx);
 }
 
 void BurnPaletteWrite_RRRRGGGGBBBBRGBx(INT32 offset)
 {
-	if (BurnPalRAM == NULL || BurnPalette == NULL) return;
-
-	offset /= 2;
-
-	UINT16 *pal = (UINT16*)BurnPalRAM;
-	UINT16 p = BURN_ENDIAN_SWAP_INT16(pal[offset]);
-
-	UINT8 r = ((p >>  11) & 0x1e) | ((p >> 3) & 0x01);
-	UINT8 g = ((p >>   7) & 0x1e) | ((p >> 2) & 0x01);
-	UINT8 b = ((p >>   3) & 0x1e) | ((p >> 1) & 0x01);
-
-	r = (r * 8) + (r / 4);
-	g = (g * 8) + (g / 4);
-	b = (b * 8) + (b / 4);
-
-	BurnPalette[offset] = BurnHighCol(r, g, b, 0);
+	PaletteWrite(&fmt_RRRRGGGGBBBBRGBx, offset / 2);
 }
 
 //-------------------------------------------------------------------------------------
 
-static inline void palette_update_8bit(INT32 r_mask, INT32 g_mask, INT32 b_mask, INT32 r_shift, INT32 g_shift, INT32 b_shift, INT32 invert)
-{
-	if (BurnPalRAM == NULL || BurnPalette == NULL) return;
-
-	r_mask = (1 << r_mask) - 1;
-	g_mask = (1 << g_mask) - 1;
-	b_mask = (1 << b_mask) - 1;
-	invert = (invert) ? 0xff : 0;
-
-	for (INT32 i = 0; i < BurnDrvGetPaletteEntries(); i++)
-	{
-		UINT8 p = BurnPalRAM[i] ^ invert;
-		UINT8 r = (p >> r_shift) & r_mask;
-		UINT8 g = (p >> g_shift) & g_mask;
-		UINT8 b = (p >> b_shift) & b_mask;
-
-		if (r_mask == 3) r = pal2bit(r);
-		if (r_mask == 7) r = pal3bit(r);
-
-		if (g_mask == 3) g = pal2bit(r);
-		if (g_mask == 7) g = pal3bit(r);
-
-		if (b_mask == 3) b = pal2bit(r);
-		if (b_mask == 7) b = pal3bit(r);
-
-		BurnPalette[i] = BurnHighCol(r,g,b,0);
-	}
-}
-
 void BurnPaletteUpdate_BBGGGRRR()
 {
-	palette_update_8bit(3, 3, 2, 0, 3, 6, 0);
+	PaletteUpdate(&fmt_BBGGGRRR);
 }
 
 void BurnPaletteUpdate_RRRGGGBB()
 {
-	palette_update_8bit(3, 3, 2, 5, 2, 0, 0);
+	PaletteUpdate(&fmt_RRRGGGBB);
 }
 
 void BurnPaletteUpdate_BBGGGRRR_inverted()
 {
-	palette_update_8bit(3, 3, 2, 0, 3, 6, 1);
+	PaletteUpdate(&fmt_BBGGGRRR_inv);
 }
 
 void BurnPaletteUpdate_RRRGGGBB_inverted()
 {
-	palette_update_8bit(3, 3, 2, 5, 2, 0, 1);
-}
-
-static inline void palette_write_8bit(INT32 offset, INT32 r_shift, INT32 g_shift, INT32 b_shift, INT32 r_mask, INT32 g_mask, INT32 b_mask, INT32 invert)
-{
-	if (BurnPalRAM == NULL || BurnPalette == NULL) return;
-
-	UINT8 p = BurnPalRAM[offset] ^ invert;
-	UINT8 r = (p >> r_shift) & r_mask;
-	UINT8 g = (p >> g_shift) & g_mask;
-	UINT8 b = (p >> b_shift) & b_mask;
-
-	if (r_mask == 3) r = pal2bit(r);
-	if (r_mask == 7) r = pal3bit(r);
-
-	if (g_mask == 3) g = pal2bit(r);
-	if (g_mask == 7) g = pal3bit(r);
-
-	if (b_mask == 3) b = pal2bit(r);
-	if (b_mask == 7) b = pal3bit(r);
-
-	BurnPalette[offset] = BurnHighCol(r,g,b,0);
+	PaletteUpdate(&fmt_RRRGGGBB_inv);
 }
 
 void BurnPaletteWrite_BBGGGRRR(INT32 offset)
 {
-	palette_write_8bit(offset, 3, 3, 2, 0, 3, 6, 0);
+	PaletteWrite(&fmt_BBGGGRRR, offset);
 }
 
 void BurnPaletteWrite_RRRGGGBB(INT32 offset)
 {
-	palette_write_8bit(offset, 3, 3, 2, 5, 2, 0, 0);
+	PaletteWrite(&fmt_RRRGGGBB, offset);
 }
 
 void BurnPaletteWrite_BBGGGRRR_inverted(INT32 offset)
 {
-	palette_write_8bit(offset, 3, 3, 2, 0, 3, 6, 1);
+	PaletteWrite(&fmt_BBGGGRRR_inv, offset);
 }
 
 void BurnPaletteWrite_RRRGGGBB_inverted(INT32 offset)
 {
-	palette_write_8bit(offset, 3, 3, 2, 5, 2, 0, 1);
+	PaletteWrite(&fmt_RRRGGGBB_inv, offset);
 }
 
 #ifdef __cplusplus
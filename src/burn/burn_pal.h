@@ -6,6 +6,14 @@ extern UINT32 *BurnPalette;
 extern UINT8 *BurnPalRAM;
 extern UINT8 BurnRecalc;
 
+// set to make the write functions only mark their entry, the next update function then
+// converts just the entries written since the previous update (all of them if BurnRecalc
+// is set). palette ram changed any other way (state load etc.) needs BurnPaletteDirtyAll()
+// cleared by BurnDrvExit()
+
+extern UINT8 BurnPalDeferWrites;
+void BurnPaletteDirtyAll();
+
 // palette update functions are called to recalculate the entire palette
 
 void BurnPaletteUpdate_xxxxBBBBRRRRGGGG();
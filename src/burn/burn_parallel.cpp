@@ -0,0 +1,137 @@
+// FB Neo load-time worker threads
+
+#include "burnint.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#define PARALLEL_WIN32
+#elif defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#include <unistd.h>
+#define PARALLEL_PTHREAD
+#endif
+
+#define PARALLEL_MAX_THREADS	16
+
+INT32 nBurnParallelThreads = 0;
+
+struct ParallelJob {
+	INT32 nCount;
+	volatile INT32 nNext;
+	volatile INT32 nDone;
+	void (*pWork)(INT32, void*);
+	void *pParam;
+};
+
+static INT32 ParallelInc(volatile INT32 *pValue)
+{
+#if defined(_MSC_VER)
+	return InterlockedIncrement((volatile LONG*)pValue) - 1;
+#else
+	return __sync_fetch_and_add(pValue, 1);
+#endif
+}
+
+// Take items until there are none left, returns how many were done (by anyone) after our last one
+static INT32 ParallelRun(ParallelJob *pJob, void (*pProgress)(INT32, INT32, void*))
+{
+	INT32 nDone = 0;
+
+	while (1) {
+		INT32 nItem = ParallelInc(&pJob->nNext);
+		if (nItem >= pJob->nCount) {
+			break;
+		}
+
+		pJob->pWork(nItem, pJob->pParam);
+
+		nDone = ParallelInc(&pJob->nDone) + 1;
+		if (pProgress) {
+			pProgress(nDone, pJob->nCount, pJob->pParam);
+		}
+	}
+
+	return nDone;
+}
+
+#if defined(PARALLEL_WIN32)
+static DWORD WINAPI ParallelProc(LPVOID pJob)
+{
+	ParallelRun((ParallelJob*)pJob, NULL);
+	return 0;
+}
+#elif defined(PARALLEL_PTHREAD)
+static void *ParallelProc(void *pJob)
+{
+	ParallelRun((ParallelJob*)pJob, NULL);
+	return NULL;
+}
+#endif
+
+static INT32 ParallelThreadCount()
+{
+	INT32 nThreads = nBurnParallelThreads;
+
+	if (nThreads <= 0) {
+#if defined(PARALLEL_WIN32)
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		nThreads = info.dwNumberOfProcessors;
+#elif defined(PARALLEL_PTHREAD)
+		nThreads = sysconf(_SC_NPROCESSORS_ONLN);
+#else
+		nThreads = 1;
+#endif
+	}
+
+	if (nThreads < 1) nThreads = 1;
+	if (nThreads > PARALLEL_MAX_THREADS) nThreads = PARALLEL_MAX_THREADS;
+
+	return nThreads;
+}
+
+void BurnParallelFor(INT32 nCount, void (*pWork)(INT32, void*), void *pParam, void (*pProgress)(INT32, INT32, void*))
+{
+	ParallelJob Job;
+
+	Job.nCount = nCount;
+	Job.nNext = 0;
+	Job.nDone = 0;
+	Job.pWork = pWork;
+	Job.pParam = pParam;
+
+	INT32 nWorkers = ParallelThreadCount() - 1;
+	if (nWorkers > nCount - 1) nWorkers = nCount - 1;
+
+#if defined(PARALLEL_WIN32)
+	HANDLE hThreads[PARALLEL_MAX_THREADS];
+#elif defined(PARALLEL_PTHREAD)
+	pthread_t hThreads[PARALLEL_MAX_THREADS];
+#endif
+	INT32 nStarted = 0;
+
+	// a worker that fails to start just leaves more for the others
+	for (INT32 i = 0; i < nWorkers; i++) {
+#if defined(PARALLEL_WIN32)
+		if ((hThreads[nStarted] = CreateThread(NULL, 0, ParallelProc, &Job, 0, NULL)) != NULL) nStarted++;
+#elif defined(PARALLEL_PTHREAD)
+		if (pthread_create(&hThreads[nStarted], NULL, ParallelProc, &Job) == 0) nStarted++;
+#endif
+	}
+
+	INT32 nDone = ParallelRun(&Job, pProgress);
+
+	for (INT32 i = 0; i < nStarted; i++) {
+#if defined(PARALLEL_WIN32)
+		WaitForSingleObject(hThreads[i], INFINITE);
+		CloseHandle(hThreads[i]);
+#elif defined(PARALLEL_PTHREAD)
+		pthread_join(hThreads[i], NULL);
+#endif
+	}
+
+	// the workers may have finished the last items
+	if (pProgress && nDone < nCount) {
+		pProgress(nCount, nCount, pParam);
+	}
+}
@@ -0,0 +1,18 @@
+#ifndef _BURN_PARALLEL_H
+#define _BURN_PARALLEL_H
+
+// Worker threads for one-off bulk work at load time (rom decryption etc.)
+//
+// Items are handed out in order to the calling thread and up to
+// nBurnParallelThreads - 1 workers.  Each item must only write data no other
+// item touches, so the result doesn't depend on which thread ran it.
+
+// 0 = one thread per cpu (max 16), 1 = don't thread
+extern INT32 nBurnParallelThreads;
+
+// pWork(nItem, pParam) is called once for each nItem in [0, nCount).
+// pProgress(nDone, nCount, pParam), if set, is only ever called on the calling
+// thread (so it may use BurnUpdateProgress), after each item it finishes.
+void BurnParallelFor(INT32 nCount, void (*pWork)(INT32, void*), void *pParam, void (*pProgress)(INT32, INT32, void*));
+
+#endif // _BURN_PARALLEL_H
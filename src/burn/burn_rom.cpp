@@ -7,6 +7,7 @@
 #include <zlib.h>
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <dirent.h>
 #include <strings.h> // For strcasecmp
 
@@ -78,48 +79,43 @@ UINT32 CalcCrc32(UINT8* data, UINT32 length) {
     return crc32(0, data, length);
 }
 
-// Load a file into memory
-static UINT8* LoadFileToMemory(const char* filePath, UINT32* fileSize) {
-    FILE* f = fopen(filePath, "rb");
-    if (!f) {
-        printf("[LoadFileToMemory] Could not open file: %s\n", filePath);
+// Map a file read-only, so loose roms go straight from the page cache into
+// the driver's region without an intermediate malloc'd copy
+static UINT8* MapFileToMemory(const char* filePath, UINT32* fileSize) {
+    int fd = open(filePath, O_RDONLY);
+    if (fd < 0) {
+        printf("[MapFileToMemory] Could not open file: %s\n", filePath);
         return NULL;
     }
     
-    // Get file size
-    fseek(f, 0, SEEK_END);
-    long size = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    
-    if (size <= 0) {
-        printf("[LoadFileToMemory] Invalid file size: %ld\n", size);
-        fclose(f);
-        return NULL;
-    }
-    
-    // Allocate memory
-    UINT8* buffer = (UINT8*)malloc(size);
-    if (!buffer) {
-        printf("[LoadFileToMemory] Memory allocation failed for %ld bytes\n", size);
-        fclose(f);
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        printf("[MapFileToMemory] Invalid file size: %s\n", filePath);
+        close(fd);
         return NULL;
     }
     
-    // Read file data
-    size_t bytesRead = fread(buffer, 1, size, f);
-    fclose(f);
+    // The mapping stays valid after the descriptor is closed
+    void* map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
     
-    if (bytesRead != size) {
-        printf("[LoadFileToMemory] Read %zu bytes, expected %ld\n", bytesRead, size);
-        free(buffer);
+    if (map == MAP_FAILED) {
+        printf("[MapFileToMemory] mmap failed for %lld bytes\n", (long long)st.st_size);
         return NULL;
     }
     
+    // Read once from start to end (crc, then copy)
+    madvise(map, st.st_size, MADV_SEQUENTIAL);
+    
     if (fileSize) {
-        *fileSize = (UINT32)size;
+        *fileSize = (UINT32)st.st_size;
     }
     
-    return buffer;
+    return (UINT8*)map;
+}
+
+static void UnmapFile(UINT8* data, UINT32 fileSize) {
+    munmap(data, fileSize);
 }
 
 // Load ROM from a file or ZIP archive
@@ -158,7 +154,7 @@ INT32 BurnLoadRom(UINT8* Dest, INT32* pnWrote, INT32 i) {
     
     // Try to load ROM file directly
     UINT32 fileSize = 0;
-    UINT8* fileData = LoadFileToMemory(romFilePath, &fileSize);
+    UINT8* fileData = MapFileToMemory(romFilePath, &fileSize);
     
     // If direct file load failed, try loading from MvSC.zip or mvsc.zip
     if (!fileData) {
@@ -233,7 +229,7 @@ INT32 BurnLoadRom(UINT8* Dest, INT32* pnWrote, INT32 i) {
     if (fileSize < ri.nLen) {
         printf("[BurnLoadRom] ERROR: ROM file size mismatch for %s\n", ri.szName);
         printf("[BurnLoadRom] Expected: %u bytes, Found: %u bytes\n", ri.nLen, fileSize);
-        free(fileData);
+        UnmapFile(fileData, fileSize);
         return 1;
     }
     
@@ -260,8 +256,8 @@ INT32 BurnLoadRom(UINT8* Dest, INT32* pnWrote, INT32 i) {
         printf("[BurnLoadRom] Loaded %u bytes for %s\n", ri.nLen, ri.szName);
     }
     
-    // Free temporary buffer
-    free(fileData);
+    // Release the mapping
+    UnmapFile(fileData, fileSize);
     
     return 0; // Success
 }
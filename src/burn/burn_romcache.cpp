@@ -0,0 +1,306 @@
+// FB Neo decrypted ROM region cache
+//
+// Each region is stored in its own file, <path><driver>_<region>.fbc, as a
+// small header followed by the raw region.  The region starts on a 64KB
+// boundary so it can be mapped straight from the file: BurnRomCacheLoad copies
+// it into the driver's buffer, BurnRomCacheMap hands out a copy-on-write
+// mapping of the file itself, which BurnFree knows to unmap.
+
+#include "burnint.h"
+#include "version.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+extern bool bDoIpsPatch;
+
+TCHAR szBurnRomCachePath[MAX_PATH] = _T("");
+
+#define ROMCACHE_MAGIC		0x43524246	// "FBRC"
+#define ROMCACHE_DATA		0x10000		// region offset, covers 16KB pages and the win32 allocation granularity
+#define ROMCACHE_MAPS		16
+
+struct RomCacheHeader {
+	UINT32 nMagic;
+	UINT32 nVersion;
+	UINT64 nKey;
+	UINT32 nLen;
+	UINT32 nReserved;
+};
+
+struct RomCacheMapping {
+	UINT8 *pMap;
+	size_t nMapLen;
+};
+
+static RomCacheMapping RomCacheMaps[ROMCACHE_MAPS];
+
+static UINT64 RomCacheHash(UINT64 nHash, const void *pData, INT32 nLen)
+{
+	const UINT8 *p = (const UINT8*)pData;
+
+	for (INT32 i = 0; i < nLen; i++) {
+		nHash ^= p[i];
+		nHash *= 0x100000001b3ULL;			// FNV-1a
+	}
+
+	return nHash;
+}
+
+UINT64 BurnRomCacheKey(const char *szRegion, INT32 nLen)
+{
+	UINT64 nKey = 0xcbf29ce484222325ULL;
+	const char *szName = BurnDrvGetTextA(DRV_NAME);
+	UINT32 nVersion = BURN_VERSION;
+	struct BurnRomInfo ri;
+
+	nKey = RomCacheHash(nKey, szName, strlen(szName) + 1);
+	nKey = RomCacheHash(nKey, &nVersion, sizeof(nVersion));
+
+	// game roms, then the bios roms of drivers that keep them at 0x80+
+	for (UINT32 nStart = 0; nStart <= 0x80; nStart += 0x80) {
+		for (UINT32 i = nStart; !BurnDrvGetRomInfo(&ri, i); i++) {
+			nKey = RomCacheHash(nKey, &ri.nCrc, sizeof(ri.nCrc));
+			nKey = RomCacheHash(nKey, &ri.nLen, sizeof(ri.nLen));
+		}
+	}
+
+	nKey = RomCacheHash(nKey, szRegion, strlen(szRegion) + 1);
+	nKey = RomCacheHash(nKey, &nLen, sizeof(nLen));
+
+	return nKey;
+}
+
+static INT32 RomCacheFileName(TCHAR *szFilename, const char *szRegion)
+{
+	// patched roms keep their crcs, so their output can't be keyed
+	if (szBurnRomCachePath[0] == 0 || bDoIpsPatch) {
+		return 1;
+	}
+
+	_stprintf(szFilename, _T("%s%s_%hs.fbc"), szBurnRomCachePath, BurnDrvGetText(DRV_NAME), szRegion);
+
+	return 0;
+}
+
+static INT32 RomCacheCheckHeader(const RomCacheHeader *pHeader, UINT64 nKey, INT32 nLen)
+{
+	return pHeader->nMagic != ROMCACHE_MAGIC || pHeader->nVersion != (UINT32)(BURN_VERSION) || pHeader->nKey != nKey || pHeader->nLen != (UINT32)nLen;
+}
+
+INT32 BurnRomCacheLoad(const char *szRegion, UINT8 *pDest, INT32 nLen)
+{
+	TCHAR szFilename[MAX_PATH];
+
+	if (pDest == NULL || nLen <= 0 || RomCacheFileName(szFilename, szRegion)) {
+		return 1;
+	}
+
+	UINT64 nKey = BurnRomCacheKey(szRegion, nLen);
+	size_t nFileLen = ROMCACHE_DATA + nLen;
+	INT32 nRet = 1;
+
+#ifndef _WIN32
+	INT32 fd = open(szFilename, O_RDONLY);
+	if (fd < 0) {
+		return 1;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) == 0 && (size_t)st.st_size == nFileLen) {
+		UINT8 *pMap = (UINT8*)mmap(NULL, nFileLen, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		if (pMap != MAP_FAILED) {
+			if (RomCacheCheckHeader((RomCacheHeader*)pMap, nKey, nLen) == 0) {
+				memcpy(pDest, pMap + ROMCACHE_DATA, nLen);
+				nRet = 0;
+			}
+			munmap(pMap, nFileLen);
+		}
+	}
+
+	close(fd);
+#else
+	FILE *fp = _tfopen(szFilename, _T("rb"));
+	if (fp == NULL) {
+		return 1;
+	}
+
+	// check everything before touching pDest, callers fall back to rebuilding it
+	RomCacheHeader Header;
+	fseek(fp, 0, SEEK_END);
+	if ((size_t)ftell(fp) == nFileLen && fseek(fp, 0, SEEK_SET) == 0) {
+		if (fread(&Header, sizeof(Header), 1, fp) == 1 && RomCacheCheckHeader(&Header, nKey, nLen) == 0 && fseek(fp, ROMCACHE_DATA, SEEK_SET) == 0) {
+			if (fread(pDest, 1, nLen, fp) == (size_t)nLen) {
+				nRet = 0;
+			}
+		}
+	}
+
+	fclose(fp);
+#endif
+
+	if (nRet == 0) {
+		bprintf(PRINT_NORMAL, _T("ROM cache: loaded %hs (%d bytes)\n"), szRegion, nLen);
+	}
+
+	return nRet;
+}
+
+INT32 BurnRomCacheSave(const char *szRegion, const UINT8 *pSrc, INT32 nLen)
+{
+	TCHAR szFilename[MAX_PATH];
+	TCHAR szTempName[MAX_PATH + 8];
+
+	if (pSrc == NULL || nLen <= 0 || RomCacheFileName(szFilename, szRegion)) {
+		return 1;
+	}
+
+	// written next to the cache file and renamed over it, so another instance
+	// mapping or loading the old file never sees a half written one
+	_stprintf(szTempName, _T("%s.tmp"), szFilename);
+
+	FILE *fp = _tfopen(szTempName, _T("wb"));
+	if (fp == NULL) {
+		bprintf(PRINT_ERROR, _T("ROM cache: can't write %s\n"), szTempName);
+		return 1;
+	}
+
+	RomCacheHeader Header;
+	memset(&Header, 0, sizeof(Header));
+	Header.nVersion = BURN_VERSION;
+	Header.nKey = BurnRomCacheKey(szRegion, nLen);
+	Header.nLen = nLen;
+
+	// the magic goes in last, so an interrupted write never reads back as valid
+	INT32 nRet = 1;
+	if (fwrite(&Header, sizeof(Header), 1, fp) == 1 && fseek(fp, ROMCACHE_DATA, SEEK_SET) == 0 && fwrite(pSrc, 1, nLen, fp) == (size_t)nLen) {
+		Header.nMagic = ROMCACHE_MAGIC;
+		if (fseek(fp, 0, SEEK_SET) == 0 && fwrite(&Header.nMagic, sizeof(Header.nMagic), 1, fp) == 1) {
+			nRet = 0;
+		}
+	}
+
+	if (fclose(fp)) {
+		nRet = 1;
+	}
+
+	if (nRet == 0) {
+#ifdef _WIN32
+		if (MoveFileEx(szTempName, szFilename, MOVEFILE_REPLACE_EXISTING) == 0) {
+#else
+		if (_trename(szTempName, szFilename)) {
+#endif
+			bprintf(PRINT_ERROR, _T("ROM cache: can't replace %s\n"), szFilename);
+			nRet = 1;
+		}
+	}
+
+	if (nRet) {
+		_tremove(szTempName);
+	}
+
+	return nRet;
+}
+
+UINT8 *BurnRomCacheMap(const char *szRegion, INT32 nLen)
+{
+	TCHAR szFilename[MAX_PATH];
+	INT32 nSlot;
+
+	if (nLen <= 0 || RomCacheFileName(szFilename, szRegion)) {
+		return NULL;
+	}
+
+	for (nSlot = 0; nSlot < ROMCACHE_MAPS; nSlot++) {
+		if (RomCacheMaps[nSlot].pMap == NULL) break;
+	}
+	if (nSlot == ROMCACHE_MAPS) {
+		return NULL;
+	}
+
+	UINT64 nKey = BurnRomCacheKey(szRegion, nLen);
+	size_t nFileLen = ROMCACHE_DATA + nLen;
+	UINT8 *pMap = NULL;
+
+	// private mappings: every instance shares the page cache until it writes to a page
+#ifndef _WIN32
+	INT32 fd = open(szFilename, O_RDONLY);
+	if (fd < 0) {
+		return NULL;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) == 0 && (size_t)st.st_size == nFileLen) {
+		pMap = (UINT8*)mmap(NULL, nFileLen, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+		if (pMap == MAP_FAILED) {
+			pMap = NULL;
+		} else if (RomCacheCheckHeader((RomCacheHeader*)pMap, nKey, nLen)) {
+			munmap(pMap, nFileLen);
+			pMap = NULL;
+		}
+	}
+
+	close(fd);
+#else
+	HANDLE hFile = CreateFile(szFilename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return NULL;
+	}
+
+	LARGE_INTEGER nSize;
+	if (GetFileSizeEx(hFile, &nSize) && (UINT64)nSize.QuadPart == nFileLen) {
+		HANDLE hMapping = CreateFileMapping(hFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+
+		if (hMapping) {
+			// the view keeps the mapping object alive on its own
+			pMap = (UINT8*)MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, nFileLen);
+			CloseHandle(hMapping);
+
+			if (pMap && RomCacheCheckHeader((RomCacheHeader*)pMap, nKey, nLen)) {
+				UnmapViewOfFile(pMap);
+				pMap = NULL;
+			}
+		}
+	}
+
+	CloseHandle(hFile);
+#endif
+
+	if (pMap == NULL) {
+		return NULL;
+	}
+
+	RomCacheMaps[nSlot].pMap = pMap;
+	RomCacheMaps[nSlot].nMapLen = nFileLen;
+
+	bprintf(PRINT_NORMAL, _T("ROM cache: mapped %hs (%d bytes)\n"), szRegion, nLen);
+
+	return pMap + ROMCACHE_DATA;
+}
+
+INT32 BurnRomCacheUnmap(void *pRegion)
+{
+	for (INT32 i = 0; i < ROMCACHE_MAPS; i++) {
+		if (RomCacheMaps[i].pMap && RomCacheMaps[i].pMap + ROMCACHE_DATA == pRegion) {
+#ifndef _WIN32
+			munmap(RomCacheMaps[i].pMap, RomCacheMaps[i].nMapLen);
+#else
+			UnmapViewOfFile(RomCacheMaps[i].pMap);
+#endif
+			RomCacheMaps[i].pMap = NULL;
+			RomCacheMaps[i].nMapLen = 0;
+
+			return 0;
+		}
+	}
+
+	return 1;
+}
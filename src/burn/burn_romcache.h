@@ -0,0 +1,28 @@
+#ifndef _BURN_ROMCACHE_H
+#define _BURN_ROMCACHE_H
+
+// On-disk cache for ROM regions that are expensive to rebuild at every launch
+// (decrypted program code, decoded graphics).  Disabled while the path is empty.
+//
+// Entries are keyed on the driver name, BURN_VERSION and the CRC/length of every
+// ROM in the set, so a different romset or emulator build never reuses them.
+
+extern TCHAR szBurnRomCachePath[MAX_PATH];
+
+// Fill pDest with the cached region, returns 0 on a hit
+INT32 BurnRomCacheLoad(const char *szRegion, UINT8 *pDest, INT32 nLen);
+
+// Store a freshly built region, returns 0 on success
+INT32 BurnRomCacheSave(const char *szRegion, const UINT8 *pSrc, INT32 nLen);
+
+// Map the cached region copy-on-write instead of copying it, NULL on a miss.
+// Release it with BurnFree like any other region (but never BurnRealloc it).
+UINT8 *BurnRomCacheMap(const char *szRegion, INT32 nLen);
+
+// Called by BurnFree, returns 0 if pRegion came from BurnRomCacheMap
+INT32 BurnRomCacheUnmap(void *pRegion);
+
+// Identifies a region of the loaded set (see above)
+UINT64 BurnRomCacheKey(const char *szRegion, INT32 nLen);
+
+#endif // _BURN_ROMCACHE_H
@@ -0,0 +1,205 @@
+// FB Neo shared ROM regions
+//
+// Segments are named after the rom cache key of the region (driver, version,
+// rom crcs, region name and length), and the contents are compared before a
+// process swaps over, so a patched or differently built region is never
+// replaced by someone else's.  The name is removed again when the region is
+// released; processes still mapping the segment keep it until they let go.
+
+#include "burnint.h"
+#include <errno.h>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define SHARE_MAGIC		0x52534246	// "FBSR"
+#define SHARE_DATA		0x10000		// region offset, page aligned
+#define SHARE_MAPS		16
+
+INT32 bBurnShareRegions = 0;
+
+struct ShareHeader {
+	volatile UINT32 nMagic;		// set once the region is complete
+	UINT32 nLen;
+};
+
+struct ShareMapping {
+	UINT8 *pMap;
+	size_t nMapLen;
+	char szName[64];
+};
+
+static ShareMapping ShareMaps[SHARE_MAPS];
+
+#if !defined(_WIN32)
+
+// A segment that is there but never got its magic value was left by a creator
+// that died while filling it (or is filling it right now, in which case it
+// falls back to its private copy when it can't attach to ours)
+static INT32 ShareComplete(const char *szName, INT32 nLen)
+{
+	size_t nMapLen = SHARE_DATA + nLen;
+	INT32 nRet = 0;
+
+	INT32 fd = shm_open(szName, O_RDONLY, 0);
+	if (fd < 0) {
+		return 0;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) == 0 && (size_t)st.st_size == nMapLen) {
+		ShareHeader *pHeader = (ShareHeader*)mmap(NULL, sizeof(ShareHeader), PROT_READ, MAP_SHARED, fd, 0);
+
+		if (pHeader != MAP_FAILED) {
+			nRet = (pHeader->nMagic == SHARE_MAGIC);
+			munmap(pHeader, sizeof(ShareHeader));
+		}
+	}
+
+	close(fd);
+
+	return nRet;
+}
+
+// Fill a new segment, returns 0 on success (or if someone else already made it)
+static INT32 ShareCreate(const char *szName, const UINT8 *pRegion, INT32 nLen)
+{
+	size_t nMapLen = SHARE_DATA + nLen;
+
+	INT32 fd = shm_open(szName, O_RDWR | O_CREAT | O_EXCL, 0644);
+	if (fd < 0 && errno == EEXIST && !ShareComplete(szName, nLen)) {
+		// stale, replace it
+		shm_unlink(szName);
+		fd = shm_open(szName, O_RDWR | O_CREAT | O_EXCL, 0644);
+	}
+	if (fd < 0) {
+		return (errno == EEXIST) ? 0 : 1;
+	}
+
+	INT32 nRet = 1;
+	if (ftruncate(fd, nMapLen) == 0) {
+		UINT8 *pMap = (UINT8*)mmap(NULL, nMapLen, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+		if (pMap != MAP_FAILED) {
+			ShareHeader *pHeader = (ShareHeader*)pMap;
+
+			memcpy(pMap + SHARE_DATA, pRegion, nLen);
+			pHeader->nLen = nLen;
+			__sync_synchronize();
+			pHeader->nMagic = SHARE_MAGIC;
+
+			munmap(pMap, nMapLen);
+			nRet = 0;
+		}
+	}
+
+	close(fd);
+
+	if (nRet) {
+		shm_unlink(szName);
+	}
+
+	return nRet;
+}
+
+static UINT8 *ShareAttach(const char *szName, const UINT8 *pRegion, INT32 nLen)
+{
+	size_t nMapLen = SHARE_DATA + nLen;
+	UINT8 *pMap = NULL;
+
+	INT32 fd = shm_open(szName, O_RDONLY, 0);
+	if (fd < 0) {
+		return NULL;
+	}
+
+	// private mapping: pages are shared until this process writes to one
+	struct stat st;
+	if (fstat(fd, &st) == 0 && (size_t)st.st_size == nMapLen) {
+		pMap = (UINT8*)mmap(NULL, nMapLen, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+		if (pMap == MAP_FAILED) {
+			pMap = NULL;
+		} else {
+			ShareHeader *pHeader = (ShareHeader*)pMap;
+
+			// still being filled by its creator, or built differently from ours
+			if (pHeader->nMagic != SHARE_MAGIC || pHeader->nLen != (UINT32)nLen || memcmp(pMap + SHARE_DATA, pRegion, nLen)) {
+				munmap(pMap, nMapLen);
+				pMap = NULL;
+			}
+		}
+	}
+
+	close(fd);
+
+	return pMap;
+}
+
+#endif
+
+UINT8 *BurnShareRegion(const char *szRegion, UINT8 *pRegion, INT32 nLen)
+{
+#if !defined(_WIN32)
+	INT32 nSlot;
+
+	if (!bBurnShareRegions || pRegion == NULL || nLen <= 0) {
+		return pRegion;
+	}
+
+	for (nSlot = 0; nSlot < SHARE_MAPS; nSlot++) {
+		if (ShareMaps[nSlot].pMap == NULL) break;
+	}
+	if (nSlot == SHARE_MAPS) {
+		return pRegion;
+	}
+
+	// shm names are a single path component
+	char szName[64];
+	snprintf(szName, sizeof(szName), "/fbneo_%016llx", (unsigned long long)BurnRomCacheKey(szRegion, nLen));
+
+	if (ShareCreate(szName, pRegion, nLen)) {
+		return pRegion;
+	}
+
+	UINT8 *pMap = ShareAttach(szName, pRegion, nLen);
+	if (pMap == NULL) {
+		return pRegion;
+	}
+
+	ShareMaps[nSlot].pMap = pMap;
+	ShareMaps[nSlot].nMapLen = SHARE_DATA + nLen;
+	strcpy(ShareMaps[nSlot].szName, szName);
+
+	BurnFree(pRegion);
+
+	bprintf(PRINT_NORMAL, _T("Sharing %hs (%d bytes)\n"), szRegion, nLen);
+
+	return pMap + SHARE_DATA;
+#else
+	return pRegion;
+#endif
+}
+
+INT32 BurnShareUnmap(void *pRegion)
+{
+#if !defined(_WIN32)
+	for (INT32 i = 0; i < SHARE_MAPS; i++) {
+		if (ShareMaps[i].pMap && ShareMaps[i].pMap + SHARE_DATA == pRegion) {
+			munmap(ShareMaps[i].pMap, ShareMaps[i].nMapLen);
+			shm_unlink(ShareMaps[i].szName);
+
+			ShareMaps[i].pMap = NULL;
+			ShareMaps[i].nMapLen = 0;
+			ShareMaps[i].szName[0] = '\0';
+
+			return 0;
+		}
+	}
+#endif
+
+	return 1;
+}
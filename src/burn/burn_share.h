@@ -0,0 +1,20 @@
+#ifndef _BURN_SHARE_H
+#define _BURN_SHARE_H
+
+// Sharing finished ROM regions between emulator processes running the same set.
+//
+// The first process to publish a region copies it into a named shared memory
+// segment; every process (including the first) then swaps its private copy for
+// a copy-on-write mapping of the segment.  Off unless bBurnShareRegions is set.
+
+extern INT32 bBurnShareRegions;
+
+// Call once the region is complete and before anything else keeps a pointer
+// into it.  Returns the shared mapping and frees pRegion, or returns pRegion
+// untouched if the region couldn't be shared.  Release it with BurnFree.
+UINT8 *BurnShareRegion(const char *szRegion, UINT8 *pRegion, INT32 nLen);
+
+// Called by BurnFree, returns 0 if pRegion came from BurnShareRegion
+INT32 BurnShareUnmap(void *pRegion);
+
+#endif // _BURN_SHARE_H
@@ -0,0 +1,45 @@
+#ifndef _BURN_SIMD_H
+#define _BURN_SIMD_H
+
+// Vector instruction sets for the SIMD kernels, with their intrinsics headers
+//
+// BURN_SSE2 is part of the build's baseline, so its kernels can be used
+// directly.  BURN_SSSE3 kernels are compiled for that target on their own
+// (put BURN_TARGET_SSSE3 in front of each function) and must only be picked
+// when BurnCpuHasSSSE3() says the cpu has it.  BURN_NEON is the build's
+// baseline on ARM.
+
+#if defined (__x86_64__) || defined (_M_X64) || defined (__i386__) || defined (_M_IX86)
+ #if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define BURN_SSE2
+  #include <emmintrin.h>
+ #endif
+ #if defined (__GNUC__)
+  #define BURN_SSSE3
+  #define BURN_TARGET_SSSE3 __attribute__((target("ssse3")))
+  #include <tmmintrin.h>
+ #elif defined (_MSC_VER)
+  #define BURN_SSSE3
+  #define BURN_TARGET_SSSE3
+  #include <tmmintrin.h>
+  #include <intrin.h>
+ #endif
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__) || defined (_M_ARM64)
+ #define BURN_NEON
+ #include <arm_neon.h>
+#endif
+
+static inline INT32 BurnCpuHasSSSE3()
+{
+#if defined (BURN_SSSE3) && defined (_MSC_VER)
+	INT32 nCpuInfo[4];
+	__cpuid(nCpuInfo, 1);
+	return (nCpuInfo[2] & (1 << 9)) ? 1 : 0;
+#elif defined (BURN_SSSE3)
+	return __builtin_cpu_supports("ssse3") ? 1 : 0;
+#else
+	return 0;
+#endif
+}
+
+#endif // _BURN_SIMD_H
@@ -21,6 +21,10 @@ extern INT32 nScreenWidth, nScreenHeight;
 #include "crossplatform.h"
 #include "burn_memory.h"
 #include "burn_debug.h"
+#include "burn_romcache.h"
+#include "burn_parallel.h"
+#include "burn_async.h"
+#include "burn_share.h"
 
 // Metal/macOS specific fixes
 #ifdef __APPLE__
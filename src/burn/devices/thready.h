@@ -333,9 +333,9 @@ struct threadystruct
 
 		our_callback = thread_callback;
 
-		INT32 our_thread_rv = pthread_create(&our_thread, NULL, ThreadyProc, NULL);
 		INT32 our_event_rv = sem_init(&our_event, 0, 0);
 		INT32 wait_event_rv = sem_init(&wait_event, 0, 0);
+		INT32 our_thread_rv = pthread_create(&our_thread, NULL, ThreadyProc, NULL);
 
 		if (our_thread_rv == 0 && wait_event_rv == 0 && our_event_rv == 0) {
 			bprintf(0, _T("Thready: we're gonna git 'r dun!\n"));
@@ -444,13 +444,17 @@ struct threadystruct
 
 		our_callback = thread_callback;
 
-		INT32 our_thread_rv = pthread_create(&our_thread, NULL, ThreadyProc, NULL);
+		// one thready per source file including us (epic12, burn_async), the names must differ
+		snprintf(our_event_str, sizeof(our_event_str), "/fbn_our%x_%x", getpid(), (UINT32)((uintptr_t)this & 0xffffff));
+		snprintf(wait_event_str, sizeof(wait_event_str), "/fbn_wait%x_%x", getpid(), (UINT32)((uintptr_t)this & 0xffffff));
 
-		snprintf(our_event_str, sizeof(our_event_str), "/fbn_our_event%x", getpid());
-		snprintf(wait_event_str, sizeof(wait_event_str), "/fbn_wait_event%x", getpid());
+		// start at 0 like sem_init() above, or the first notify_wait() doesn't wait
+		sem_unlink(our_event_str);
+		sem_unlink(wait_event_str);
+		INT32 our_event_rv = ((our_event = sem_open(our_event_str, O_CREAT, 0644, 0)) == SEM_FAILED) ? -1 : 0;
+		INT32 wait_event_rv = ((wait_event = sem_open(wait_event_str, O_CREAT, 0644, 0)) == SEM_FAILED) ? -1 : 0;
 
-		INT32 our_event_rv = ((our_event = sem_open(our_event_str, O_CREAT, 0644, 1)) == SEM_FAILED) ? -1 : 0;
-		INT32 wait_event_rv = ((wait_event = sem_open(wait_event_str, O_CREAT, 0644, 1)) == SEM_FAILED) ? -1 : 0;
+		INT32 our_thread_rv = pthread_create(&our_thread, NULL, ThreadyProc, NULL);
 
 		if (our_thread_rv == 0 && wait_event_rv == 0 && our_event_rv == 0) {
 			bprintf(0, _T("Thready: we're gonna git 'r dun!\n"));
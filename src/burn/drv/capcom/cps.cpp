@@ -2237,6 +2237,8 @@ static INT32 CpsGetROMs(bool bLoad)
 
 // ----------------------------------------------------------------
 
+static INT32 nCpsMemLen = 0;
+
 INT32 CpsInit()
 {
 	INT32 nMemLen, i;
@@ -2277,6 +2279,7 @@ INT32 CpsInit()
 	}
 
 	// Allocate Gfx, Rom and Z80 Roms
+	nCpsMemLen = nMemLen;
 	CpsGfx = (UINT8*)BurnMalloc(nMemLen);
 	if (CpsGfx == NULL) {
 		return 1;
@@ -2329,6 +2332,30 @@ INT32 CpsInit()
 	return 0;
 }
 
+// Swap the loaded rom block for one shared with other instances, before anything maps it
+static void CpsShareRoms()
+{
+	UINT8 **pRegions[] = { &CpsRom, &CpsCode, &CpsEncZRom, &CpsZRom, &CpsQSam, &CpsAd, &CpsKey };
+	INT32 nOffsets[sizeof(pRegions) / sizeof(pRegions[0])];
+	UINT8 *pOld = CpsGfx;
+
+	// CpsCode is usually separate (decrypted by cps2_crpt.cpp)
+	for (UINT32 i = 0; i < sizeof(pRegions) / sizeof(pRegions[0]); i++) {
+		nOffsets[i] = (*pRegions[i] >= pOld && *pRegions[i] < pOld + nCpsMemLen) ? (*pRegions[i] - pOld) : -1;
+	}
+
+	CpsGfx = BurnShareRegion("cps2_roms", CpsGfx, nCpsMemLen);
+	if (CpsGfx == pOld) {
+		return;
+	}
+
+	for (UINT32 i = 0; i < sizeof(pRegions) / sizeof(pRegions[0]); i++) {
+		if (nOffsets[i] >= 0) {
+			*pRegions[i] = CpsGfx + nOffsets[i];
+		}
+	}
+}
+
 INT32 Cps2Init()
 {
 	Cps = 2;
@@ -2343,6 +2370,8 @@ INT32 Cps2Init()
 		return 1;
 	}
 
+	CpsShareRoms();
+
 	return CpsRunInit();
 }
 
@@ -2362,6 +2391,7 @@ INT32 CpsExit()
 	Scroll3TileMask = 0;
 
 	nCpsCodeLen = nCpsRomLen = nCpsGfxLen = nCpsZRomLen = nCpsQSamLen = nCpsAdLen = nCpsKeyLen = 0;
+	nCpsMemLen = 0;
 	CpsRom = CpsZRom = CpsAd = CpsStar = NULL;
 	CpsQSam = NULL;
 	CpsKey = NULL;
@@ -251,6 +251,7 @@ void __fastcall CpsWriteWord(UINT32 a, UINT16 d);
 
 void DrawFnInit();
 INT32  CpsDraw();
+void CtvInit();
 INT32  CpsRedraw();
 
 INT32 QsndInit();
@@ -274,6 +275,7 @@ void QscReset();
 void QscExit();
 INT32 QscScan(INT32 nAction);
 void QscNewFrame();
+void QscEndFrame();
 void QscWrite(INT32 a, INT32 d);
 UINT8 QscRead();
 INT32 QscUpdate(INT32 nEnd);
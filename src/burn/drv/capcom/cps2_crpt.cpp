@@ -638,77 +638,45 @@ static void optimise_sboxes(struct optimised_sbox* out, const struct sbox* in)
 	}
 }
 
-static void cps2_decrypt(const UINT32 *master_key, UINT32 lower_limit, UINT32 upper_limit)
+struct cps2_decrypt_job
 {
-	UINT16 *rom = (UINT16 *)CpsRom;
-	UINT32 length = (upper_limit > 0) ? (upper_limit * 2) : nCpsRomLen;
-	if (length > nCpsRomLen) length = nCpsRomLen;
-	CpsCode = (UINT8*)BurnMalloc(length);
-	nCpsCodeLen = length;
-	UINT16 *dec = (UINT16*)CpsCode;
-
-	INT32 i;
+	const UINT32 *master_key;
 	UINT32 key1[4];
 	struct optimised_sbox sboxes1[4*4];
 	struct optimised_sbox sboxes2[4*4];
+	const UINT16 *rom;
+	UINT16 *dec;
+	UINT32 length;
+	UINT32 lower_limit;
+	UINT32 upper_limit;
+};
 
-	optimise_sboxes(&sboxes1[0*4], fn1_r1_boxes);
-	optimise_sboxes(&sboxes1[1*4], fn1_r2_boxes);
-	optimise_sboxes(&sboxes1[2*4], fn1_r3_boxes);
-	optimise_sboxes(&sboxes1[3*4], fn1_r4_boxes);
-	optimise_sboxes(&sboxes2[0*4], fn2_r1_boxes);
-	optimise_sboxes(&sboxes2[1*4], fn2_r2_boxes);
-	optimise_sboxes(&sboxes2[2*4], fn2_r3_boxes);
-	optimise_sboxes(&sboxes2[3*4], fn2_r4_boxes);
-
-
-	// expand master key to 1st FN 96-bit key
-	expand_1st_key(key1, master_key);
-
-	// add extra bits for s-boxes with less than 6 inputs
-	key1[0] ^= BIT(key1[0], 1) <<  4;
-	key1[0] ^= BIT(key1[0], 2) <<  5;
-	key1[0] ^= BIT(key1[0], 8) << 11;
-	key1[1] ^= BIT(key1[1], 0) <<  5;
-	key1[1] ^= BIT(key1[1], 8) << 11;
-	key1[2] ^= BIT(key1[2], 1) <<  5;
-	key1[2] ^= BIT(key1[2], 8) << 11;
+// each block is 0x100 values of the low 16 address bits, and every word they select
+static void cps2_decrypt_block(INT32 block, void *param)
+{
+	const struct cps2_decrypt_job *job = (const struct cps2_decrypt_job *)param;
+	const UINT16 *rom = job->rom;
+	UINT16 *dec = job->dec;
 
-	for (i = 0; i < 0x10000; ++i)
+	for (INT32 i = block << 8; i < (block + 1) << 8; ++i)
 	{
 		INT32 a;
 		UINT16 seed;
 		UINT32 subkey[2];
 		UINT32 key2[4];
 
-		if ((i & 0xff) == 0)
-		{
-#if 0
-			char loadingMessage[256]; // for displaying with UI
-			snprintf(loadingMessage, sizeof(loadingMessage), "Decrypting %d%%", i*100/0x10000);
-			ui_set_startup_text(loadingMessage,FALSE);
-#endif
-
-#if 1
-			TCHAR loadingMessage[256]; // for displaying with UI 
-			snprintf(loadingMessage, 256, _T("Decrypting 68000 ROMs with key %d %s"), (i*100/0x10000), _T("%")); 
-			BurnUpdateProgress(0.0, loadingMessage, 0); 
-#endif
-		}
-
-
 		// pass the address through FN1
 		seed = feistel(i, fn1_groupA, fn1_groupB,
-				&sboxes1[0*4], &sboxes1[1*4], &sboxes1[2*4], &sboxes1[3*4],
-				key1[0], key1[1], key1[2], key1[3]);
+				&job->sboxes1[0*4], &job->sboxes1[1*4], &job->sboxes1[2*4], &job->sboxes1[3*4],
+				job->key1[0], job->key1[1], job->key1[2], job->key1[3]);
 
 
 		// expand the result to 64-bit
 		expand_subkey(subkey, seed);
 
 		// XOR with the master key
-		subkey[0] ^= master_key[0];
-		subkey[1] ^= master_key[1];
+		subkey[0] ^= job->master_key[0];
+		subkey[1] ^= job->master_key[1];
 
 		// expand key to 2nd FN 96-bit key
 		expand_2nd_key(key2, subkey);
@@ -725,17 +693,76 @@ static void cps2_decrypt(const UINT32 *master_key, UINT32 lower_limit, UINT32 up
 
 		
 		// decrypt the opcodes
-		for (a = i; a < length/2; a += 0x10000)
+		for (a = i; a < job->length/2; a += 0x10000)
 		{
-			if (a >= lower_limit && a <= upper_limit) {
+			if (a >= job->lower_limit && a <= job->upper_limit) {
 				dec[a] = BURN_ENDIAN_SWAP_INT16(feistel(BURN_ENDIAN_SWAP_INT16(rom[a]), fn2_groupA, fn2_groupB,
-					&sboxes2[0 * 4], &sboxes2[1 * 4], &sboxes2[2 * 4], &sboxes2[3 * 4],
+					&job->sboxes2[0 * 4], &job->sboxes2[1 * 4], &job->sboxes2[2 * 4], &job->sboxes2[3 * 4],
 					key2[0], key2[1], key2[2], key2[3]));
 			} else {
 				dec[a] = rom[a];
 			}
 		}
 	}
+}
+
+static void cps2_decrypt_progress(INT32 done, INT32 count, void *)
+{
+	TCHAR loadingMessage[256]; // for displaying with UI 
+	snprintf(loadingMessage, 256, _T("Decrypting 68000 ROMs with key %d %s"), (done*100/count), _T("%")); 
+	BurnUpdateProgress(0.0, loadingMessage, 0); 
+}
+
+static void cps2_decrypt(const UINT32 *master_key, UINT32 lower_limit, UINT32 upper_limit)
+{
+	UINT32 length = (upper_limit > 0) ? (upper_limit * 2) : nCpsRomLen;
+	if (length > nCpsRomLen) length = nCpsRomLen;
+	nCpsCodeLen = length;
+
+	// the decrypted code is never written, so instances can share the cached pages
+	CpsCode = BurnRomCacheMap("cps2_code", length);
+	if (CpsCode) {
+		return;
+	}
+
+	CpsCode = (UINT8*)BurnMalloc(length);
+
+	struct cps2_decrypt_job job;
+	UINT32 *key1 = job.key1;
+
+	job.master_key = master_key;
+	job.rom = (UINT16 *)CpsRom;
+	job.dec = (UINT16 *)CpsCode;
+	job.length = length;
+	job.lower_limit = lower_limit;
+	job.upper_limit = upper_limit;
+
+	optimise_sboxes(&job.sboxes1[0*4], fn1_r1_boxes);
+	optimise_sboxes(&job.sboxes1[1*4], fn1_r2_boxes);
+	optimise_sboxes(&job.sboxes1[2*4], fn1_r3_boxes);
+	optimise_sboxes(&job.sboxes1[3*4], fn1_r4_boxes);
+	optimise_sboxes(&job.sboxes2[0*4], fn2_r1_boxes);
+	optimise_sboxes(&job.sboxes2[1*4], fn2_r2_boxes);
+	optimise_sboxes(&job.sboxes2[2*4], fn2_r3_boxes);
+	optimise_sboxes(&job.sboxes2[3*4], fn2_r4_boxes);
+
+
+	// expand master key to 1st FN 96-bit key
+	expand_1st_key(key1, master_key);
+
+	// add extra bits for s-boxes with less than 6 inputs
+	key1[0] ^= BIT(key1[0], 1) <<  4;
+	key1[0] ^= BIT(key1[0], 2) <<  5;
+	key1[0] ^= BIT(key1[0], 8) << 11;
+	key1[1] ^= BIT(key1[1], 0) <<  5;
+	key1[1] ^= BIT(key1[1], 8) << 11;
+	key1[2] ^= BIT(key1[2], 1) <<  5;
+	key1[2] ^= BIT(key1[2], 8) << 11;
+
+	// every seed decrypts its own set of words, so the blocks can run in any order
+	BurnParallelFor(0x10000 >> 8, cps2_decrypt_block, &job, cps2_decrypt_progress);
+
+	BurnRomCacheSave("cps2_code", CpsCode, length);
 #if 0
 	memory_set_decrypted_region(0, 0x000000, length - 1, dec);
 	m68k_set_encrypted_opcode_range(0,0,length);
@@ -57,6 +57,8 @@ CpsrRenderDoFn  CpsrRenderDoX;
 
 void DrawFnInit()
 {
+	CtvInit();								// Pick the scalar or SIMD tile drawing functions
+
 	if(Cps == 2) {
 		CpsLayersDoX   = Cps2Layers;
 		CpsScr1DrawDoX = Cps2Scr1Draw;
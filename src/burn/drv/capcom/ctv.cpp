@@ -1,4 +1,5 @@
 #include "cps.h"
+#include "burn_simd.h"
 
 // CPS Tile Variants
 // Create a unique name for each possible tile variant.
@@ -27,12 +28,42 @@ UINT8 *pCtvLine=NULL; // Pointer to output bitmap
 //CtvDoFn CtvDoXB[0x20];
 
 static INT32 nLastBpp=0;
+static INT32 bCtvSimd=0;
+
+void CtvInit()
+{
+  // Use the SSSE3 set of tile functions when the cpu has it (they draw the same pixels)
+  bCtvSimd=0;
+#if defined (BURN_SSSE3)
+  bCtvSimd=BurnCpuHasSSSE3();
+#endif
+  nLastBpp=0;
+}
+
 INT32 CtvReady()
 {
   // Set up the CtvDoX functions to point to the correct bpp functions.
   // Must be called before calling CpstOne
   if (nBurnBpp!=nLastBpp)
   {
+#if defined (BURN_SSSE3)
+	  if (bCtvSimd && nBurnBpp==2) {
+		memcpy(CtvDoX,CtvDoV2,sizeof(CtvDoX));
+		memcpy(CtvDoXM,CtvDoV2m,sizeof(CtvDoXM));
+		memcpy(CtvDoXB,CtvDoV2b,sizeof(CtvDoXB));
+	  }
+	  else if (bCtvSimd && nBurnBpp==3) {
+		memcpy(CtvDoX,CtvDoV3,sizeof(CtvDoX));
+		memcpy(CtvDoXM,CtvDoV3m,sizeof(CtvDoXM));
+		memcpy(CtvDoXB,CtvDoV3b,sizeof(CtvDoXB));
+	  }
+	  else if (bCtvSimd && nBurnBpp==4) {
+		memcpy(CtvDoX,CtvDoV4,sizeof(CtvDoX));
+		memcpy(CtvDoXM,CtvDoV4m,sizeof(CtvDoXM));
+		memcpy(CtvDoXB,CtvDoV4b,sizeof(CtvDoXB));
+	  }
+	  else
+#endif
 	  if (nBurnBpp==2) {
 		memcpy(CtvDoX,CtvDo2,sizeof(CtvDoX));
 		memcpy(CtvDoXM,CtvDo2m,sizeof(CtvDoXM));
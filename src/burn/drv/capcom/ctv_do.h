@@ -38,6 +38,80 @@ static inline UINT32 alpha_blend(UINT32 d, UINT32 s, UINT32 p) {
 #define DRAW_8 nBlank |= b; EIGHT(DO_PIX)
 #define DRAW_8_FLIPX nBlank |= b; EIGHT(DO_PIX_FLIPX)
 
+// SIMD tile rows, see ctv_do_template.h (CU_SIMD)
+#include "burn_simd.h"
+
+#if defined (BURN_SSSE3)
+
+static inline INT32 CtvCtz(UINT32 n)
+{
+#if defined (__GNUC__)
+	return __builtin_ctz(n);
+#else
+	unsigned long i;
+	_BitScanForward(&i, n);
+	return i;
+#endif
+}
+
+// 16 pixels from two tile words, one per byte in screen order. Pixel 0 is the top nibble of w0,
+// with FlipX it's the bottom nibble of w1.
+BURN_TARGET_SSSE3 static inline __m128i CtvUnpack16(UINT32 w0, UINT32 w1, INT32 nFlipX)
+{
+	const __m128i nibble = _mm_set1_epi8(0x0f);
+	const __m128i order  = _mm_setr_epi8( 6,  7,  4,  5,  2,  3,  0,  1, 14, 15, 12, 13, 10, 11,  8,  9);
+	const __m128i orderx = _mm_setr_epi8( 9,  8, 11, 10, 13, 12, 15, 14,  1,  0,  3,  2,  5,  4,  7,  6);
+
+	__m128i v = _mm_set_epi32(0, 0, w1, w0);
+	v = _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi16(v, 4), nibble), _mm_and_si128(v, nibble));
+
+	return _mm_shuffle_epi8(v, nFlipX ? orderx : order);
+}
+
+// 0xff for each of 16 pixels whose nCtvRollX test passes, rx is the roll of pixel 0
+BURN_TARGET_SSSE3 static inline __m128i CtvClip16(UINT32 rx)
+{
+	const __m128i bits = _mm_set1_epi32(0x20004000);
+	const __m128i step = _mm_set1_epi32(4 * 0x7fff);
+	const __m128i zero = _mm_setzero_si128();
+
+	__m128i r0 = _mm_add_epi32(_mm_set1_epi32(rx), _mm_setr_epi32(0, 0x7fff, 2 * 0x7fff, 3 * 0x7fff));
+	__m128i r1 = _mm_add_epi32(r0, step);
+	__m128i r2 = _mm_add_epi32(r1, step);
+	__m128i r3 = _mm_add_epi32(r2, step);
+
+	r0 = _mm_cmpeq_epi32(_mm_and_si128(r0, bits), zero);
+	r1 = _mm_cmpeq_epi32(_mm_and_si128(r1, bits), zero);
+	r2 = _mm_cmpeq_epi32(_mm_and_si128(r2, bits), zero);
+	r3 = _mm_cmpeq_epi32(_mm_and_si128(r3, bits), zero);
+
+	return _mm_packs_epi16(_mm_packs_epi32(r0, r1), _mm_packs_epi32(r2, r3));
+}
+
+// Split the 16 colours of a tile palette into 4 byte planes, for looking up with pshufb
+BURN_TARGET_SSSE3 static inline void CtvPalPlanes(const UINT32* ctp, __m128i* pPlane)
+{
+	const __m128i transpose = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+
+	__m128i v0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(ctp +  0)), transpose);
+	__m128i v1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(ctp +  4)), transpose);
+	__m128i v2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(ctp +  8)), transpose);
+	__m128i v3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(ctp + 12)), transpose);
+
+	__m128i a = _mm_unpacklo_epi32(v0, v1), b = _mm_unpacklo_epi32(v2, v3);
+	__m128i c = _mm_unpackhi_epi32(v0, v1), d = _mm_unpackhi_epi32(v2, v3);
+
+	pPlane[0] = _mm_unpacklo_epi64(a, b);
+	pPlane[1] = _mm_unpackhi_epi64(a, b);
+	pPlane[2] = _mm_unpacklo_epi64(c, d);
+	pPlane[3] = _mm_unpackhi_epi64(c, d);
+}
+
+// Keep d where the mask is clear
+#define CTV_SELECT(m, s, d)	_mm_or_si128(_mm_and_si128(m, s), _mm_andnot_si128(m, d))
+
+#endif
+
 // Tile drawing functions
 INT32 CtvDo208____();
 INT32 CtvDo208__f_();
@@ -1,12 +1,17 @@
 // Template for CTV tile drawing function bodies
 // This file is meant to be included multiple times with different macro settings
 // to generate all CtvDo... function variants.
+//
+// CU_BPP, CU_SIZE, CU_ROWS, CU_CARE, CU_FLIPX and CU_MASK select the variant, CTV_* hold the
+// letters for its name. With CU_SIMD 1 the same variant is built around the SSSE3 row kernels
+// in ctv_do.h and named CtvDoV..., it must draw exactly what the CU_SIMD 0 version draws.
 
 #ifndef CTV_DO_TEMPLATE_ONCE
 #define CTV_DO_TEMPLATE_ONCE
 
 #include "burnint.h"
 #include "cps.h"
+#include "ctv_do.h"
 #include <string.h>
 
 // Global variables needed by CTV functions
@@ -19,96 +24,244 @@ extern UINT8 *pCtvTile;
 extern INT32 nCtvTileAdd;
 extern UINT8 *pCtvLine;
 
+// Tile state from cpst.cpp
+extern UINT32 *CpstPal;
+extern UINT32 nCpsBlend;
+extern INT16 *CpstRowShift;
+extern UINT32 CpstPmsk;
+extern INT32 nCpsScreenWidth;
+
 // CPS graphics
 extern UINT8 *CpsGfx;
 
 #endif // CTV_DO_TEMPLATE_ONCE
 
-// Define function names based on BPP, SIZE, FLIPX, ROWS, CARE, MASK
-#define FUNCTIONNAME2(BPP, SIZE, FLIPX, ROWS, CARE, MASK) CtvDo ## BPP ## SIZE ## FLIPX ## ROWS ## CARE ## MASK
-#define FUNCTIONNAME(BPP, SIZE, FLIPX, ROWS, CARE, MASK) FUNCTIONNAME2(BPP, SIZE, FLIPX, ROWS, CARE, MASK)
-
-#ifdef CTV_BPP
- #if CTV_BPP == 2
-  #define BPP 2
- #elif CTV_BPP == 3
-  #define BPP 3
- #elif CTV_BPP == 4
-  #define BPP 4
- #endif
+// Function name, e.g. CtvDo216r_f_ or CtvDoV216r_f_
+#if CU_SIMD
+ #define FUNCTIONNAME2(BPP, SIZE, ROWS, CARE, FLIPX, MASK) CtvDoV ## BPP ## SIZE ## ROWS ## CARE ## FLIPX ## MASK
+#else
+ #define FUNCTIONNAME2(BPP, SIZE, ROWS, CARE, FLIPX, MASK) CtvDo ## BPP ## SIZE ## ROWS ## CARE ## FLIPX ## MASK
 #endif
+#define FUNCTIONNAME(BPP, SIZE, ROWS, CARE, FLIPX, MASK) FUNCTIONNAME2(BPP, SIZE, ROWS, CARE, FLIPX, MASK)
 
-#ifdef CTV_SIZE
- #if CTV_SIZE == 8
-  #define SIZE 
- #elif CTV_SIZE == 16
-  #define SIZE b
- #elif CTV_SIZE == 32
-  #define SIZE m
- #endif
+#define FULL_FUNCTION_NAME FUNCTIONNAME(CTV_BPP, CTV_SIZE, CTV_ROWS, CTV_CARE, CTV_FLIPX, CTV_MASK)
+
+// Plot colour index n at p (0 is transparent and never gets here)
+#if CU_BPP == 2
+ #define CU_PLOT(p, n) { *((UINT16*)(p)) = (UINT16)ctp[n]; }
+#elif CU_BPP == 3
+ #define CU_PLOT(p, n) { UINT8 *pPlot = (p); UINT32 nPlot = ctp[n]; if (nCpsBlend) { nPlot = alpha_blend(pPlot[0]|(pPlot[1]<<8)|(pPlot[2]<<16), nPlot, nCpsBlend); } pPlot[0]=(UINT8)nPlot; pPlot[1]=(UINT8)(nPlot>>8); pPlot[2]=(UINT8)(nPlot>>16); }
+#elif CU_BPP == 4
+ #define CU_PLOT(p, n) { if (nCpsBlend) *((UINT32*)(p)) = alpha_blend(*((UINT32*)(p)), ctp[n], nCpsBlend); else *((UINT32*)(p)) = ctp[n]; }
+#else
+ #error unsupported bitdepth specified.
+#endif
+
+// Sprite masking: draw only over lower z values, and claim the pixel
+#if CU_MASK == 1
+ #define CU_NEXTLINE , pZVal += nCpsScreenWidth
+ #define CU_NEXTPIX , pZ++
+#else
+ #define CU_NEXTLINE
+ #define CU_NEXTPIX
 #endif
 
-#ifdef CTV_FLIPX
- #if CTV_FLIPX == 0
-  #define FLIPX 
- #elif CTV_FLIPX == 1
-  #define FLIPX x
+#if CU_SIMD
+BURN_TARGET_SSSE3
+#endif
+INT32 FULL_FUNCTION_NAME()
+{
+	UINT32 nBlank = 0;
+	UINT32 *ctp = CpstPal;
+
+#if CU_SIMD
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i ones = _mm_cmpeq_epi8(zero, zero);
+	UINT8 nIdx[16];
+
+	// 24bpp has no full-row store, the palette planes and z constants are only used there
+ #if CU_BPP != 3
+	__m128i pal[4];
+	CtvPalPlanes(ctp, pal);
  #endif
+ #if CU_MASK == 1 && CU_BPP != 3
+	const __m128i zsign = _mm_set1_epi16((INT16)0x8000);
+	const __m128i zval = _mm_set1_epi16((INT16)ZValue);
+ #endif
+ #if CU_MASK == 2
+	for (INT32 c = 0; c < 16; c++) {
+		nIdx[c] = (CpstPmsk & (1 << (c ^ 15))) ? 0xff : 0;
+	}
+	const __m128i pmsk = _mm_loadu_si128((const __m128i*)nIdx);
+ #endif
+#endif
+
+	for (INT32 y = 0; y < CU_SIZE; y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd CU_NEXTLINE) {
+		UINT8 *pPix = pCtvLine;
+		const UINT32 *pw = (const UINT32*)pCtvTile;
+#if CU_MASK == 1
+		UINT16 *pZ = pZVal;
+#endif
+#if CU_CARE == 1
+		UINT32 rx = nCtvRollX;
+
+		// Skip lines off the top or bottom
+		if (nCtvRollY & 0x20004000) {
+			nCtvRollY += 0x7fff;
+			continue;
+		}
+		nCtvRollY += 0x7fff;
 #endif
 
-#ifdef CTV_ROWS
- #if CTV_ROWS == 0
-  #define ROWS 
- #elif CTV_ROWS == 1
-  #define ROWS r
+#if CU_ROWS == 1
+		// Line scroll
+		pPix += CpstRowShift[y] * CU_BPP;
+ #if CU_CARE == 1
+		rx += CpstRowShift[y] * 0x7fff;
  #endif
 #endif
 
-#ifdef CTV_CARE
- #if CTV_CARE == 0
-  #define CARE 
- #elif CTV_CARE == 1
-  #define CARE c
+#if CU_SIMD == 0
+
+		for (INT32 w = 0; w < CU_SIZE / 8; w++) {
+#if CU_FLIPX == 1
+			UINT32 b = BURN_ENDIAN_SWAP_INT32(pw[CU_SIZE / 8 - 1 - w]);
+#else
+			UINT32 b = BURN_ENDIAN_SWAP_INT32(pw[w]);
+#endif
+			nBlank |= b;
+
+			for (INT32 x = 0; x < 8; x++, pPix += CU_BPP CU_NEXTPIX) {
+#if CU_FLIPX == 1
+				UINT32 c = b & 15; b >>= 4;
+#else
+				UINT32 c = b >> 28; b <<= 4;
+#endif
+
+#if CU_CARE == 1
+				UINT32 nRoll = rx;
+				rx += 0x7fff;
+				if (nRoll & 0x20004000) continue;
+#endif
+#if CU_MASK == 1
+				if (c == 0 || *pZ >= ZValue) continue;
+				*pZ = ZValue;
+#elif CU_MASK == 2
+				if (c == 0 || (CpstPmsk & (1 << (c ^ 15))) == 0) continue;
+#else
+				if (c == 0) continue;
+#endif
+				CU_PLOT(pPix, c);
+			}
+		}
+
+#else
+
+		// 16 pixels at a time, 8 tiles use the low half
+#if CU_SIZE == 8
+		const UINT32 nLanes = 0x00ff;
+#else
+		const UINT32 nLanes = 0xffff;
+#endif
+
+		for (INT32 h = 0; h < CU_SIZE; h += 16) {
+			UINT32 w0, w1;
+#if CU_SIZE == 8
+ #if CU_FLIPX == 1
+			w0 = 0; w1 = BURN_ENDIAN_SWAP_INT32(pw[0]);
+ #else
+			w0 = BURN_ENDIAN_SWAP_INT32(pw[0]); w1 = 0;
  #endif
+#else
+ #if CU_FLIPX == 1
+			const UINT32 *p = pw + ((CU_SIZE - 16 - h) >> 3);
+ #else
+			const UINT32 *p = pw + (h >> 3);
+ #endif
+			w0 = BURN_ENDIAN_SWAP_INT32(p[0]); w1 = BURN_ENDIAN_SWAP_INT32(p[1]);
+#endif
+			nBlank |= w0 | w1;
+
+			__m128i idx = CtvUnpack16(w0, w1, CU_FLIPX);
+			__m128i draw = _mm_xor_si128(_mm_cmpeq_epi8(idx, zero), ones);
+#if CU_MASK == 2
+			draw = _mm_and_si128(draw, _mm_shuffle_epi8(pmsk, idx));
+#endif
+
+#if CU_CARE == 1
+			UINT32 nVisible = _mm_movemask_epi8(CtvClip16(rx + h * 0x7fff)) & nLanes;
+#else
+			UINT32 nVisible = nLanes;
 #endif
+			UINT32 nDraw = _mm_movemask_epi8(draw) & nVisible;
+			if (nDraw == 0) continue;
 
-#ifdef CTV_MASK
- #if CTV_MASK == 0
-  #define MASK 
- #elif CTV_MASK == 1
-  #define MASK k
- #elif CTV_MASK == 2
-  #define MASK f
+			UINT8 *pDst = pPix + h * CU_BPP;
+#if CU_MASK == 1
+			UINT16 *z = pZ + h;
+#endif
+
+#if CU_BPP == 2
+			if (nVisible == nLanes) {
+#elif CU_BPP == 4
+			if (nVisible == nLanes && nCpsBlend == 0) {
+#else
+			if (0) {
+#endif
+#if CU_BPP != 3
+				// The whole row is on screen - look the colours up, merge and store 8 at a time
+				__m128i lo = _mm_shuffle_epi8(pal[0], idx);
+				__m128i hi = _mm_shuffle_epi8(pal[1], idx);
+ #if CU_BPP == 4
+				__m128i lo2 = _mm_shuffle_epi8(pal[2], idx);
+				__m128i hi2 = _mm_shuffle_epi8(pal[3], idx);
+ #endif
+				for (INT32 k = 0; k < CU_SIZE && k < 16; k += 8) {
+					__m128i m = k ? _mm_unpackhi_epi8(draw, draw) : _mm_unpacklo_epi8(draw, draw);
+ #if CU_MASK == 1
+					__m128i zb = _mm_loadu_si128((const __m128i*)(z + k));
+					m = _mm_and_si128(m, _mm_cmplt_epi16(_mm_xor_si128(zb, zsign), _mm_xor_si128(zval, zsign)));
+					_mm_storeu_si128((__m128i*)(z + k), CTV_SELECT(m, zval, zb));
+ #endif
+ #if CU_BPP == 2
+					__m128i c = k ? _mm_unpackhi_epi8(lo, hi) : _mm_unpacklo_epi8(lo, hi);
+					__m128i *d = (__m128i*)(pDst + k * 2);
+					_mm_storeu_si128(d, CTV_SELECT(m, c, _mm_loadu_si128(d)));
+ #else
+					__m128i c01 = k ? _mm_unpackhi_epi8(lo, hi) : _mm_unpacklo_epi8(lo, hi);
+					__m128i c23 = k ? _mm_unpackhi_epi8(lo2, hi2) : _mm_unpacklo_epi8(lo2, hi2);
+					__m128i *d = (__m128i*)(pDst + k * 4);
+					__m128i ma = _mm_unpacklo_epi16(m, m), mb = _mm_unpackhi_epi16(m, m);
+					_mm_storeu_si128(d + 0, CTV_SELECT(ma, _mm_unpacklo_epi16(c01, c23), _mm_loadu_si128(d + 0)));
+					_mm_storeu_si128(d + 1, CTV_SELECT(mb, _mm_unpackhi_epi16(c01, c23), _mm_loadu_si128(d + 1)));
  #endif
+				}
 #endif
+			} else {
+				// Clipped or blended - only touch the pixels that get drawn
+				_mm_storeu_si128((__m128i*)nIdx, idx);
 
-// This macro expands to the fully qualified function name based on the defines above
-#define FULL_FUNCTION_NAME FUNCTIONNAME(BPP, SIZE, FLIPX, ROWS, CARE, MASK)
+				while (nDraw) {
+					INT32 x = CtvCtz(nDraw);
+					nDraw &= nDraw - 1;
+#if CU_MASK == 1
+					if (z[x] >= ZValue) continue;
+					z[x] = ZValue;
+#endif
+					CU_PLOT(pDst + x * CU_BPP, nIdx[x]);
+				}
+			}
+		}
 
-// Actual function implementation
-extern "C" 
-INT32 FULL_FUNCTION_NAME()
-{
-    // This is a simplified implementation of CTV functions
-    // In a real implementation, this would handle all the combinations
-    // of BPP, SIZE, FLIPX, ROWS, CARE, and MASK
-    
-    // Get tile info from pCtvTile
-    UINT32 nTileNumber = *(UINT16*)(pCtvTile);
-    UINT8 nPalette = *(pCtvTile + 2);
-    
-    // Move to next tile
-    pCtvTile += nCtvTileAdd;
-    
-    return 0;
+#endif
+	}
+
+	return (nBlank == 0);
 }
 
+#undef CU_NEXTLINE
+#undef CU_NEXTPIX
+#undef CU_PLOT
 #undef FULL_FUNCTION_NAME
-#undef BPP
-#undef SIZE
-#undef FLIPX
-#undef ROWS
-#undef CARE
-#undef MASK
 #undef FUNCTIONNAME
-#undef FUNCTIONNAME2 
\ No newline at end of file
+#undef FUNCTIONNAME2
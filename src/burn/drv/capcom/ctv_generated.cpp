@@ -1,3 +1,5 @@
+#define CU_SIMD  (0)
+
 #define CU_MASK  (0)
 
 #define CU_BPP   (2)
@@ -2926,6 +2928,8 @@
 
 #undef  CU_MASK
 
+#undef  CU_SIMD
+
 
 
 // Filler function
@@ -3034,6 +3038,3043 @@ CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
 };
 
 
+#if defined (BURN_SSSE3)
+
+#define CU_SIMD  (1)
+
+#define CU_MASK  (0)
+
+#define CU_BPP   (2)
+
+#define CU_SIZE  (8)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 0
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 0
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 0
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 0
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (16)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (32)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 0
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 0
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 0
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 0
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#undef  CU_BPP
+
+#define CU_BPP   (3)
+
+#define CU_SIZE  (8)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 0
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 0
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 0
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 0
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (16)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (32)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 0
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 0
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 0
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 0
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#undef  CU_BPP
+
+#define CU_BPP   (4)
+
+#define CU_SIZE  (8)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 0
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 0
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 0
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 0
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (16)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (32)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK _
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 0
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 0
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 0
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 0
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#undef  CU_BPP
+
+#undef  CU_MASK
+
+#define CU_MASK  (1)
+
+#define CU_BPP   (2)
+
+#define CU_SIZE  (8)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (16)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 10  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 10  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 10  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 10  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (32)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#undef  CU_BPP
+
+#define CU_BPP   (3)
+
+#define CU_SIZE  (8)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (16)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 10  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 10  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 10  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 10  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (32)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#undef  CU_BPP
+
+#define CU_BPP   (4)
+
+#define CU_SIZE  (8)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (16)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 10  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 10  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 10  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 10  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (32)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK m
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 1
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 1
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#undef  CU_BPP
+
+#undef  CU_MASK
+
+#define CU_MASK  (2)
+
+#define CU_BPP   (2)
+
+#define CU_SIZE  (8)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 2
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 2
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 2
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 2
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (16)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (32)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 2
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 2
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 2
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 2
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 2
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 2
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#undef  CU_BPP
+
+#define CU_BPP   (3)
+
+#define CU_SIZE  (8)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 2
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 2
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 2
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 2
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (16)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (32)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 3
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 3
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 2
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 2
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 2
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 2
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#undef  CU_BPP
+
+#define CU_BPP   (4)
+
+#define CU_SIZE  (8)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 8
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 2
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 2
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 8  mask 2
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 8  mask 2
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (16)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 16
+#define CTV_ROWS r
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#define CU_SIZE  (32)
+
+#define CU_ROWS  (0)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE _
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+#define CTV_BPP 4
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX _
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+#define CTV_BPP 4
+#define CTV_SIZE 32
+#define CTV_ROWS _
+#define CTV_CARE c
+#define CTV_FLIPX f
+#define CTV_MASK b
+#include "ctv_do_template.h"
+#undef CTV_BPP
+#undef CTV_SIZE
+#undef CTV_ROWS
+#undef CTV_CARE
+#undef CTV_FLIPX
+#undef CTV_MASK
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#define CU_ROWS  (1)
+
+#define CU_CARE  (0)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 2
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 2
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#define CU_CARE  (1)
+#define CU_FLIPX (0)
+// Invalid combination of capabilities. rows 1  size 20  mask 2
+#undef  CU_FLIPX
+#define CU_FLIPX (1)
+// Invalid combination of capabilities. rows 1  size 20  mask 2
+#undef  CU_FLIPX
+#undef  CU_CARE
+
+#undef  CU_ROWS
+
+#undef  CU_SIZE
+
+#undef  CU_BPP
+
+#undef  CU_MASK
+
+#undef  CU_SIMD
+
+// Lookup table for 2 bpp
+CtvDoFn CtvDoV2[0x20]={
+CtvDoV28____,CtvDoV28__f_,CtvDoV28_c__,CtvDoV28_cf_,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV216____,CtvDoV216__f_,CtvDoV216_c__,CtvDoV216_cf_,
+CtvDoV216r___,CtvDoV216r_f_,CtvDoV216rc__,CtvDoV216rcf_,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV232____,CtvDoV232__f_,CtvDoV232_c__,CtvDoV232_cf_,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+// Lookup table for 3 bpp
+CtvDoFn CtvDoV3[0x20]={
+CtvDoV38____,CtvDoV38__f_,CtvDoV38_c__,CtvDoV38_cf_,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV316____,CtvDoV316__f_,CtvDoV316_c__,CtvDoV316_cf_,
+CtvDoV316r___,CtvDoV316r_f_,CtvDoV316rc__,CtvDoV316rcf_,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV332____,CtvDoV332__f_,CtvDoV332_c__,CtvDoV332_cf_,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+// Lookup table for 4 bpp
+CtvDoFn CtvDoV4[0x20]={
+CtvDoV48____,CtvDoV48__f_,CtvDoV48_c__,CtvDoV48_cf_,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV416____,CtvDoV416__f_,CtvDoV416_c__,CtvDoV416_cf_,
+CtvDoV416r___,CtvDoV416r_f_,CtvDoV416rc__,CtvDoV416rcf_,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV432____,CtvDoV432__f_,CtvDoV432_c__,CtvDoV432_cf_,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+// Lookup table for 2 bpp with Sprite Masking
+CtvDoFn CtvDoV2m[0x20]={
+CtvDoV28___m,CtvDoV28__fm,CtvDoV28_c_m,CtvDoV28_cfm,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV216___m,CtvDoV216__fm,CtvDoV216_c_m,CtvDoV216_cfm,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV232___m,CtvDoV232__fm,CtvDoV232_c_m,CtvDoV232_cfm,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+// Lookup table for 3 bpp with Sprite Masking
+CtvDoFn CtvDoV3m[0x20]={
+CtvDoV38___m,CtvDoV38__fm,CtvDoV38_c_m,CtvDoV38_cfm,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV316___m,CtvDoV316__fm,CtvDoV316_c_m,CtvDoV316_cfm,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV332___m,CtvDoV332__fm,CtvDoV332_c_m,CtvDoV332_cfm,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+// Lookup table for 4 bpp with Sprite Masking
+CtvDoFn CtvDoV4m[0x20]={
+CtvDoV48___m,CtvDoV48__fm,CtvDoV48_c_m,CtvDoV48_cfm,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV416___m,CtvDoV416__fm,CtvDoV416_c_m,CtvDoV416_cfm,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV432___m,CtvDoV432__fm,CtvDoV432_c_m,CtvDoV432_cfm,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+// Lookup table for 2 bpp with BgHi
+CtvDoFn CtvDoV2b[0x20]={
+CtvDoV28___b,CtvDoV28__fb,CtvDoV28_c_b,CtvDoV28_cfb,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV216___b,CtvDoV216__fb,CtvDoV216_c_b,CtvDoV216_cfb,
+CtvDoV216r__b,CtvDoV216r_fb,CtvDoV216rc_b,CtvDoV216rcfb,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV232___b,CtvDoV232__fb,CtvDoV232_c_b,CtvDoV232_cfb,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+// Lookup table for 3 bpp with BgHi
+CtvDoFn CtvDoV3b[0x20]={
+CtvDoV38___b,CtvDoV38__fb,CtvDoV38_c_b,CtvDoV38_cfb,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV316___b,CtvDoV316__fb,CtvDoV316_c_b,CtvDoV316_cfb,
+CtvDoV316r__b,CtvDoV316r_fb,CtvDoV316rc_b,CtvDoV316rcfb,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV332___b,CtvDoV332__fb,CtvDoV332_c_b,CtvDoV332_cfb,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+// Lookup table for 4 bpp with BgHi
+CtvDoFn CtvDoV4b[0x20]={
+CtvDoV48___b,CtvDoV48__fb,CtvDoV48_c_b,CtvDoV48_cfb,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV416___b,CtvDoV416__fb,CtvDoV416_c_b,CtvDoV416_cfb,
+CtvDoV416r__b,CtvDoV416r_fb,CtvDoV416rc_b,CtvDoV416rcfb,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+CtvDoV432___b,CtvDoV432__fb,CtvDoV432_c_b,CtvDoV432_cfb,
+CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+
+#endif
+
+
 // Current BPP:
 CtvDoFn CtvDoX[0x20];
 CtvDoFn CtvDoXM[0x20];
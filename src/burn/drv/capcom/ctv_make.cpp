@@ -3,7 +3,8 @@
 // Create the ctv.h header file
 // which includes all combinations of the cps tile drawing functions
 
-int main()
+// The functions, nSimd picks the scalar (CtvDo...) or SSSE3 (CtvDoV...) set
+static void EmitFunctions(int nSimd)
 {
   int nCuMask=0;
   int nCuBpp=0;
@@ -12,6 +13,8 @@ int main()
   int nCuCare=0;
   int nCuFlipX=0;
 
+  printf ("#define CU_SIMD  (%d)\n\n",nSimd);
+
   for (nCuMask=0; nCuMask<=2; nCuMask++)
   {
     printf ("#define CU_MASK  (%d)\n\n",nCuMask);
@@ -61,10 +64,14 @@ int main()
 	printf ("#undef  CU_MASK\n\n");
   }
 
-  printf ("\n\n");
+  printf ("#undef  CU_SIMD\n\n");
+}
 
-  printf ("// Filler function\n");
-  printf ("static INT32 CtvDo_______() { return 0; }\n\n\n\n");
+// The lookup tables, pszName is CtvDo or CtvDoV
+static void EmitTables(const char* pszName)
+{
+  int nCuMask=0;
+  int nCuBpp=0;
 
   for (nCuMask=0; nCuMask<=2; nCuMask++)
   {
@@ -75,28 +82,28 @@ int main()
       if (nCuMask==1)
       {
 	     printf ("// Lookup table for %d bpp with Sprite Masking\n",nCuBpp);
-	     printf ("CtvDoFn CtvDo%dm[0x20]={\n",nCuBpp);
+	     printf ("CtvDoFn %s%dm[0x20]={\n",pszName,nCuBpp);
       }
       else if (nCuMask==2)
       {
 	     printf ("// Lookup table for %d bpp with BgHi\n",nCuBpp);
-         printf ("CtvDoFn CtvDo%db[0x20]={\n",nCuBpp);
+         printf ("CtvDoFn %s%db[0x20]={\n",pszName,nCuBpp);
       }
       else
       {
 	     printf ("// Lookup table for %d bpp\n",nCuBpp);
-         printf ("CtvDoFn CtvDo%d[0x20]={\n",nCuBpp);
+         printf ("CtvDoFn %s%d[0x20]={\n",pszName,nCuBpp);
       }
 
       for (i=0;i<0x20;i++)
 	  {
         int s;
-        printf ("CtvDo");
 
         s=(i&24)+8;
-        if (s!=8 && s!=16 && s!=32) { printf ("_______"); goto End; }
-		if ((i&4) && (s!=16)) { printf ("_______"); goto End; }
-		if ((i&4) && (nCuMask==1)) { printf ("_______"); goto End; }
+        if (s!=8 && s!=16 && s!=32) { printf ("CtvDo_______"); goto End; }
+		if ((i&4) && (s!=16)) { printf ("CtvDo_______"); goto End; }
+		if ((i&4) && (nCuMask==1)) { printf ("CtvDo_______"); goto End; }
+        printf ("%s",pszName);
         printf ("%d",nCuBpp);
         printf ("%d",s);
         if (i&4)     printf ("r"); else printf ("_");
@@ -113,6 +120,25 @@ int main()
       printf ("};\n");
 	}
   }
+}
+
+int main()
+{
+  EmitFunctions(0);
+
+  printf ("\n\n");
+
+  printf ("// Filler function\n");
+  printf ("static INT32 CtvDo_______() { return 0; }\n\n\n\n");
+
+  EmitTables("CtvDo");
+
+  // The same set again around the SSSE3 row kernels, picked by CtvInit() when the cpu has them
+  printf ("\n\n");
+  printf ("#if defined (BURN_SSSE3)\n\n");
+  EmitFunctions(1);
+  EmitTables("CtvDoV");
+  printf ("\n#endif\n");
 
   printf ("\n\n");
   printf ("// Current BPP:\n");
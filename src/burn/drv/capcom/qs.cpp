@@ -70,7 +70,7 @@ void QsndExit()
 void QsndEndFrame()
 {
 	BurnTimerEndFrame(nCpsZ80Cycles);
-	if (pBurnSoundOut) QscUpdate(nBurnSoundLen);
+	QscEndFrame();
 	if (Cps2Turbo && pBurnSoundOut) {
 		BurnSampleRender(pBurnSoundOut, nBurnSoundLen);
 	}
@@ -13,6 +13,7 @@
 #include "burnint.h"
 #include "cps.h"
 #include "burn_sound.h"  // Include burn_sound.h for INTERPOLATE4PS_16BIT macro
+#include "burn_simd.h"
 
 // Include our fixes header for Metal builds
 #ifdef USE_METAL_FIXES
@@ -38,6 +39,13 @@ static INT32 nQscRate = 0;
 static INT32 nPos;
 static INT32 nDelta;
 
+// with bBurnAsyncDevices the rest of the frame after the last Z80 access is
+// rendered on the device thread into pQscLag[], and handed out a frame later
+static INT32 nQscJob = -1;
+static INT16 *pQscLag[2] = { NULL, NULL };
+static INT32 nQscLagCur = 0;
+static INT32 bQscLagPending = 0;
+
 static double QsndGain[2];
 static INT32 QsndOutputDir[2];
 
@@ -124,6 +132,18 @@ static INT16 pan_tables[2][2][98];
 
 static INT16 interpolate_buffer[2][4];
 
+// DSP samples are rendered in blocks of up to QSC_BLOCK samples between
+// register writes, then resampled to nBurnSoundRate.
+#define QSC_BLOCK	1024
+
+static INT16 block_out[2][QSC_BLOCK];
+static INT32 block_wet[2][QSC_BLOCK];
+static INT32 block_dry[2][QSC_BLOCK];
+static INT16 fir_line[95 + QSC_BLOCK + 8];	// delay line + block, see fir()
+
+static INT16 voice_output[24];				// 16 PCM + 3 ADPCM, padded for SIMD
+static INT16 mix_coef[2][2][24];			// pan table values per voice
+
 static void init_pan_tables();
 static void init_register_map();
 static void update_sample();
@@ -131,14 +151,14 @@ static void update_sample();
 static void state_init();
 static void state_refresh_filter_1();
 static void state_refresh_filter_2();
-static void state_normal_update();
+static int state_normal_update(int start, int end);
+static void render_block(int count);
 
 static inline INT16 get_sample(UINT16 bank,UINT16 address);
 static inline const INT16* get_filter_table(UINT16 offset);
-static inline INT16 pcm_update(int voice_no, INT32 *echo_out);
 static inline void adpcm_update(int voice_no, int nibble);
 static inline INT16 echo(struct qsound_echo *r,INT32 input);
-static inline INT32 fir(struct qsound_fir *f, INT16 input);
+static void fir(struct qsound_fir *f, INT32 *samples, int count);
 static inline INT32 delay(struct qsound_delay *d, INT32 input);
 static inline void delay_update(struct qsound_delay *d);
 
@@ -356,7 +376,7 @@ INLINE const INT16* get_filter_table(UINT16 offset)
 
 /********************************************************************/
 
-// updates one DSP sample
+// updates one DSP sample outside of the normal states (see render_block())
 static void update_sample()
 {
 	switch(chip.state)
@@ -372,10 +392,6 @@ static void update_sample()
 		case STATE_REFRESH2:
 			state_refresh_filter_2();
 			return;
-		case STATE_NORMAL1:
-		case STATE_NORMAL2:
-			state_normal_update();
-			return;
 	}
 }
 
@@ -499,32 +515,148 @@ static void state_refresh_filter_2()
 	chip.state = chip.next_state = STATE_NORMAL2;
 }
 
-// Updates a PCM voice. There are 16 voices, each are updated every sample
-// with full rate and volume control.
-INLINE INT16 pcm_update(int voice_no, INT32 *echo_out)
+// Updates the PCM voices. There are 16 voices, each are updated every sample
+// with full rate and volume control. The voice registers can only change
+// between blocks (QscWrite syncs first), so for a block the voices are
+// unpacked into lanes and packed back into chip.voice at the end.
+struct qsound_lanes {
+	INT32 addr[16];			// sign extended
+	INT32 phase[16];
+	INT32 rate[16];
+	INT32 end_addr[16];		// sign extended
+	INT32 loop[16];			// loop_len << 12
+	INT16 volume[16];
+	INT16 echo[16];
+	const UINT8 *rom[16];	// rom_zero if the voice can't read sample rom
+	UINT32 rom_base[16];
+	UINT32 rom_mask[16];
+};
+
+static const UINT8 rom_zero[1] = { 0 };
+
+static void pcm_unpack(struct qsound_lanes *l)
+{
+	UINT32 rom_mask = nCpsQSamLen ? (nCpsQSamLen - 1) : 0;
+
+	for (int v = 0; v < 16; v++)
+	{
+		struct qsound_voice *vc = &chip.voice[v];
+
+		l->addr[v] = vc->addr;
+		l->phase[v] = vc->phase;
+		l->rate[v] = vc->rate;
+		l->end_addr[v] = vc->end_addr;
+		l->loop[v] = vc->loop_len << 12;
+		l->volume[v] = vc->volume;
+		l->echo[v] = vc->echo;
+
+		// see get_sample()
+		if (rom_mask && (vc->bank & 0x8000)) {
+			l->rom[v] = CpsQSam;
+			l->rom_base[v] = (vc->bank & 0x7fff) << 16;
+			l->rom_mask[v] = rom_mask;
+		} else {
+			l->rom[v] = rom_zero;
+			l->rom_base[v] = 0;
+			l->rom_mask[v] = 0;
+		}
+	}
+}
+
+static void pcm_pack(const struct qsound_lanes *l)
+{
+	for (int v = 0; v < 16; v++)
+	{
+		chip.voice[v].addr = l->addr[v];
+		chip.voice[v].phase = l->phase[v];
+	}
+}
+
+#if defined (BURN_SSE2)
+
+// Writes the 16 voice outputs and returns the echo input
+static INT32 pcm_update(struct qsound_lanes *l, INT16 *output)
 {
-	struct qsound_voice *v = &chip.voice[voice_no];
-	INT32 new_phase;
-	INT16 output;
+	INT16 sample[16];
+	int v;
 
-	// Read sample from rom and apply volume
-	output = (v->volume * get_sample(v->bank, v->addr))>>14;
+	// Read samples from rom
+	for (v = 0; v < 16; v++)
+		sample[v] = (INT16)(l->rom[v][(l->rom_base[v] | (UINT16)l->addr[v]) & l->rom_mask[v]] << 8);
 
-	*echo_out += (output * v->echo)<<2;
+	// Apply volume, keeping the low 16 bits of (volume * sample) >> 14
+	__m128i echo_sum = _mm_setzero_si128();
+	for (v = 0; v < 16; v += 8)
+	{
+		__m128i s = _mm_loadu_si128((const __m128i*)&sample[v]);
+		__m128i vol = _mm_loadu_si128((const __m128i*)&l->volume[v]);
+		__m128i out = _mm_or_si128(_mm_srli_epi16(_mm_mullo_epi16(vol, s), 14), _mm_slli_epi16(_mm_mulhi_epi16(vol, s), 2));
+
+		_mm_storeu_si128((__m128i*)&output[v], out);
+		echo_sum = _mm_add_epi32(echo_sum, _mm_madd_epi16(out, _mm_loadu_si128((const __m128i*)&l->echo[v])));
+	}
+
+	echo_sum = _mm_add_epi32(echo_sum, _mm_shuffle_epi32(echo_sum, 0x4e));
+	echo_sum = _mm_add_epi32(echo_sum, _mm_shuffle_epi32(echo_sum, 0xb1));
 
 	// Add delta to the phase and loop back if required
-	new_phase = v->rate + ((v->addr<<12) | (v->phase>>4));
+	const __m128i phase_max = _mm_set1_epi32(0x7FFFFFF);
+	const __m128i phase_min = _mm_set1_epi32(-0x8000000);
 
-	if((new_phase>>12) >= v->end_addr)
-		new_phase -= (v->loop_len<<12);
+	for (v = 0; v < 16; v += 4)
+	{
+		__m128i addr = _mm_loadu_si128((const __m128i*)&l->addr[v]);
+		__m128i phase = _mm_loadu_si128((const __m128i*)&l->phase[v]);
+		__m128i new_phase = _mm_add_epi32(_mm_loadu_si128((const __m128i*)&l->rate[v]), _mm_or_si128(_mm_slli_epi32(addr, 12), _mm_srli_epi32(phase, 4)));
 
-	new_phase = CLAMP(new_phase, -0x8000000, 0x7FFFFFF);
-	v->addr = new_phase>>12;
-	v->phase = (new_phase<<4)&0xffff;
+		__m128i looped = _mm_cmplt_epi32(_mm_srai_epi32(new_phase, 12), _mm_loadu_si128((const __m128i*)&l->end_addr[v]));
+		new_phase = _mm_sub_epi32(new_phase, _mm_andnot_si128(looped, _mm_loadu_si128((const __m128i*)&l->loop[v])));
 
-	return output;
+		__m128i over = _mm_cmpgt_epi32(new_phase, phase_max);
+		new_phase = _mm_or_si128(_mm_and_si128(over, phase_max), _mm_andnot_si128(over, new_phase));
+		__m128i under = _mm_cmplt_epi32(new_phase, phase_min);
+		new_phase = _mm_or_si128(_mm_and_si128(under, phase_min), _mm_andnot_si128(under, new_phase));
+
+		_mm_storeu_si128((__m128i*)&l->addr[v], _mm_srai_epi32(new_phase, 12));
+		_mm_storeu_si128((__m128i*)&l->phase[v], _mm_and_si128(_mm_slli_epi32(new_phase, 4), _mm_set1_epi32(0xffff)));
+	}
+
+	return _mm_cvtsi128_si32(echo_sum) << 2;
+}
+
+#else
+
+// Writes the 16 voice outputs and returns the echo input
+static INT32 pcm_update(struct qsound_lanes *l, INT16 *output)
+{
+	INT32 echo_out = 0;
+
+	for (int v = 0; v < 16; v++)
+	{
+		INT32 new_phase;
+		INT16 sample = (INT16)(l->rom[v][(l->rom_base[v] | (UINT16)l->addr[v]) & l->rom_mask[v]] << 8);
+
+		// Read sample from rom and apply volume
+		output[v] = (l->volume[v] * sample)>>14;
+
+		echo_out += (output[v] * l->echo[v])<<2;
+
+		// Add delta to the phase and loop back if required
+		new_phase = l->rate[v] + ((l->addr[v]<<12) | (l->phase[v]>>4));
+
+		if((new_phase>>12) >= l->end_addr[v])
+			new_phase -= l->loop[v];
+
+		new_phase = CLAMP(new_phase, -0x8000000, 0x7FFFFFF);
+		l->addr[v] = new_phase>>12;
+		l->phase[v] = (new_phase<<4)&0xffff;
+	}
+
+	return echo_out;
 }
 
+#endif
+
 // Updates an ADPCM voice. There are 3 voices, one is updated every sample
 // (effectively making the ADPCM rate 1/3 of the master sample rate), and
 // volume is set when starting samples only.
@@ -601,108 +733,217 @@ INLINE INT16 echo(struct qsound_echo *r,INT32 input)
 	return old_sample;
 }
 
-// Process a sample update
-static void state_normal_update()
+// Sums voice_output * mix_coef for both channels and both components
+#if defined (BURN_SSE2)
+
+static void mix_voices(INT32 mix[2][2])
+{
+	__m128i sum[4];
+
+	for(int i=0; i<4; i++)
+	{
+		const INT16 *coef = mix_coef[i >> 1][i & 1];
+		sum[i] = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)&voice_output[0]), _mm_loadu_si128((const __m128i*)&coef[0]));
+		sum[i] = _mm_add_epi32(sum[i], _mm_madd_epi16(_mm_loadu_si128((const __m128i*)&voice_output[8]), _mm_loadu_si128((const __m128i*)&coef[8])));
+		sum[i] = _mm_add_epi32(sum[i], _mm_madd_epi16(_mm_loadu_si128((const __m128i*)&voice_output[16]), _mm_loadu_si128((const __m128i*)&coef[16])));
+	}
+
+	// transpose and add, lane i = total of sum[i]
+	__m128i s01 = _mm_add_epi32(_mm_unpacklo_epi32(sum[0], sum[1]), _mm_unpackhi_epi32(sum[0], sum[1]));
+	__m128i s23 = _mm_add_epi32(_mm_unpacklo_epi32(sum[2], sum[3]), _mm_unpackhi_epi32(sum[2], sum[3]));
+	_mm_storeu_si128((__m128i*)&mix[0][0], _mm_add_epi32(_mm_unpacklo_epi64(s01, s23), _mm_unpackhi_epi64(s01, s23)));
+}
+
+#else
+
+static void mix_voices(INT32 mix[2][2])
+{
+	for(int ch=0; ch<2; ch++)
+	{
+		INT32 dry = 0, wet = 0;
+
+		for(int v=0; v<19; v++)
+		{
+			dry += voice_output[v] * mix_coef[ch][PANTBL_DRY][v];
+			wet += voice_output[v] * mix_coef[ch][PANTBL_WET][v];
+		}
+
+		mix[ch][PANTBL_DRY] = dry;
+		mix[ch][PANTBL_WET] = wet;
+	}
+}
+
+#endif
+
+// Apply the FIR filter used as the Q1 transfer function to count samples in
+// place. The input is (sample >> 16). The delay line is laid out in front of
+// the block, oldest first, so each output is one dot product.
+static void fir(struct qsound_fir *f, INT32 *samples, int count)
+{
+	int len = (f->tap_count > 1) ? f->tap_count-1 : 0;	// delay line length
+	int n, tap;
+
+	for(n=0; n<len; n++)
+		fir_line[n] = f->delay_line[(f->delay_pos + n) % len];
+	for(n=0; n<count; n++)
+		fir_line[len+n] = samples[n] >> 16;
+
+#if defined (BURN_SSE2)
+	// taps padded with zeros to a multiple of 8
+	INT16 taps[96];
+	int padded = (len + 8) & ~7;
+
+	memset(taps, 0, sizeof(taps));
+	memcpy(taps, f->taps, (len+1) * sizeof(INT16));
+
+	for(n=0; n<count; n++)
+	{
+		__m128i sum = _mm_setzero_si128();
+
+		for(tap=0; tap<padded; tap+=8)
+			sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_loadu_si128((const __m128i*)&fir_line[n+tap]), _mm_loadu_si128((const __m128i*)&taps[tap])));
+
+		sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4e));
+		sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xb1));
+
+		samples[n] = -(_mm_cvtsi128_si32(sum)<<2);
+	}
+#else
+	for(n=0; n<count; n++)
+	{
+		INT32 output = 0;
+
+		for(tap=0; tap<=len; tap++)
+			output -= (f->taps[tap] * fir_line[n+tap])<<2;
+
+		samples[n] = output;
+	}
+#endif
+
+	// the last len inputs are the new delay line
+	for(n=0; n<len; n++)
+		f->delay_line[n] = fir_line[count+n];
+	f->delay_pos = 0;
+}
+
+// Process a block of sample updates in the normal state, writing the output to
+// block_out[][start...]. Stops after end or when the state changes, and
+// returns the number of samples done.
+//
+// The voices, echo and mixing run sample by sample. The FIR filters and the
+// delay lines only depend on the mixed samples, so they run over the whole
+// block afterwards.
+static int state_normal_update(int start, int end)
 {
-	int v, ch;
-	INT32 echo_input = 0;
-	INT16 echo_output;
+	struct qsound_lanes lanes;
+	int v, ch, n, count;
+	UINT16 state = chip.state;
 
 	chip.ready_flag = 0x80;
 
 	// recalculate echo length
-	if(chip.state == STATE_NORMAL2)
+	if(state == STATE_NORMAL2)
 		chip.echo.length = chip.echo.end_pos - 0x53c;
 	else
 		chip.echo.length = chip.echo.end_pos - 0x554;
 
 	chip.echo.length = CLAMP(chip.echo.length, 0, 1024);
 
-	// update PCM voices
-	for(v=0; v<16; v++)
-		chip.voice_output[v] = pcm_update(v, &echo_input);
+	// Apply different volume tables on the dry and wet inputs.
+	for(v=0; v<24; v++)
+	{
+		UINT16 pan_index = (v < 19) ? chip.voice_pan[v]-0x110 : 97;
+		if(pan_index > 97)
+			pan_index = 97;
 
-	// update ADPCM voices (one every third sample)
-	adpcm_update(chip.state_counter % 3, chip.state_counter / 3);
+		for(ch=0; ch<2; ch++)
+		{
+			mix_coef[ch][PANTBL_DRY][v] = (v < 19) ? pan_tables[ch][PANTBL_DRY][pan_index] : 0;
+			mix_coef[ch][PANTBL_WET][v] = (v < 19) ? pan_tables[ch][PANTBL_WET][pan_index] : 0;
+		}
+	}
 
-	echo_output = echo(&chip.echo,echo_input);
+	pcm_unpack(&lanes);
+	memcpy(voice_output, chip.voice_output, sizeof(chip.voice_output));
 
-	// now, we do the magic stuff
-	for(ch=0; ch<2; ch++)
+	for(count=0; start+count < end; )
 	{
-		// Echo is output on the unfiltered component of the left channel and
-		// the filtered component of the right channel.
-		INT32 wet = (ch == 1) ? echo_output<<14 : 0;
-		INT32 dry = (ch == 0) ? echo_output<<14 : 0;
-		INT32 output = 0;
+		INT32 mix[2][2];
 
-		for(v=0; v<19; v++)
-		{
-			UINT16 pan_index = chip.voice_pan[v]-0x110;
-			if(pan_index > 97)
-				pan_index = 97;
+		// update PCM voices
+		INT32 echo_input = pcm_update(&lanes, voice_output);
 
-			// Apply different volume tables on the dry and wet inputs.
-			dry -= (chip.voice_output[v] * pan_tables[ch][PANTBL_DRY][pan_index]);
-			wet -= (chip.voice_output[v] * pan_tables[ch][PANTBL_WET][pan_index]);
-		}
+		// update ADPCM voices (one every third sample)
+		adpcm_update(chip.state_counter % 3, chip.state_counter / 3);
+		voice_output[16+chip.state_counter % 3] = chip.voice_output[16+chip.state_counter % 3];
 
-		// Saturate accumulated voices
-		dry = CLAMP(dry, -0x1fffffff, 0x1fffffff) << 2;
-		wet = CLAMP(wet, -0x1fffffff, 0x1fffffff) << 2;
+		INT16 echo_output = echo(&chip.echo,echo_input);
 
-		// Apply FIR filter on 'wet' input
-		wet = fir(&chip.filter[ch], wet >> 16);
+		// now, we do the magic stuff
+		mix_voices(mix);
 
-		// in mode 2, we do this on the 'dry' input too
-		if(chip.state == STATE_NORMAL2)
-			dry = fir(&chip.alt_filter[ch], dry >> 16);
+		for(ch=0; ch<2; ch++)
+		{
+			// Echo is output on the unfiltered component of the left channel and
+			// the filtered component of the right channel.
+			INT32 wet = (ch == 1) ? echo_output<<14 : 0;
+			INT32 dry = (ch == 0) ? echo_output<<14 : 0;
 
-		// output goes through a delay line and attenuation
-		output = (delay(&chip.wet[ch], wet) + delay(&chip.dry[ch], dry));
+			dry -= mix[ch][PANTBL_DRY];
+			wet -= mix[ch][PANTBL_WET];
 
-		// DSP round function
-		output = ((output + 0x2000) & ~0x3fff) >> 14;
-		chip.out[ch] = CLAMP(output, -0x7fff, 0x7fff);
+			// Saturate accumulated voices
+			block_dry[ch][count] = CLAMP(dry, -0x1fffffff, 0x1fffffff) << 2;
+			block_wet[ch][count] = CLAMP(wet, -0x1fffffff, 0x1fffffff) << 2;
+		}
+
+		count++;
 
-		if(chip.delay_update)
+		// after 6 samples, the next state is executed.
+		chip.state_counter++;
+		if(chip.state_counter > 5)
 		{
-			delay_update(&chip.wet[ch]);
-			delay_update(&chip.dry[ch]);
+			chip.state_counter = 0;
+			chip.state = chip.next_state;
+			if(chip.state != state)
+				break;
 		}
 	}
 
-	chip.delay_update = 0;
+	pcm_pack(&lanes);
+	memcpy(chip.voice_output, voice_output, 16 * sizeof(INT16));
 
-	// after 6 samples, the next state is executed.
-	chip.state_counter++;
-	if(chip.state_counter > 5)
+	for(ch=0; ch<2; ch++)
 	{
-		chip.state_counter = 0;
-		chip.state = chip.next_state;
-	}
-}
+		// Apply FIR filter on 'wet' input
+		fir(&chip.filter[ch], block_wet[ch], count);
 
-// Apply the FIR filter used as the Q1 transfer function
-INLINE INT32 fir(struct qsound_fir *f, INT16 input)
-{
-	INT32 output = 0, tap = 0;
+		// in mode 2, we do this on the 'dry' input too
+		if(state == STATE_NORMAL2)
+			fir(&chip.alt_filter[ch], block_dry[ch], count);
 
-	for(; tap < (f->tap_count-1); tap++)
-	{
-		output -= (f->taps[tap] * f->delay_line[f->delay_pos++])<<2;
+		for(n=0; n<count; n++)
+		{
+			// output goes through a delay line and attenuation
+			INT32 output = (delay(&chip.wet[ch], block_wet[ch][n]) + delay(&chip.dry[ch], block_dry[ch][n]));
 
-		if(f->delay_pos >= f->tap_count-1)
-			f->delay_pos = 0;
-	}
+			// DSP round function
+			output = ((output + 0x2000) & ~0x3fff) >> 14;
+			block_out[ch][start+n] = CLAMP(output, -0x7fff, 0x7fff);
 
-	output -= (f->taps[tap] * input)<<2;
+			if(n == 0 && chip.delay_update)
+			{
+				delay_update(&chip.wet[ch]);
+				delay_update(&chip.dry[ch]);
+			}
+		}
 
-	f->delay_line[f->delay_pos++] = input;
-	if(f->delay_pos >= f->tap_count-1)
-		f->delay_pos = 0;
+		chip.out[ch] = block_out[ch][start+count-1];
+	}
 
-	return output;
+	chip.delay_update = 0;
+
+	return count;
 }
 
 // Apply delay line and component volume
@@ -731,6 +972,25 @@ INLINE void delay_update(struct qsound_delay *d)
 	d->read_pos = new_read_pos;
 }
 
+// Render count DSP samples into block_out
+static void render_block(int count)
+{
+	int n = 0;
+
+	while (n < count)
+	{
+		if (chip.state == STATE_NORMAL1 || chip.state == STATE_NORMAL2) {
+			n += state_normal_update(n, count);
+			continue;
+		}
+
+		update_sample();
+		block_out[0][n] = chip.out[0];
+		block_out[1][n] = chip.out[1];
+		n++;
+	}
+}
+
 //==========================================
 
 static INT64 CalcAdvance()
@@ -741,8 +1001,15 @@ static INT64 CalcAdvance()
 	return 0;
 }
 
+static void QscJob(void *)
+{
+	QscUpdate(nBurnSoundLen);
+}
+
 void QscReset()
 {
+	BurnAsyncJoin(nQscJob);
+
 	chip.ready_flag = 0;
 	chip.out[0] = chip.out[1] = 0;
 	chip.state = 0;
@@ -753,6 +1020,12 @@ void QscReset()
 
 void QscExit()
 {
+	BurnAsyncJoin(nQscJob);
+	nQscJob = -1;
+
+	BurnFree(pQscLag[0]);
+	BurnFree(pQscLag[1]);
+
 	nQscRate = 0;
 }
 
@@ -769,6 +1042,16 @@ INT32 QscInit(INT32 nRate)
 	QsndOutputDir[BURN_SND_QSC_OUTPUT_1] = BURN_SND_ROUTE_LEFT;
 	QsndOutputDir[BURN_SND_QSC_OUTPUT_2] = BURN_SND_ROUTE_RIGHT;
 
+	nQscJob = BurnAsyncRegister(QscJob, NULL, BURN_ASYNC_JOIN_ACCESS);
+	if (nQscJob >= 0) {
+		pQscLag[0] = (INT16*)BurnMalloc(nBurnSoundLen * 2 * sizeof(INT16));
+		pQscLag[1] = (INT16*)BurnMalloc(nBurnSoundLen * 2 * sizeof(INT16));
+		memset(pQscLag[0], 0, nBurnSoundLen * 2 * sizeof(INT16));
+		memset(pQscLag[1], 0, nBurnSoundLen * 2 * sizeof(INT16));
+		nQscLagCur = 0;
+		bQscLagPending = 0;
+	}
+
 	QscReset();
 
 	return 0;
@@ -785,6 +1068,8 @@ INT32 QscScan(INT32 nAction)
 	struct BurnArea ba;
 	char szName[16];
 
+	BurnAsyncJoin(nQscJob);
+
 	snprintf(szName, sizeof(szName), "QSound");
 
 	ba.Data		= &chip;
@@ -798,9 +1083,31 @@ INT32 QscScan(INT32 nAction)
 
 void QscNewFrame()
 {
+	BurnAsyncJoin(nQscJob);
+
+	if (bQscLagPending) {
+		nQscLagCur ^= 1;
+		bQscLagPending = 0;
+	}
+
 	nPos = 0;
 }
 
+void QscEndFrame()
+{
+	if (pBurnSoundOut == NULL) return;
+
+	if (nQscJob < 0) {
+		QscUpdate(nBurnSoundLen);
+		return;
+	}
+
+	memcpy(pBurnSoundOut, pQscLag[nQscLagCur ^ 1], nBurnSoundLen * 2 * sizeof(INT16));
+
+	BurnAsyncKick(nQscJob);
+	bQscLagPending = 1;
+}
+
 static inline void QscSyncQsnd()
 {
 	if (pBurnSoundOut) QscUpdate(ZetTotalCycles() * nBurnSoundLen / nCpsZ80Cycles);
@@ -809,6 +1116,7 @@ static inline void QscSyncQsnd()
 void QscWrite(INT32 a, INT32 d)
 {
 	UINT16 *destination = register_map[a];
+	BurnAsyncJoin(nQscJob);
 	QscSyncQsnd();
 	if(destination)
 		*destination = d;
@@ -817,6 +1125,7 @@ void QscWrite(INT32 a, INT32 d)
 
 UINT8 QscRead()
 {
+	BurnAsyncJoin(nQscJob);
 	QscSyncQsnd();
 	return chip.ready_flag;
 }
@@ -835,26 +1144,73 @@ INT32 QscUpdate(INT32 nEnd)
 		return 0;
 	}
 
-	if (nInterpolation < 3) {
+	INT16 *pDest = ((nQscJob >= 0) ? pQscLag[nQscLagCur] : pBurnSoundOut) + (nPos << 1);
+	INT32 nAdvance = (INT32)CalcAdvance();
 
-		INT16 *pDest = pBurnSoundOut + (nPos << 1);
-		for (INT32 i = 0; i < nLen; i++) {
+	for (INT32 i = 0; i < nLen; ) {
+		// Count the DSP samples needed by as many output samples as fit in one block
+		INT32 nCount = 0, nOut = 0, nNextDelta = nDelta;
+		while (i + nOut < nLen) {
+			INT32 nStep = (nNextDelta + nAdvance) >> 12;
+			if (nOut && nCount + nStep > QSC_BLOCK) break;
+
+			nCount += nStep;
+			nNextDelta = (nNextDelta + nAdvance) & 0xfff;
+			nOut++;
+		}
+
+		INT16 nLast[2] = { chip.out[0], chip.out[1] };
+		INT32 k = 0;
+
+		render_block(nCount);
+
+		for (; nOut > 0; nOut--, i++) {
 			INT32 nLeftSample = 0, nRightSample = 0;
 			INT32 nLeftOut = 0, nRightOut = 0;
 
-			nDelta += CalcAdvance();
-			while(nDelta > 0xfff)
-			{
-				interpolate_buffer[0][0] = chip.out[0];
-				interpolate_buffer[1][0] = chip.out[1];
-
-				update_sample();
-				nDelta -= 0x1000;
+			nDelta += nAdvance;
+
+			if (nInterpolation < 3) {
+				while (nDelta > 0xfff)
+				{
+					interpolate_buffer[0][0] = nLast[0];
+					interpolate_buffer[1][0] = nLast[1];
+
+					nLast[0] = block_out[0][k];
+					nLast[1] = block_out[1][k];
+					k++;
+					nDelta -= 0x1000;
+				}
+
+				nLeftOut = interpolate_buffer[0][0] + (((nLast[0] - interpolate_buffer[0][0]) * nDelta) >> 12);
+				nRightOut = interpolate_buffer[1][0] + (((nLast[1] - interpolate_buffer[1][0]) * nDelta) >> 12);
+			} else {
+				while (nDelta > 0xfff)
+				{
+					interpolate_buffer[0][0] = interpolate_buffer[0][1];
+					interpolate_buffer[1][0] = interpolate_buffer[1][1];
+					interpolate_buffer[0][1] = interpolate_buffer[0][2];
+					interpolate_buffer[1][1] = interpolate_buffer[1][2];
+					interpolate_buffer[0][2] = interpolate_buffer[0][3];
+					interpolate_buffer[1][2] = interpolate_buffer[1][3];
+					interpolate_buffer[0][3] = block_out[0][k];
+					interpolate_buffer[1][3] = block_out[1][k];
+					k++;
+					nDelta -= 0x1000;
+				}
+
+				nLeftOut = INTERPOLATE4PS_16BIT(nDelta,
+										  interpolate_buffer[0][0],
+										  interpolate_buffer[0][1],
+										  interpolate_buffer[0][2],
+										  interpolate_buffer[0][3]);
+				nRightOut = INTERPOLATE4PS_16BIT(nDelta,
+										  interpolate_buffer[1][0],
+										  interpolate_buffer[1][1],
+										  interpolate_buffer[1][2],
+										  interpolate_buffer[1][3]);
 			}
 
-			nLeftOut = interpolate_buffer[0][0] + (((chip.out[0] - interpolate_buffer[0][0]) * nDelta) >> 12);
-			nRightOut = interpolate_buffer[1][0] + (((chip.out[1] - interpolate_buffer[1][0]) * nDelta) >> 12);
-
 			if ((QsndOutputDir[BURN_SND_QSC_OUTPUT_1] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
 				nLeftSample += (INT32)(nLeftOut * QsndGain[BURN_SND_QSC_OUTPUT_1]);
 			}
@@ -872,58 +1228,6 @@ INT32 QscUpdate(INT32 nEnd)
 			pDest[(i << 1) + 0] = BURN_SND_CLIP(nLeftSample);
 			pDest[(i << 1) + 1] = BURN_SND_CLIP(nRightSample);
 		}
-		nPos = nEnd;
-
-		return 0;
-	}
-
-	INT16 *pDest = pBurnSoundOut + (nPos << 1);
-	for (INT32 i = 0; i < nLen; i++) {
-		INT32 nLeftSample = 0, nRightSample = 0;
-		INT32 nLeftOut = 0, nRightOut = 0;
-
-		nDelta += CalcAdvance();
-		while(nDelta > 0xfff)
-		{
-			update_sample();
-			interpolate_buffer[0][0] = interpolate_buffer[0][1];
-			interpolate_buffer[1][0] = interpolate_buffer[1][1];
-			interpolate_buffer[0][1] = interpolate_buffer[0][2];
-			interpolate_buffer[1][1] = interpolate_buffer[1][2];
-			interpolate_buffer[0][2] = interpolate_buffer[0][3];
-			interpolate_buffer[1][2] = interpolate_buffer[1][3];
-			interpolate_buffer[0][3] = chip.out[0];
-			interpolate_buffer[1][3] = chip.out[1];
-			nDelta -= 0x1000;
-		}
-
-		nLeftOut = INTERPOLATE4PS_16BIT(nDelta,
-								  interpolate_buffer[0][0],
-								  interpolate_buffer[0][1],
-								  interpolate_buffer[0][2],
-								  interpolate_buffer[0][3]);
-		nRightOut = INTERPOLATE4PS_16BIT(nDelta,
-								  interpolate_buffer[1][0],
-								  interpolate_buffer[1][1],
-								  interpolate_buffer[1][2],
-								  interpolate_buffer[1][3]);
-
-		if ((QsndOutputDir[BURN_SND_QSC_OUTPUT_1] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample += (INT32)(nLeftOut * QsndGain[BURN_SND_QSC_OUTPUT_1]);
-		}
-		if ((QsndOutputDir[BURN_SND_QSC_OUTPUT_1] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample += (INT32)(nLeftOut * QsndGain[BURN_SND_QSC_OUTPUT_1]);
-		}
-
-		if ((QsndOutputDir[BURN_SND_QSC_OUTPUT_2] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample += (INT32)(nRightOut * QsndGain[BURN_SND_QSC_OUTPUT_2]);
-		}
-		if ((QsndOutputDir[BURN_SND_QSC_OUTPUT_2] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample += (INT32)(nRightOut * QsndGain[BURN_SND_QSC_OUTPUT_2]);
-		}
-
-		pDest[(i << 1) + 0] = BURN_SND_CLIP(nLeftSample);
-		pDest[(i << 1) + 1] = BURN_SND_CLIP(nRightSample);
 	}
 	nPos = nEnd;
 
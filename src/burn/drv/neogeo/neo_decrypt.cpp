@@ -504,6 +504,58 @@ inline static void cmc_xor(UINT8 *r0, UINT8 *r1,
 	}
 }
 
+struct cmc_decrypt_job
+{
+	UINT8 extra_xor;
+	UINT8* buf;
+	INT32 offset;
+	INT32 block_size;
+	INT32 clamp_size;
+	INT32* dest;
+};
+
+#define CMC_CHUNK_WORDS		0x8000
+
+// Data xor of one word, returns the word address it goes to
+static inline INT32 NeoCMCDecryptWord(const struct cmc_decrypt_job* job, INT32 rpos)
+{
+	UINT8* buf = job->buf;
+	INT32 offset = job->offset;
+	INT32 clamp_size = job->clamp_size;
+
+	cmc_xor(buf+4*rpos+0, buf+4*rpos+3, type0_t03, type0_t12, type1_t03, rpos, (rpos>>8) & 1);
+	cmc_xor(buf+4*rpos+1, buf+4*rpos+2, type0_t12, type0_t03, type1_t12, rpos, (((rpos + offset)>>16) ^ address_16_23_xor2[(rpos>>8) & 0xff]) & 1);
+
+	INT32 baser = rpos + offset;
+
+	baser ^= address_0_7_xor[(baser >> 8) & 0xff];
+	baser ^= address_16_23_xor2[(baser >> 8) & 0xff] << 16;
+	baser ^= address_16_23_xor1[baser & 0xff] << 16;
+
+	if (rpos + offset < clamp_size)
+		baser &= clamp_size - 1;
+	else
+		baser = clamp_size + (baser & ((clamp_size >> 1) - 1));
+
+	baser ^= address_8_15_xor2[baser & 0xff] << 8;
+	baser ^= address_8_15_xor1[(baser >> 16) & 0xff] << 8;
+
+	return baser ^ job->extra_xor;
+}
+
+// Data xor and destination address of one chunk of 32bit words
+static void NeoCMCDecryptChunk(INT32 chunk, void* param)
+{
+	const struct cmc_decrypt_job* job = (const struct cmc_decrypt_job*)param;
+	INT32 rpos = chunk * CMC_CHUNK_WORDS;
+	INT32 end = (rpos + CMC_CHUNK_WORDS < job->block_size) ? rpos + CMC_CHUNK_WORDS : job->block_size;
+
+	for (; rpos < end; rpos++)
+	{
+		job->dest[rpos] = NeoCMCDecryptWord(job, rpos);
+	}
+}
+
 void NeoCMCDecrypt(UINT8 extra_xor, UINT8* rom, UINT8* buf, INT32 offset, INT32 block_size, INT32 rom_size)
 {
 	INT32 clamp_size, rpos;
@@ -518,34 +570,34 @@ void NeoCMCDecrypt(UINT8 extra_xor, UINT8* rom, UINT8* buf, INT32 offset, INT32
 	// special handling for games with 6 C ROMs
 	for (clamp_size = 1 << 30; clamp_size > rom_size; clamp_size >>= 1) { }
 
-	// Data xor
-	for (rpos = 0; rpos < block_size; rpos++)
-	{
-		cmc_xor(buf+4*rpos+0, buf+4*rpos+3, type0_t03, type0_t12, type1_t03, rpos, (rpos>>8) & 1);
-		cmc_xor(buf+4*rpos+1, buf+4*rpos+2, type0_t12, type0_t03, type1_t12, rpos, (((rpos + offset)>>16) ^ address_16_23_xor2[(rpos>>8) & 0xff]) & 1);
+	struct cmc_decrypt_job job;
+	job.extra_xor = extra_xor;
+	job.buf = buf;
+	job.offset = offset;
+	job.block_size = block_size;
+	job.clamp_size = clamp_size;
+	job.dest = (INT32*)BurnMalloc(block_size * sizeof(INT32));
+
+	// No room for the address table, do it all in one pass
+	if (job.dest == NULL) {
+		for (rpos = 0; rpos < block_size; rpos++)
+		{
+			((UINT32*)rom)[NeoCMCDecryptWord(&job, rpos)] = ((UINT32*)buf)[rpos];
+		}
+
+		return;
 	}
 
-	// Address xor
+	// Data xor, and the address xor worked out in parallel
+	BurnParallelFor((block_size + CMC_CHUNK_WORDS - 1) / CMC_CHUNK_WORDS, NeoCMCDecryptChunk, &job, NULL);
+
+	// The stores stay in order, so words landing on the same address (6 C ROMs) end up as before
 	for (rpos = 0; rpos < block_size; rpos++)
 	{
-		INT32 baser = rpos + offset;
-
-		baser ^= address_0_7_xor[(baser >> 8) & 0xff];
-		baser ^= address_16_23_xor2[(baser >> 8) & 0xff] << 16;
-		baser ^= address_16_23_xor1[baser & 0xff] << 16;
-
-		if (rpos + offset < clamp_size)
-			baser &= clamp_size - 1;
-		else
-			baser = clamp_size + (baser & ((clamp_size >> 1) - 1));
-
-		baser ^= address_8_15_xor2[baser & 0xff] << 8;
-		baser ^= address_8_15_xor1[(baser >> 16) & 0xff] << 8;
-
-		baser ^= extra_xor;
-
-		((UINT32*)rom)[baser] = ((UINT32*)buf)[rpos];
+		((UINT32*)rom)[job.dest[rpos]] = ((UINT32*)buf)[rpos];
 	}
+
+	BurnFree(job.dest);
 }
 
 static UINT8 NeoCMCGetXorData(UINT8 *src, UINT8 address_bits, UINT8 address_xor)
@@ -728,6 +780,11 @@ static INT32 m1_address_scramble(INT32 address, UINT16 key)
 void neogeo_cmc50_m1_decrypt()
 {
 	UINT8 *rom = NeoZ80ROMActive;
+
+	if (BurnRomCacheLoad("neo_m1", rom, 0x80000) == 0) {
+		return;
+	}
+
 	UINT8 *buffer = (UINT8*)BurnMalloc(0x80000);
 	
 	UINT16 key = generate_cs16(rom, 0x10000);
@@ -738,4 +795,6 @@ void neogeo_cmc50_m1_decrypt()
 
 	memcpy(rom, buffer, 0x80000);
 	BurnFree(buffer);
+
+	BurnRomCacheSave("neo_m1", rom, 0x80000);
 }
@@ -716,7 +716,8 @@ static INT32 LoadRoms()
 //		nSpriteSize[nNeoActiveSlot] = 0x5000000;
 //	}
 
-	NeoSpriteROM[nNeoActiveSlot] = (UINT8*)BurnMalloc(nSpriteSize[nNeoActiveSlot] < (nNeoTileMask[nNeoActiveSlot] << 7) ? ((nNeoTileMask[nNeoActiveSlot] + 1) << 7) : nSpriteSize[nNeoActiveSlot]);
+	UINT32 nSpriteAlloc = nSpriteSize[nNeoActiveSlot] < (nNeoTileMask[nNeoActiveSlot] << 7) ? ((nNeoTileMask[nNeoActiveSlot] + 1) << 7) : nSpriteSize[nNeoActiveSlot];
+	NeoSpriteROM[nNeoActiveSlot] = (UINT8*)BurnMalloc(nSpriteAlloc);
 	if (NeoSpriteROM[nNeoActiveSlot] == NULL) {
 		return 1;
 	}
@@ -816,6 +817,9 @@ static INT32 LoadRoms()
 	// Decode sprite data
 	NeoDecodeSprites(NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]);
 
+	// The sprites are final from here on, other instances of this game can use the same pages
+	NeoSpriteROM[nNeoActiveSlot] = BurnShareRegion("neo_sprites", NeoSpriteROM[nNeoActiveSlot], nSpriteAlloc);
+
 	if (pInfo->nADPCMANum) {
 		struct BurnRomInfo ri;
 		UINT8* pADPCMData;
@@ -845,6 +849,8 @@ static INT32 LoadRoms()
 				YM2610ADPCMAROM[nNeoActiveSlot][0x00200000 + i] = n;
 			}
 		}
+
+		YM2610ADPCMAROM[nNeoActiveSlot] = BurnShareRegion("neo_adpcma", YM2610ADPCMAROM[nNeoActiveSlot], nYM2610ADPCMASize[nNeoActiveSlot]);
 	}
 
 	if (pInfo->nADPCMBNum) {
@@ -854,6 +860,8 @@ static INT32 LoadRoms()
 		}
 
 		NeoLoadADPCM(pInfo->nADPCMOffset + pInfo->nADPCMANum, pInfo->nADPCMBNum, YM2610ADPCMBROM[nNeoActiveSlot]);
+
+		YM2610ADPCMBROM[nNeoActiveSlot] = BurnShareRegion("neo_adpcmb", YM2610ADPCMBROM[nNeoActiveSlot], nYM2610ADPCMBSize[nNeoActiveSlot]);
 	} else {
 		YM2610ADPCMBROM[nNeoActiveSlot] = YM2610ADPCMAROM[nNeoActiveSlot];
 		nYM2610ADPCMBSize[nNeoActiveSlot] = nYM2610ADPCMASize[nNeoActiveSlot];
@@ -1,4 +1,10 @@
 #include "neogeo.h"
+#include "burn_simd.h"
+
+// the NEON version needs the aarch64 table lookups
+#if defined (BURN_NEON) && (defined (__aarch64__) || defined (_M_ARM64))
+ #define NEO_SPRITE_NEON
+#endif
 
 UINT8* NeoZoomROM;
 
@@ -31,7 +37,7 @@ static INT32 nNeoSpriteFrame04, nNeoSpriteFrame08;
 static INT32 nLastBPP = -1;
 
 typedef void (*RenderBankFunction)();
-static RenderBankFunction* RenderBank;
+static RenderBankFunction RenderBank;
 
 static const INT32 MAX_SPRITEBANK = 0x17d;
 static const INT32 MAX_SPRITEBANK_LINE = 0x60;
@@ -81,6 +87,135 @@ void NeoSpriteCalcLimit()
 	}
 }
 
+/*================================================================================================
+Sprite strip lines. A line of a tile is 16 4bpp pixels in two words, pixel n in nibble n of
+pTileData[nLine] | pTileData[nLine + 1] << 32. X-zoom z draws z + 1 of them, picked by
+NeoZoomXPixel[z] (the hardware's own pattern). NeoSpriteLine() unpacks a line, applies the
+zoom & flip through the shuffle in NeoZoomXShuffle[z][flip], and writes the z + 1 colour
+indices in screen order to pIndex[]. It returns a mask with a bit set per opaque pixel.
+The SSSE3/NEON versions are picked at runtime by NeoSpriteLineInit(), the C version is the
+reference and the fallback.
+================================================================================================*/
+
+static const UINT8 NeoZoomXPixel[16][16] = {
+	{  8 },
+	{  4,  8 },
+	{  4,  8, 12 },
+	{  2,  4,  8, 12 },
+	{  2,  4,  8, 12, 14 },
+	{  2,  4,  6,  8, 12, 14 },
+	{  2,  4,  6,  8, 10, 12, 14 },
+	{  0,  2,  4,  6,  8, 10, 12, 14 },
+	{  0,  2,  4,  6,  8,  9, 10, 12, 14 },
+	{  0,  2,  3,  4,  6,  8,  9, 10, 12, 14 },
+	{  0,  2,  3,  4,  6,  8,  9, 10, 12, 14, 15 },
+	{  0,  2,  3,  4,  6,  7,  8,  9, 10, 12, 14, 15 },
+	{  0,  2,  3,  4,  6,  7,  8,  9, 10, 12, 13, 14, 15 },
+	{  0,  1,  2,  3,  4,  6,  7,  8,  9, 10, 12, 13, 14, 15 },
+	{  0,  1,  2,  3,  4,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+	{  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 }
+};
+
+// source pixel for each screen column, 0x80 past the end of the strip (reads as 0 = transparent)
+static UINT8 NeoZoomXShuffle[16][2][16];
+
+typedef UINT32 (*NeoSpriteLineFunction)(const UINT32* pLine, INT32 nZoom, INT32 nFlip, UINT8* pIndex);
+static NeoSpriteLineFunction NeoSpriteLine;
+
+static inline INT32 NeoSpriteCtz(UINT32 n)
+{
+#if defined (__GNUC__)
+	return __builtin_ctz(n);
+#elif defined (_MSC_VER) && defined (BURN_SSSE3)
+	unsigned long i;
+	_BitScanForward(&i, n);
+	return i;
+#else
+	INT32 i = 0;
+	while ((n & 1) == 0) {
+		n >>= 1;
+		i++;
+	}
+	return i;
+#endif
+}
+
+static UINT32 NeoSpriteLine_C(const UINT32* pLine, INT32 nZoom, INT32 nFlip, UINT8* pIndex)
+{
+	UINT64 nLine = pLine[0] | ((UINT64)pLine[1] << 32);
+	const UINT8* pShuffle = NeoZoomXShuffle[nZoom][nFlip];
+	UINT32 nMask = 0;
+
+	for (INT32 x = 0; x <= nZoom; x++) {
+		UINT8 c = (nLine >> (pShuffle[x] << 2)) & 0x0f;
+		pIndex[x] = c;
+		nMask |= (c != 0) << x;
+	}
+
+	return nMask;
+}
+
+#if defined (BURN_SSSE3)
+
+BURN_TARGET_SSSE3 static UINT32 NeoSpriteLine_SSSE3(const UINT32* pLine, INT32 nZoom, INT32 nFlip, UINT8* pIndex)
+{
+	const __m128i nibble = _mm_set1_epi8(0x0f);
+
+	// 8 bytes -> 16 pixels, the low nibble of each byte first
+	__m128i v = _mm_set_epi32(0, 0, pLine[1], pLine[0]);
+	__m128i p = _mm_unpacklo_epi8(_mm_and_si128(v, nibble), _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+
+	p = _mm_shuffle_epi8(p, _mm_loadu_si128((const __m128i*)NeoZoomXShuffle[nZoom][nFlip]));
+	_mm_storeu_si128((__m128i*)pIndex, p);
+
+	return ~_mm_movemask_epi8(_mm_cmpeq_epi8(p, _mm_setzero_si128())) & ((2 << nZoom) - 1);
+}
+
+#endif
+
+#if defined (NEO_SPRITE_NEON)
+
+static UINT32 NeoSpriteLine_NEON(const UINT32* pLine, INT32 nZoom, INT32 nFlip, UINT8* pIndex)
+{
+	static const UINT8 bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+
+	// 8 bytes -> 16 pixels, the low nibble of each byte first
+	uint8x8_t v = vcreate_u8(pLine[0] | ((UINT64)pLine[1] << 32));
+	uint8x8x2_t z = vzip_u8(vand_u8(v, vdup_n_u8(0x0f)), vshr_n_u8(v, 4));
+	uint8x16_t p = vcombine_u8(z.val[0], z.val[1]);
+
+	p = vqtbl1q_u8(p, vld1q_u8(NeoZoomXShuffle[nZoom][nFlip]));
+	vst1q_u8(pIndex, p);
+
+	uint8x16_t m = vandq_u8(vtstq_u8(p, p), vld1q_u8(bits));
+
+	return vaddv_u8(vget_low_u8(m)) | (vaddv_u8(vget_high_u8(m)) << 8);
+}
+
+#endif
+
+static void NeoSpriteLineInit()
+{
+	for (INT32 z = 0; z < 16; z++) {
+		for (INT32 x = 0; x < 16; x++) {
+			NeoZoomXShuffle[z][0][x] = (x <= z) ? NeoZoomXPixel[z][x] : 0x80;
+			NeoZoomXShuffle[z][1][x] = (x <= z) ? NeoZoomXPixel[z][z - x] : 0x80;
+		}
+	}
+
+	NeoSpriteLine = NeoSpriteLine_C;
+
+#if defined (BURN_SSSE3)
+	if (BurnCpuHasSSSE3()) {
+		NeoSpriteLine = NeoSpriteLine_SSSE3;
+	}
+#endif
+
+#if defined (NEO_SPRITE_NEON)
+	NeoSpriteLine = NeoSpriteLine_NEON;
+#endif
+}
+
 // Include the tile rendering functions
 #include "../../dep/generated/neo_sprite_func.h"
 
@@ -205,12 +340,8 @@ INT32 NeoRenderSprites()
 				nBankXPos -= 0x200;
 			}
 
-			if (nBankXPos >= 0 && nBankXPos < (nNeoScreenWidth - nBankXZoom - 1)) {
-				RenderBank[nBankXZoom]();
-			} else {
-				if (nBankXPos >= -nBankXZoom && nBankXPos < nNeoScreenWidth) {
-					RenderBank[nBankXZoom + 16]();
-				}
+			if (nBankXPos >= -nBankXZoom && nBankXPos < nNeoScreenWidth) {
+				RenderBank();
 			}
 		}
 	}
@@ -329,6 +460,8 @@ INT32 NeoInitSprites(INT32 nSlot)
 
 	if (bBurnUseBlend) NeoBlendInit(nSlot);
 
+	NeoSpriteLineInit();
+
 	NeoTileAttribActive = NeoTileAttrib[nSlot];
 	NeoSpriteROMActive  = NeoSpriteROM[nSlot];
 	nNeoTileMaskActive  = nNeoTileMask[nSlot];
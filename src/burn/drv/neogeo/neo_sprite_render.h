@@ -1,495 +1,65 @@
 // Create a unique name for each of the functions
-#define FN(a,b,c,d) RenderBank ## a ## _ZOOM ## b ## c ## d
-#define FUNCTIONNAME(a,b,c,d) FN(a,b,c,d)
-
-#if DOCLIP == 0
- #define CLIP _NOCLIP
- #define TESTCLIP(x) 1
-#elif DOCLIP == 1
- #define CLIP _CLIP
- #define TESTCLIP(x) (nBankXPos + x) >= 0 && (nBankXPos + x) < nNeoScreenWidth
-#else
- #error illegal doclip value.
-#endif
+#define FN(a) RenderBank ## a
+#define FUNCTIONNAME(a) FN(a)
 
-#if ISOPAQUE == 0
- #define OPACITY _TRANS
- #define TESTCOLOUR(x) x
-#else
- #error illegal isopaque value
-#endif
+// One sprite strip, x-zoom and clipping are handled per line by NeoSpriteLine()
+// and the clip mask, so there's a single function per bitdepth
 
 #if BPP == 16
- #define PLOTPIXEL(a,b) if (TESTCOLOUR(b) && TESTCLIP(a)) {			\
-   	*((UINT16*)pPixel) = (UINT16)pTilePalette[b];	\
- }
+ #define PLOTPIXEL(p,c) *((UINT16*)(p)) = (UINT16)pTilePalette[c];
+ #define BLENDPIXEL(p,c) PLOTPIXEL(p,c)
 #elif BPP == 24
- #define PLOTPIXEL(a,b) if (TESTCOLOUR(b) && TESTCLIP(a)) {			\
-	UINT32 nRGB = pTilePalette[b];							\
-	if (nTransparent) nRGB = alpha_blend((pPixel[2]<<16)+(pPixel[1]<<8)+pPixel[0], nRGB, nTransparent);	\
-	pPixel[0] = (UINT8)nRGB;								\
-	pPixel[1] = (UINT8)(nRGB >> 8);							\
-	pPixel[2] = (UINT8)(nRGB >> 16);						\
+ #define PLOTPIXEL(p,c) {										\
+	UINT32 nRGB = pTilePalette[c];							\
+	(p)[0] = (UINT8)nRGB;									\
+	(p)[1] = (UINT8)(nRGB >> 8);							\
+	(p)[2] = (UINT8)(nRGB >> 16);							\
  }
-#elif BPP == 32
- #define PLOTPIXEL(a,b) if (TESTCOLOUR(b) && TESTCLIP(a)) {			\
-	if (nTransparent) *((UINT32*)pPixel) = alpha_blend(*((UINT32*)pPixel), (UINT32)pTilePalette[b], nTransparent);	\
-	else *((UINT32*)pPixel) = (UINT32)pTilePalette[b];		\
+ #define BLENDPIXEL(p,c) {										\
+	UINT32 nRGB = alpha_blend(((p)[2]<<16)+((p)[1]<<8)+(p)[0], pTilePalette[c], nTransparent);	\
+	(p)[0] = (UINT8)nRGB;									\
+	(p)[1] = (UINT8)(nRGB >> 8);							\
+	(p)[2] = (UINT8)(nRGB >> 16);							\
  }
+#elif BPP == 32
+ #define PLOTPIXEL(p,c) *((UINT32*)(p)) = (UINT32)pTilePalette[c];
+ #define BLENDPIXEL(p,c) *((UINT32*)(p)) = alpha_blend(*((UINT32*)(p)), (UINT32)pTilePalette[c], nTransparent);
 #else
  #error unsupported bitdepth specified.
 #endif
 
-#if XZOOM == 0
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);
-#elif XZOOM == 1
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	nColour >>= 16;							\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);
-#elif XZOOM == 2
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	nColour >>= 16;							\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 16;							\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);
-#elif XZOOM == 3
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 16;							\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);
-#elif XZOOM == 4
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 16;							\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 4),nColour & 0x0F);
-#elif XZOOM == 5
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 16;							\
-	PLOTPIXEL(OFFSET( 4),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 5),nColour & 0x0F);
-#elif XZOOM == 6
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 4),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 5),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 6),nColour & 0x0F);
-#elif XZOOM == 7
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 4),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 5),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 6),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 7),nColour & 0x0F);
-#elif XZOOM == 8
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 4),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 5),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 6),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 7),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 8),nColour & 0x0F);
-#elif XZOOM == 9
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 4),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 5),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 6),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 7),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 8),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 9),nColour & 0x0F);
-#elif XZOOM == 10
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 4),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 5),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 6),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 7),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 8),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 9),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(10),nColour & 0x0F);
-#elif XZOOM == 11
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 4),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 5),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 6),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 7),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 8),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 9),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET(10),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(11),nColour & 0x0F);
-#elif XZOOM == 12
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 4),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 5),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 6),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 7),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 8),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 9),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(10),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(11),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(12),nColour & 0x0F);
-#elif XZOOM == 13
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 4),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET( 5),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 6),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 7),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 8),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 9),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET(10),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(11),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(12),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(13),nColour & 0x0F);
-#elif XZOOM == 14
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 4),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 8;							\
-	PLOTPIXEL(OFFSET(5),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 6),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine + 1];			\
-	PLOTPIXEL(OFFSET( 7),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 8),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 9),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(10),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(11),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(12),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(13),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(14),nColour & 0x0F);
-#elif XZOOM == 15
- #define PLOTLINE(OFFSET,ADVANCECOLUMN)		\
-	nColour = pTileData[nLine];				\
-	PLOTPIXEL(OFFSET( 0),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 1),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 2),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 3),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 4),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 5),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 6),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 7),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour = pTileData[nLine +	1];			\
-	PLOTPIXEL(OFFSET( 8),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET( 9),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(10),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(11),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(12),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(13),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(14),nColour & 0x0F);	\
-	ADVANCECOLUMN;							\
-	nColour >>= 4;							\
-	PLOTPIXEL(OFFSET(15),nColour & 0x0F);
-#else
- #error unsupported zoom factor specified.
-#endif
-
-#define NORMALOFFSET(x) (x)
-#define MIRROROFFSET(x) (XZOOM - x)
+// Plot the opaque pixels in nMask, pulling their colours out of nIndex[]
+#define PLOTLINE(PLOT)										\
+	while (nMask) {											\
+		INT32 x = NeoSpriteCtz(nMask);						\
+		nMask &= nMask - 1;									\
+		pPixel = pTileRow + x * (BPP >> 3);					\
+		PLOT(pPixel, nIndex[x]);							\
+	}
 
 // #undef USE_SPEEDHACKS
 
-static void FUNCTIONNAME(BPP,XZOOM,CLIP,OPACITY)()
+static void FUNCTIONNAME(BPP)()
 {
 	UINT8 *pTileRow, *pPixel;
-	INT32 nColour = 0, nTransparent = 0;
+	INT32 nTransparent = 0;
 	INT32 nTileNumber, nTileAttrib = 0;
 	INT32 nTile, nLine;
 	INT32 nPrevTile;
 	INT32 nYPos;
+	UINT8 nIndex[16];
+	UINT32 nMask;
 
 	UINT8* pZoomValue = NeoZoomROM + (nBankYZoom << 8);
 
+	// Columns of the strip that are on screen
+	INT32 nFirstX = (nBankXPos < 0) ? -nBankXPos : 0;
+	INT32 nLastX = (nBankXPos + nBankXZoom >= nNeoScreenWidth) ? nNeoScreenWidth - 1 - nBankXPos : nBankXZoom;
+	if (nFirstX > nLastX) {
+		return;
+	}
+	UINT32 nClipMask = ((2 << nLastX) - 1) & ~((1 << nFirstX) - 1);
+
 	INT32 nLinesTotal = (nBankSize >= 0x20) ? 0x01FF : ((nBankSize << 4) - 1);
 	INT32 nLinesDone  = 0;
 
@@ -633,13 +203,17 @@ static void FUNCTIONNAME(BPP,XZOOM,CLIP,OPACITY)()
 						nLine ^= 0x1E;
 					}
 
-					if (nTileAttrib & 1) {							// Flip X
-						pPixel = pTileRow + XZOOM * (BPP >> 3);
-						PLOTLINE(MIRROROFFSET,pPixel -= (BPP >> 3));
+					nMask = NeoSpriteLine(pTileData + nLine, nBankXZoom, nTileAttrib & 1, nIndex) & nClipMask;
+
+#if BPP == 16
+					PLOTLINE(PLOTPIXEL);
+#else
+					if (nTransparent) {
+						PLOTLINE(BLENDPIXEL);
 					} else {
-						pPixel = pTileRow;
-						PLOTLINE(NORMALOFFSET,pPixel += (BPP >> 3));
+						PLOTLINE(PLOTPIXEL);
 					}
+#endif
 				}
 
 				pTileRow += ((BPP >> 3) * nNeoScreenWidth);
@@ -651,8 +225,7 @@ static void FUNCTIONNAME(BPP,XZOOM,CLIP,OPACITY)()
 }
 
 #undef PLOTLINE
-#undef OPACITY
+#undef BLENDPIXEL
 #undef PLOTPIXEL
-#undef TESTCOLOUR
-#undef TESTCLIP
-#undef CLIP
+#undef FUNCTIONNAME
+#undef FN
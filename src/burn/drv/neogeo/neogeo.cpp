@@ -91,6 +91,11 @@ INT32 NeoLoadSprites(INT32 nOffset, INT32 nNum, UINT8* pDest, UINT32 nSpriteSize
 			}
 		}
 
+		// Decrypted data from a previous run
+		if (BurnRomCacheLoad("neo_sprites", pDest, nSpriteSize) == 0) {
+			return 0;
+		}
+
 		// The length of the temporary memory corresponding to the CMC decryption.
 		// If the temporary memory length here is not set enough, a memory out-of-bounds error will occur during the [BurnExtLoadRom] process of [load.cpp].
 		// The temporary memory length here corresponds to the setting of [neo_run.cpp] in the ips environment.
@@ -183,6 +188,8 @@ INT32 NeoLoadSprites(INT32 nOffset, INT32 nNum, UINT8* pDest, UINT32 nSpriteSize
 
 		BurnFree(pBuf2);
 		BurnFree(pBuf1);
+
+		BurnRomCacheSave("neo_sprites", pDest, nSpriteSize);
 	} else {
 		nSpriteSize = 0;
 
@@ -747,6 +747,20 @@ static void expand_tile_gfx()
 	UINT8 *src = PGMTileROM;
 	UINT8 *dst = PGMTileROMExp;
 
+	// expanded tiles from a previous run. PGMTileROM is shrunk to the text layer before
+	// the text goes in, so the text entry must be there first: after the shrink there
+	// is nothing left to expand from.
+	UINT8 *pText = BurnRomCacheMap("pgm_text", 0x400000);
+
+	if (pText && BurnRomCacheLoad("pgm_tiles", PGMTileROMExp, (nPGMTileROMLen / 5) * 8) == 0) {
+		PGMTileROM = (UINT8*)BurnRealloc(PGMTileROM, 0x400000);
+		memcpy (PGMTileROM, pText, 0x400000);
+		BurnFree(pText);
+		return;
+	}
+
+	BurnFree(pText);
+
 	if (pPgmTileDecryptCallback) {
 		pPgmTileDecryptCallback(PGMTileROM + 0x180000, nPGMTileROMLen - 0x180000);
 	}
@@ -769,6 +783,9 @@ static void expand_tile_gfx()
 	}
 
 	PGMTileROM = (UINT8*)BurnRealloc(PGMTileROM, 0x400000);
+
+	BurnRomCacheSave("pgm_tiles", PGMTileROMExp, (nPGMTileROMLen / 5) * 8);
+	BurnRomCacheSave("pgm_text", PGMTileROM, 0x400000);
 }
 
 static void expand_colourdata()
@@ -790,6 +807,11 @@ static void expand_colourdata()
 		nPGMSPRColMaskLen -= 1;
 	}
 
+	// unpacked colour data from a previous run, the colour roms don't need loading
+	if (BurnRomCacheLoad("pgm_sprcol", PGMSPRColROM, (nPGMSPRColROMLen / 2) * 3) == 0) {
+		return;
+	}
+
 	UINT8 *tmp = (UINT8*)BurnMalloc(nPGMSPRColROMLen);
 	if (tmp == NULL) return;
 
@@ -835,6 +857,8 @@ static void expand_colourdata()
 	}
 
 	BurnFree (tmp);
+
+	BurnRomCacheSave("pgm_sprcol", PGMSPRColROM, (nPGMSPRColROMLen / 2) * 3);
 }
 
 static void ics2115_sound_irq(INT32 nState)
@@ -100,6 +100,8 @@ struct GenericTilesGfx {
     INT32 code_mask;
     UINT32 color_offset;
     UINT32 color_mask;
+    UINT8 *tile_class;     // GFX_TILE_* per tile, NULL when not classified
+    INT32 trans_pen;       // pen tile_class was built against
 };
 
 // Additional tilemap constants
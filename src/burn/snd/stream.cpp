@@ -0,0 +1,125 @@
+// FBNeo sound-streams, polyphase filters for the cubic & sinc re-sampler modes
+// (see stream.h)
+
+#include "burnint.h"
+#include "burn_sound.h"
+#include "stream.h"
+#include "burn_simd.h"
+#include <math.h>
+
+#define SINC_TAPS		16				// taps when upsampling, more when downsampling
+#define SINC_PHASES		512				// 16.16 position >> 7
+#define SINC_CUTOFF		0.90			// passband, fraction of the lower nyquist
+
+void StreamFilterInit(StreamFilter *f, INT32 quality, UINT32 rate_from, UINT32 rate_to)
+{
+	StreamFilterExit(f);
+
+	if (quality == STREAM_QUALITY_CUBIC) {
+		// same 4-point cubic as INTERPOLATE4PS_16BIT
+		f->pTable = Precalc;
+		f->nTaps = 4;
+		f->nPhaseShift = 4;
+		f->nPhaseMask = 0xfff;
+		return;
+	}
+
+	if (rate_to == 0) rate_to = 44100;
+	if (rate_from == 0) rate_from = rate_to;
+
+	// widen the kernel when downsampling, so the cutoff can drop below the
+	// source nyquist
+	double ratio = (rate_to < rate_from) ? (double)rate_to / rate_from : 1.0;
+	INT32 taps = (INT32)ceil(SINC_TAPS / ratio);
+	taps = (taps + 3) & ~3;
+	if (taps > STREAM_MAX_TAPS) taps = STREAM_MAX_TAPS;
+
+	double cutoff = 0.5 * ratio * SINC_CUTOFF;	// cycles per source sample
+
+	f->pSinc = (INT16*)BurnMalloc(SINC_PHASES * taps * sizeof(INT16));
+	f->pTable = f->pSinc;
+	f->nTaps = taps;
+	f->nPhaseShift = 7;
+	f->nPhaseMask = SINC_PHASES - 1;
+
+	for (INT32 p = 0; p < SINC_PHASES; p++) {
+		double coef[STREAM_MAX_TAPS];
+		double sum = 0;
+		INT16 *row = f->pSinc + p * taps;
+
+		for (INT32 t = 0; t < taps; t++) {
+			// distance of tap t from the output position, see StreamFilterRender()
+			double d = t - taps / 2 + 1 - (double)p / SINC_PHASES;
+			double x = 2.0 * M_PI * cutoff * d;
+			double w = 0.42 + 0.5 * cos(M_PI * d / (taps / 2)) + 0.08 * cos(2.0 * M_PI * d / (taps / 2)); // blackman
+
+			if (fabs(d) >= taps / 2) w = 0;
+
+			coef[t] = ((x == 0) ? 1.0 : sin(x) / x) * w;
+			sum += coef[t];
+		}
+
+		// unity gain at dc, rounding error goes to the largest tap
+		INT32 total = 0, largest = 0;
+		for (INT32 t = 0; t < taps; t++) {
+			row[t] = (INT16)floor(coef[t] * 16384 / sum + 0.5);
+			total += row[t];
+			if (row[t] > row[largest]) largest = t;
+		}
+		row[largest] += 16384 - total;
+	}
+}
+
+void StreamFilterExit(StreamFilter *f)
+{
+	BurnFree(f->pSinc);
+	f->pTable = NULL;
+	f->nTaps = 0;
+}
+
+static inline INT32 filter_scale(INT32 sum)
+{
+	return sum / 16384;					// rounds towards zero, like INTERPOLATE4PS_16BIT
+}
+
+// out[i] += sum(in[(pos >> 16) - taps + 1 + t] * coef[phase(pos)][t]), pos += step
+void StreamFilterRender(const StreamFilter *f, const INT16 *in, INT32 *out, INT32 samples, INT64 pos, UINT32 step)
+{
+	const INT32 taps = f->nTaps;
+	INT32 i = 0;
+
+#if defined (BURN_SSE2)
+	// two output samples per pass, 4 taps of each per madd
+	for (; i + 2 <= samples; i += 2, pos += (INT64)step * 2) {
+		INT64 pos1 = pos + step;
+		const INT16 *s0 = in + (pos >> 16) - taps + 1;
+		const INT16 *s1 = in + (pos1 >> 16) - taps + 1;
+		const INT16 *c0 = f->pTable + ((pos >> f->nPhaseShift) & f->nPhaseMask) * taps;
+		const INT16 *c1 = f->pTable + ((pos1 >> f->nPhaseShift) & f->nPhaseMask) * taps;
+		__m128i acc = _mm_setzero_si128();
+
+		for (INT32 t = 0; t < taps; t += 4) {
+			__m128i s = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(s0 + t)), _mm_loadl_epi64((const __m128i*)(s1 + t)));
+			__m128i c = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(c0 + t)), _mm_loadl_epi64((const __m128i*)(c1 + t)));
+			acc = _mm_add_epi32(acc, _mm_madd_epi16(s, c));
+		}
+
+		acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0xb1));
+
+		out[i + 0] += filter_scale(_mm_cvtsi128_si32(acc));
+		out[i + 1] += filter_scale(_mm_cvtsi128_si32(_mm_srli_si128(acc, 8)));
+	}
+#endif
+
+	for (; i < samples; i++, pos += step) {
+		const INT16 *s = in + (pos >> 16) - taps + 1;
+		const INT16 *c = f->pTable + ((pos >> f->nPhaseShift) & f->nPhaseMask) * taps;
+		INT32 sum = 0;
+
+		for (INT32 t = 0; t < taps; t++) {
+			sum += s[t] * c[t];
+		}
+
+		out[i] += filter_scale(sum);
+	}
+}
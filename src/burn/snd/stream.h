@@ -32,6 +32,33 @@
 // -- input samplerate change
 //   stream.set_rate(new_rate);
 
+// -- re-sampler quality (any time after init)
+//   stream.set_quality(STREAM_QUALITY_CUBIC);
+//   STREAM_QUALITY_DEFAULT: linear when upsampling, averaging when downsampling
+//   STREAM_QUALITY_CUBIC:   4-point cubic, same as the INTERPOLATE4PS_16BIT macros
+//   STREAM_QUALITY_SINC:    bandlimited (windowed sinc), for chips running well
+//                           above nBurnSoundRate or with lots of high harmonics
+//   note: cubic and sinc run a whole frame per channel through a polyphase
+//         filter (stream.cpp), and delay the output by half the filter length
+
+#define STREAM_QUALITY_DEFAULT	0
+#define STREAM_QUALITY_CUBIC	1
+#define STREAM_QUALITY_SINC		2
+
+#define STREAM_MAX_TAPS			64		// also the history kept between frames
+
+struct StreamFilter {
+	const INT16 *pTable;				// phases * nTaps coefficients, 16384 = 1.0
+	INT16 *pSinc;						// pTable, if we allocated it
+	INT32 nTaps;						// multiple of 4
+	INT32 nPhaseShift;					// phase = (16.16 position >> nPhaseShift) & nPhaseMask
+	INT32 nPhaseMask;
+};
+
+void StreamFilterInit(StreamFilter *f, INT32 quality, UINT32 rate_from, UINT32 rate_to);
+void StreamFilterExit(StreamFilter *f);
+void StreamFilterRender(const StreamFilter *f, const INT16 *in, INT32 *out, INT32 samples, INT64 pos, UINT32 step);
+
 struct Stream {
 	// the re-sampler section
 	UINT32 nSampleSize;
@@ -48,12 +75,18 @@ struct Stream {
 	INT16 *in_buffer[MAX_CHANNELS]; // resampler in-buffers
 	INT32 out_buffer_size;
 
+	INT32 nQuality;
+	StreamFilter filter;
+	INT32 *filter_buffer[2]; // filtered l/r, nSampleRateTo samples each, once a filter is chosen
+
 	void init(INT32 rate_from, INT32 rate_to, INT32 channels, bool add_to_stream, void (*update_stream)(INT16 **, INT32 )) {
 		nFractionalPosition = 0;
 		bAddStream = add_to_stream;
 		nSampleRateFrom = rate_from;
 		nSampleRateTo = rate_to;
 		nChannels = channels;
+		nQuality = STREAM_QUALITY_DEFAULT;
+		memset(&filter, 0, sizeof(filter));
 		set_rate_internal(rate_from);
 
 		stream_init(update_stream);
@@ -66,9 +99,28 @@ struct Stream {
 		nSampleRateFrom = rate_from;
 		nSampleSize = (UINT64)nSampleRateFrom * (1 << 16) / ((nSampleRateTo == 0) ? 44100 : nSampleRateTo);
 		nSampleSize_Otherway = (UINT64)((nSampleRateTo == 0) ? 44100 : nSampleRateTo) * (1 << 16) / ((nSampleRateFrom == 0) ? 44100 : nSampleRateFrom);
+
+		// the sinc cutoff depends on the rates
+		if (nQuality != STREAM_QUALITY_DEFAULT) StreamFilterInit(&filter, nQuality, nSampleRateFrom, nSampleRateTo);
+	}
+	void set_quality(INT32 quality) {
+		nQuality = quality;
+
+		if (nQuality == STREAM_QUALITY_DEFAULT) {
+			StreamFilterExit(&filter);
+		} else {
+			StreamFilterInit(&filter, nQuality, nSampleRateFrom, nSampleRateTo);
+
+			for (INT32 i = 0; i < 2; i++) {
+				if (filter_buffer[i] == NULL) {
+					filter_buffer[i] = (INT32*)BurnMalloc(((nSampleRateTo == 0) ? 44100 : nSampleRateTo) * sizeof(INT32));
+				}
+			}
+		}
 	}
 	void exit() {
 		nSampleSize = nFractionalPosition = 0;
+		StreamFilterExit(&filter);
 		stream_exit();
 	}
 	INT32 samples_to_host(INT32 samples) {
@@ -84,12 +136,16 @@ struct Stream {
 		for (INT32 i = 0; i < nChannels; i++) {
 			// prepare the in-buffers
 			in_buffer[i] = soundbuf[i];
-			// make room for previous frame's "carry-over" sample (aka in_buffer[-1])
-			in_buffer[i]++;
+			// make room for previous frame's "carry-over" samples (in_buffer[-1] and
+			// further back, for the filters)
+			in_buffer[i] += STREAM_MAX_TAPS;
 		}
 		out_buffer_size = samples_to_source(samples);
 
-		if (nSampleRateFrom == nSampleRateTo) {
+		if (nQuality != STREAM_QUALITY_DEFAULT) {
+			// cubic / sinc filters
+			filtered(out_buffer, samples);
+		} else if (nSampleRateFrom == nSampleRateTo) {
 			// stream(s) running at same samplerate as host
 			samplesample(out_buffer, samples);
 		} else if (nSampleRateFrom > nSampleRateTo) {
@@ -103,12 +159,13 @@ struct Stream {
 		// figure out if we have extra whole samples
 		nPosition = out_buffer_size - (nFractionalPosition >> 16);
 
-		// 1) take the last processed sample and store it into in_buffer[-1]
-		// so that interpolation can be carried out between frames.
+		// 1) take the last processed samples and store them into in_buffer[-1]
+		// (and back to in_buffer[-STREAM_MAX_TAPS]) so that interpolation can be
+		// carried out between frames.
 		// 2) store the extra whole samples at in_buffer[0+], returning the
 		// number of whole samples in nPosition (stream-buffer position)
 		for (INT32 ch = 0; ch < nChannels; ch++) {
-			for (INT32 i = -1; i < nPosition; i++) {
+			for (INT32 i = -STREAM_MAX_TAPS; i < nPosition; i++) {
 				in_buffer[ch][i] = in_buffer[ch][i + (nFractionalPosition >> 16)];
 			}
 		}
@@ -277,6 +334,37 @@ struct Stream {
 		}
 	}
 
+	void filtered(INT16 *out_buffer, INT32 samples) {
+		memset(filter_buffer[0], 0, samples * sizeof(INT32));
+		memset(filter_buffer[1], 0, samples * sizeof(INT32));
+
+		for (INT32 ch = 0; ch < nChannels; ch++) {
+			StreamFilterRender(&filter, in_buffer[ch], filter_buffer[ch & 1], samples, nFractionalPosition, nSampleSize);
+		}
+
+		nFractionalPosition += (INT64)nSampleSize * samples;
+
+		for (INT32 i = 0; i < samples; i++, out_buffer += 2) {
+			INT32 sample_l = filter_buffer[0][i];
+			INT32 sample_r = (nChannels == 1) ? sample_l : filter_buffer[1][i]; // duplicate left ch. for MONO
+
+			// apply volume, check for clipping and mix-down
+			sample_l = BURN_SND_CLIP(sample_l * volume);
+			sample_r = BURN_SND_CLIP(sample_r * volume);
+
+			sample_l = ((route & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) ? sample_l : 0;
+			sample_r = ((route & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) ? sample_r : 0;
+
+			if (bAddStream) {
+				out_buffer[0] = BURN_SND_CLIP(out_buffer[0] + sample_l);
+				out_buffer[1] = BURN_SND_CLIP(out_buffer[1] + sample_r);
+			} else {
+				out_buffer[0] = sample_l;
+				out_buffer[1] = sample_r;
+			}
+		}
+	}
+
 	// -[ stream/streambuffer handling section ]-
 	INT16 *soundbuf[MAX_CHANNELS];
 	double volume;
@@ -312,9 +400,13 @@ struct Stream {
 		pUpdateStream = update_stream;
 
 		for (INT32 ch = 0; ch < nChannels; ch++) {
-			soundbuf[ch] = (INT16*)BurnMalloc(nSampleRateFrom * 2);
+			soundbuf[ch] = (INT16*)BurnMalloc((nSampleRateFrom + STREAM_MAX_TAPS) * 2);
+			memset(soundbuf[ch], 0, STREAM_MAX_TAPS * 2); // history
 		}
 
+		// only the filtered qualities need these, see set_quality()
+		filter_buffer[0] = filter_buffer[1] = NULL;
+
 		nPosition = 0;
 
 		set_volume(1.00);
@@ -326,6 +418,8 @@ struct Stream {
 		for (INT32 ch = 0; ch < nChannels; ch++) {
 			BurnFree(soundbuf[ch]);
 		}
+		BurnFree(filter_buffer[0]);
+		BurnFree(filter_buffer[1]);
 		buffered = 0;
 
 		pUpdateStream = NULL;
@@ -368,8 +462,8 @@ struct Stream {
 		INT16 *mix[MAX_CHANNELS];
 
 		for (INT32 i = 0; i < nChannels; i++) {
-			// NOTE: soundbuf[ch][0] = upsampler internal use! (see notes in upsample())
-			mix[i] = soundbuf[i] + 1 + nPosition;
+			// NOTE: soundbuf[ch][0 - STREAM_MAX_TAPS-1] = re-sampler history! (see render())
+			mix[i] = soundbuf[i] + STREAM_MAX_TAPS + nPosition;
 		}
 		pUpdateStream(mix, samples);
 
@@ -31,7 +31,7 @@ Offset 0:
 
 #include "burnint.h"
 #include "t6w28.h"
-#include "burn_sound.h"  // Include burn_sound.h for INTERPOLATE4PS_16BIT macro
+#include "stream.h"
 
 static int   m_sample_rate;
 static int   m_vol_table[16];    /* volume table         */
@@ -48,47 +48,17 @@ static INT32 m_count[8];
 static INT32 m_output[8];
 static bool  m_enabled;
 
-// for resampling
-static UINT64 nSampleSize;
-static INT32 nFractionalPosition;
-static INT32 nPosition;
 static INT32 our_freq = 0;
 
-static double our_vol;
-static INT32 add_stream;
-
-// for stream-sync
-static INT16 *soundbuf_l = NULL;
-static INT16 *soundbuf_r = NULL;
-static INT32 (*pCPUTotalCycles)() = NULL;
-static UINT32  nDACCPUMHZ = 0;
-
-// Streambuffer handling
-static INT32 SyncInternal()
-{
-	return (INT32)(float)(nBurnSoundLen * (pCPUTotalCycles() / (nDACCPUMHZ / (nBurnFPS / 100.0000))));
-}
+static Stream stream;
 
 static void t6w28_update(INT16 *outputsl, INT16 *outputsr, int samples);
 
-static void UpdateStream(INT32 samples_len)
+static void t6w28_stream_update(INT16 **streams, INT32 samples)
 {
-	if (!pBurnSoundOut) return;
-    if (samples_len > nBurnSoundLen) samples_len = nBurnSoundLen;
-
-	INT64 nSamplesNeeded = ((((((our_freq * 1000) / nBurnFPS) * samples_len) / nBurnSoundLen)) / 10) + 1;
-	if (nBurnSoundRate < 44100) nSamplesNeeded += 2; // so we don't end up with negative nPosition below
-
-    nSamplesNeeded -= nPosition;
-    if (nSamplesNeeded <= 0) return;
-
-	INT16 *mixl = soundbuf_l + 5 + nPosition;
-	INT16 *mixr = soundbuf_r + 5 + nPosition;
-    t6w28_update(mixl, mixr, nSamplesNeeded);
-    nPosition += nSamplesNeeded;
+	t6w28_update(streams[0], streams[1], samples);
 }
 
-
 #define MAX_OUTPUT 0x7fff
 
 #define STEP 0x10000
@@ -99,7 +69,7 @@ void t6w28Write(INT32 offset, UINT8 data)
 
 
 	/* update the output buffer before changing the registers */
-	UpdateStream(SyncInternal());
+	stream.update();
 
 	offset &= 1;
 
@@ -312,56 +282,7 @@ static void t6w28_update(INT16 *outputsl, INT16 *outputsr, int samples)
 
 void t6w28Update(INT16 *buffer, INT32 samples_len)
 {
-	INT64 nSamplesNeeded = ((((((our_freq * 1000) / nBurnFPS) * samples_len) / nBurnSoundLen)) / 10) + 1;
-	if (nBurnSoundRate < 44100) nSamplesNeeded += 2; // so we don't end up with negative nPosition below
-
-	UpdateStream(nBurnSoundLen);
-
-	INT16 *pBufL = soundbuf_l + 5;
-	INT16 *pBufR = soundbuf_r + 5;
-
-	//-4 -3 -2 -1  0
-	//+1 +2 +3 +4 +5
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < (samples_len << 1); i += 2, nFractionalPosition += nSampleSize) {
-		INT32 nLeftSample[4] = {0, 0, 0, 0};
-		INT32 nRightSample[4] = {0, 0, 0, 0};
-		INT32 nTotalLeftSample;
-		INT32 nTotalRightSample;
-
-		nLeftSample[0] += (INT32)(pBufL[(nFractionalPosition >> 16) - 3]);
-		nLeftSample[1] += (INT32)(pBufL[(nFractionalPosition >> 16) - 2]);
-		nLeftSample[2] += (INT32)(pBufL[(nFractionalPosition >> 16) - 1]);
-		nLeftSample[3] += (INT32)(pBufL[(nFractionalPosition >> 16) - 0]);
-
-		nRightSample[0] += (INT32)(pBufR[(nFractionalPosition >> 16) - 3]);
-		nRightSample[1] += (INT32)(pBufR[(nFractionalPosition >> 16) - 2]);
-		nRightSample[2] += (INT32)(pBufR[(nFractionalPosition >> 16) - 1]);
-		nRightSample[3] += (INT32)(pBufR[(nFractionalPosition >> 16) - 0]);
-
-		nTotalLeftSample  = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3]);
-		nTotalLeftSample  = BURN_SND_CLIP(nTotalLeftSample * our_vol);
-
-		nTotalRightSample  = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3]);
-		nTotalRightSample  = BURN_SND_CLIP(nTotalRightSample * our_vol);
-
-		if (!add_stream) buffer[i + 0] = buffer[i + 1] = 0;
-
-		buffer[i + 0] = BURN_SND_CLIP(buffer[i + 0] + nTotalLeftSample);
-		buffer[i + 1] = BURN_SND_CLIP(buffer[i + 1] + nTotalRightSample);
-	}
-
-	if (samples_len >= nBurnSoundLen) {
-		INT32 nExtraSamples = nSamplesNeeded - (nFractionalPosition >> 16);
-
-		for (INT32 i = -4; i < nExtraSamples; i++) {
-			pBufL[i] = pBufL[(nFractionalPosition >> 16) + i];
-			pBufR[i] = pBufR[(nFractionalPosition >> 16) + i];
-		}
-
-		nFractionalPosition &= 0xFFFF;
-
-		nPosition = nExtraSamples;
-	}
+	stream.render(buffer, samples_len);
 }
 
 
@@ -439,29 +360,20 @@ void t6w28Init(INT32 clock, INT32 (*pCPUCyclesCB)(), INT32 nCpuMHZ, INT32 nAdd)
 	t6w28Reset();
 
 	our_freq = m_sample_rate;
-	our_vol = 1.00;
-	add_stream = nAdd;
-
-	pCPUTotalCycles = pCPUCyclesCB;
-	nDACCPUMHZ = nCpuMHZ;
-
-	soundbuf_l = (INT16*)BurnMalloc(our_freq * 2);
-	soundbuf_r = (INT16*)BurnMalloc(our_freq * 2);
 
-	if (nBurnSoundRate) nSampleSize = (UINT64)((UINT64)our_freq * (1 << 16)) / nBurnSoundRate;
-	nPosition = 0;
-	nFractionalPosition = 0;
+	stream.init(our_freq, nBurnSoundRate, 2, nAdd, t6w28_stream_update);
+	stream.set_buffered(pCPUCyclesCB, nCpuMHZ);
+	stream.set_quality(STREAM_QUALITY_CUBIC);
 }
 
 void t6w28Exit()
 {
-	BurnFree(soundbuf_l);
-	BurnFree(soundbuf_r);
+	stream.exit();
 }
 
 void t6w28SetVolume(double vol)
 {
-	our_vol = vol;
+	stream.set_volume(vol);
 }
 
 void t6w28Enable(bool enable)
@@ -25,6 +25,9 @@ void StateRewindReset();
 void StateRewindDoFrame(INT32 bDoRewind, INT32 bDoCancel, INT32 bIsPaused);
 
 /* Run-A-head */
+#define RUNAHEAD_MAX_FRAMES		4
+extern INT32 nRunAheadFrames;	// burn.cpp, frames to run ahead when bRunAhead is set
+INT32 StateRunAheadFrames();	// nRunAheadFrames, clamped to 1 - RUNAHEAD_MAX_FRAMES
 void StateRunAheadInit();
 void StateRunAheadExit();
 void StateRunAheadSave();
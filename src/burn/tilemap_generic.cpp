@@ -4,6 +4,14 @@
 #define MAX_GFXNUM
 #define MAX_SPLIT_CATEGORY 16
 
+// tile info kept by the cached mode, indexed by row * mwidth + col
+struct GenericTilemapCacheTile {
+	UINT32 code;
+	UINT32 flags;
+	UINT16 gfx;
+	UINT16 category;
+};
+
 struct GenericTilemap {
 	UINT8 initialized;
 	INT32 (*pScan)(INT32 col, INT32 row);
@@ -28,6 +36,10 @@ struct GenericTilemap {
 	UINT8 *dirty_tiles;			// 1 skip, 0 draw
 	INT32 dirty_tiles_enable;
 	UINT8 *skip_tiles[MAX_GFX];
+	INT32 cache_enable;
+	UINT16 *cache_pixmap;		// whole tilemap pre-rendered (pen + color)
+	UINT8 *cache_pens;			// pens of cache_pixmap, for the transparency tables
+	GenericTilemapCacheTile *cache_tiles;
 };
 
 static GenericTilemap maps[MAX_TILEMAPS];
@@ -127,6 +139,20 @@ void GenericTilemapSetGfx(INT32 num, UINT8 *gfxbase, INT32 depth, INT32 tile_wid
 
 	GenericTilesGfx *ptr = &GenericGfxData[num];
 
+	// a different bank layout makes the tile classification stale
+	if (ptr->tile_class && (ptr->gfxbase != gfxbase || ptr->gfx_len != gfxlen || ptr->width != tile_width || ptr->height != tile_height)) {
+		BurnFree(ptr->tile_class);
+	}
+
+	// cached tilemaps hold pixels from this bank, redraw them if anything changed
+	if (ptr->gfxbase != gfxbase || ptr->depth != depth || ptr->gfx_len != gfxlen || ptr->color_offset != color_offset || ptr->color_mask != color_mask) {
+		for (INT32 i = 0; i < MAX_TILEMAPS; i++) {
+			if (maps[i].cache_enable) {
+				memset (maps[i].dirty_tiles, 1, maps[i].mwidth * maps[i].mheight);
+			}
+		}
+	}
+
 	ptr->gfxbase = gfxbase;
 	ptr->depth = depth;
 	ptr->width = tile_width;
@@ -163,6 +189,9 @@ void GenericTilemapExit()
 			if (cur_map->transparent[j]) BurnFree(cur_map->transparent[j]);
 		}
 		if (cur_map->dirty_tiles) BurnFree(cur_map->dirty_tiles);
+		if (cur_map->cache_pixmap) BurnFree(cur_map->cache_pixmap);
+		if (cur_map->cache_pens) BurnFree(cur_map->cache_pens);
+		if (cur_map->cache_tiles) BurnFree(cur_map->cache_tiles);
 
 		for (INT32 j = 0; j < MAX_GFX; j++) {
 			if (cur_map->skip_tiles[j]) {
@@ -171,6 +200,12 @@ void GenericTilemapExit()
 		}
 	}
 
+	for (INT32 i = 0; i < MAX_GFX; i++) {
+		if (GenericGfxData[i].tile_class) {
+			BurnFree(GenericGfxData[i].tile_class);
+		}
+	}
+
 	// wipe everything else out
 	memset (maps, 0, sizeof(maps));
 	memset (GenericGfxData, 0, sizeof(GenericGfxData));
@@ -349,6 +384,15 @@ void GenericTilemapBuildSkipTable(INT32 which, INT32 gfxnum, INT32 transparent)
 		cur_map->skip_tiles[gfxnum] = (UINT8*)BurnMalloc(gfx->gfx_len / one_tile);
 	}
 
+	// the gfx bank was already classified against this pen
+	if (gfx->tile_class && gfx->trans_pen == transparent) {
+		for (INT32 i = 0; i < gfx->gfx_len / one_tile; i++) {
+			cur_map->skip_tiles[gfxnum][i] = (gfx->tile_class[i] == GFX_TILE_TRANSPARENT);
+		}
+
+		return;
+	}
+
 	UINT8 *gfxptr = gfx->gfxbase;
 
 	for (UINT32 i = 0; i < gfx->gfx_len / one_tile; i++)
@@ -788,6 +832,43 @@ void GenericTilemapUseDirtyTiles(INT32 which)
 	cur_map->dirty_tiles_enable = 1;
 }
 
+void GenericTilemapUseCache(INT32 which)
+{
+#if defined FBNEO_DEBUG
+	if (which >= MAX_TILEMAPS) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapUseCache(%d) called with impossible tilemap!\n"), which);
+		return;
+	}
+#endif
+
+	cur_map = &maps[which];
+
+#if defined FBNEO_DEBUG
+	if (cur_map->initialized == 0) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapUseCache(%d) called without initialized tilemap!\n"), which);
+		return;
+	}
+#endif
+
+	if (cur_map->dirty_tiles == NULL) {
+		GenericTilemapUseDirtyTiles(which);
+	}
+
+	INT32 tiles = cur_map->mwidth * cur_map->mheight;
+	INT32 pixels = tiles * cur_map->twidth * cur_map->theight;
+
+	// the tilemap dimensions are fixed at init, so a repeated call keeps the buffers
+	if (cur_map->cache_pixmap == NULL) {
+		cur_map->cache_pixmap = (UINT16*)BurnMalloc(pixels * sizeof(UINT16));
+		cur_map->cache_pens = (UINT8*)BurnMalloc(pixels);
+		cur_map->cache_tiles = (GenericTilemapCacheTile*)BurnMalloc(tiles * sizeof(GenericTilemapCacheTile));
+	}
+
+	memset (cur_map->dirty_tiles, 1, tiles); // render everything on the first draw
+
+	cur_map->cache_enable = 1;
+}
+
 void GenericTilemapSetTileDirty(INT32 which, UINT32 offset)
 {
 #if defined FBNEO_DEBUG
@@ -866,6 +947,239 @@ INT32 GenericTilemapGetTileDirty(INT32 which, UINT32 offset)
 	return cur_map->dirty_tiles[offset % (cur_map->mwidth * cur_map->mheight)];
 }
 
+// Uses the tilemap's skip table when one was built, otherwise the classification
+// made by GenericTilesSetGfx if it was done against this tilemap's transparent pen
+static inline INT32 GenericTilemapTileClass(INT32 gfxnum, INT32 code)
+{
+	if ((cur_map->flags & TMAP_TRANSPARENT) == 0) {
+		return GFX_TILE_MIXED;
+	}
+
+	if (cur_map->skip_tiles[gfxnum] && cur_map->skip_tiles[gfxnum][code]) {
+		return GFX_TILE_TRANSPARENT;
+	}
+
+	GenericTilesGfx *gfx = &GenericGfxData[gfxnum];
+
+	// split and masked tilemaps decide transparency per category, not per pen
+	if (gfx->tile_class && gfx->trans_pen == cur_map->transcolor && (cur_map->flags & (TMAP_TRANSMASK | TMAP_TRANSSPLIT)) == 0) {
+		return gfx->tile_class[code];
+	}
+
+	return GFX_TILE_MIXED;
+}
+
+// Render the dirty tiles of cur_map into its cache, with the tile flips applied
+static void GenericTilemapCacheUpdate(INT32 which)
+{
+	struct GenericTilemapCallbackStruct sTileData;
+
+	INT32 wide = cur_map->mwidth * cur_map->twidth;
+
+	for (UINT32 row = 0; row < cur_map->mheight; row++)
+	{
+		for (UINT32 col = 0; col < cur_map->mwidth; col++)
+		{
+			INT32 offset = cur_map->pScan(col, row);
+
+			if (cur_map->dirty_tiles[offset] == 0) continue;
+			cur_map->dirty_tiles[offset] = 0;
+
+			sTileData.category = 0;
+
+			cur_map->pTile(offset, &sTileData);
+
+			GenericTilemapCacheTile *info = &cur_map->cache_tiles[row * cur_map->mwidth + col];
+			GenericTilesGfx *gfx = &GenericGfxData[sTileData.gfx];
+
+#if defined FBNEO_DEBUG
+			if (gfx->gfxbase == NULL) {
+				bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] not initialized!\n"), which, sTileData.gfx);
+				info->flags = TILE_SKIP;
+				continue;
+			}
+
+			if (((UINT32)gfx->width != cur_map->twidth) || ((UINT32)gfx->height != cur_map->theight))
+			{
+				bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] tile dimensions (%dx%d do not match tilemap tile dimensions (%dx%d)!\n"), which, sTileData.gfx, gfx->width, gfx->height, cur_map->twidth, cur_map->theight);
+				info->flags = TILE_SKIP;
+				continue;
+			}
+#endif
+
+			sTileData.code %= gfx->code_mask;
+
+			info->code = sTileData.code;
+			info->flags = sTileData.flags;
+			info->gfx = sTileData.gfx;
+			info->category = sTileData.category;
+
+			UINT32 color = ((sTileData.color & gfx->color_mask) << gfx->depth) + gfx->color_offset;
+
+			INT32 flipx = sTileData.flags & TILE_FLIPX;
+			INT32 flipy = sTileData.flags & TILE_FLIPY;
+
+			UINT8 *src = gfx->gfxbase + (sTileData.code * cur_map->twidth * cur_map->theight);
+			INT32 pos = (row * cur_map->theight * wide) + (col * cur_map->twidth);
+
+			for (UINT32 yy = 0; yy < cur_map->theight; yy++, pos += wide)
+			{
+				UINT8 *s = src + (flipy ? (cur_map->theight - 1 - yy) : yy) * cur_map->twidth;
+				UINT16 *dst = cur_map->cache_pixmap + pos;
+				UINT8 *pen = cur_map->cache_pens + pos;
+
+				for (UINT32 xx = 0; xx < cur_map->twidth; xx++)
+				{
+					pen[xx] = s[flipx ? (cur_map->twidth - 1 - xx) : xx];
+					dst[xx] = pen[xx] + color;
+				}
+			}
+		}
+	}
+}
+
+// Transparency table for one cached tile, NULL if the tile is not drawn at all
+static UINT8 *GenericTilemapCacheTrans(INT32 tile, INT32 category_or, INT32 opaque, INT32 opaque2, INT32 tgroup)
+{
+	GenericTilemapCacheTile *info = &cur_map->cache_tiles[tile];
+	INT32 tile_class = GFX_TILE_MIXED;
+
+	if (opaque == 0)
+	{
+		tile_class = GenericTilemapTileClass(info->gfx, info->code);
+
+		if (tile_class == GFX_TILE_TRANSPARENT && (info->flags & TILE_OPAQUE) == 0) return NULL;
+
+		if (info->flags & TILE_SKIP) return NULL;
+
+		if (info->flags & TILE_GROUP_ENABLE) {
+			if ((INT32)((info->flags >> 16) & 0xff) != tgroup) return NULL;
+		}
+	}
+
+	if (opaque || opaque2 || (info->flags & TILE_OPAQUE) || tile_class == GFX_TILE_OPAQUE) {
+		return cur_map->transparent[0x100];
+	}
+
+	UINT32 category = (cur_map->flags & TMAP_TRANSSPLIT) ?
+		((info->category * 2) | category_or) :
+		(info->category | category_or);
+
+	if (category && (cur_map->flags & TMAP_TRANSMASK)) {
+		if (cur_map->transparent[category] == NULL) {
+			category = 0;
+		}
+	}
+
+	return cur_map->transparent[category];
+}
+
+// Compose the visible area out of the cache. The screen pixel (x, y) shows tilemap pixel
+// (x + scrollx - xoffset, y + scrolly - yoffset), where scrollx also adds the scroll of the
+// row and scrolly the scroll of the column, and x / y are mirrored first on a flipped tilemap.
+// Line scroll (more scroll rows than tile rows) follows the uncached line scroll path instead:
+// the line is y + scrolly + yoffset and its scroll replaces scrollx, flips included.
+static void GenericTilemapCacheDraw(INT32 which, UINT16 *Bitmap, INT32 minx, INT32 maxx, INT32 miny, INT32 maxy, INT32 priority, INT32 category_or, INT32 opaque, INT32 opaque2, INT32 tgroup, INT32 x_offset, INT32 y_offset)
+{
+	GenericTilemapCacheUpdate(which);
+
+	INT32 wide = cur_map->mwidth * cur_map->twidth;
+	INT32 high = cur_map->mheight * cur_map->theight;
+	INT32 step = (cur_map->flags & TMAP_FLIPX) ? -1 : 1;
+
+	for (INT32 y = miny; y < maxy; y++)
+	{
+		UINT16 *dest = Bitmap + y * nScreenWidth;
+		UINT8 *prio = pPrioDraw + y * nScreenWidth;
+
+		INT32 fy = (cur_map->flags & TMAP_FLIPY) ? ((nScreenHeight - 1) - y) : y;
+		INT32 fx = (cur_map->flags & TMAP_FLIPX) ? ((nScreenWidth - 1) - minx) : minx;
+
+		INT32 sy, scrollx;
+
+		if ((cur_map->scrollx_table != NULL) && (cur_map->scroll_rows > cur_map->mheight)) {
+			sy = (((fy + cur_map->scrolly + y_offset) % high) + high) % high;
+			scrollx = cur_map->scrollx_table[(sy * cur_map->scroll_rows) / high] - x_offset;
+
+			// flipped, the uncached line scroll mirrors the line inside its tile row
+			if (cur_map->flags & TMAP_FLIPY) {
+				sy += (cur_map->theight - 1) - 2 * (sy % cur_map->theight);
+			}
+		} else {
+			sy = (((fy + cur_map->scrolly - y_offset) % high) + high) % high;
+			scrollx = cur_map->scrollx - x_offset;
+			if (cur_map->scroll_rows > 1) {
+				scrollx += cur_map->scrollx_table[((sy / cur_map->theight) * cur_map->scroll_rows) / cur_map->mheight];
+			}
+		}
+
+		INT32 sx = (((fx + scrollx) % wide) + wide) % wide;
+
+		if (cur_map->scroll_cols > 1)
+		{
+			// the source row changes with every column, go pixel by pixel
+			INT32 last_tile = -1;
+			UINT8 *trans_ptr = NULL;
+
+			for (INT32 x = minx; x < maxx; x++)
+			{
+				INT32 csy = (((fy + cur_map->scrolly + cur_map->scrolly_table[(sx * cur_map->scroll_cols) / wide] - y_offset) % high) + high) % high;
+				INT32 tile = (csy / cur_map->theight) * cur_map->mwidth + (sx / cur_map->twidth);
+
+				if (tile != last_tile) {
+					trans_ptr = GenericTilemapCacheTrans(tile, category_or, opaque, opaque2, tgroup);
+					last_tile = tile;
+				}
+
+				INT32 pos = csy * wide + sx;
+
+				if (trans_ptr && trans_ptr[cur_map->cache_pens[pos]] == 0) {
+					dest[x] = cur_map->cache_pixmap[pos];
+					prio[x] = priority | (prio[x] & GenericTilesPRIMASK);
+				}
+
+				sx += step;
+				if (sx == wide) sx = 0;
+				if (sx < 0) sx = wide - 1;
+			}
+
+			continue;
+		}
+
+		INT32 tile_row = (sy / cur_map->theight) * cur_map->mwidth;
+		UINT16 *src = cur_map->cache_pixmap + sy * wide;
+		UINT8 *pens = cur_map->cache_pens + sy * wide;
+
+		// one span per tile, tiles never straddle the wrap around
+		for (INT32 x = minx; x < maxx; )
+		{
+			INT32 tx = sx % cur_map->twidth;
+			INT32 span = (step < 0) ? (tx + 1) : (cur_map->twidth - tx);
+			if (span > maxx - x) span = maxx - x;
+
+			UINT8 *trans_ptr = GenericTilemapCacheTrans(tile_row + (sx / cur_map->twidth), category_or, opaque, opaque2, tgroup);
+
+			if (trans_ptr)
+			{
+				for (INT32 i = 0; i < span; i++)
+				{
+					INT32 pos = sx + i * step;
+
+					if (trans_ptr[pens[pos]] == 0) {
+						dest[x + i] = src[pos];
+						prio[x + i] = priority | (prio[x + i] & GenericTilesPRIMASK);
+					}
+				}
+			}
+
+			x += span;
+			sx += span * step;
+			if (sx >= wide) sx -= wide;
+			if (sx < 0) sx += wide;
+		}
+	}
+}
+
 void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 priority_mask)
 {
 #if defined FBNEO_DEBUG
@@ -930,6 +1244,11 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 	INT32 x_offset = cur_map->xoffset[(cur_map->flags & TMAP_FLIPX) ? 1 : 0];
 	INT32 y_offset = cur_map->yoffset[(cur_map->flags & TMAP_FLIPY) ? 1 : 0];
 
+	if (cur_map->cache_enable) {
+		GenericTilemapCacheDraw(which, Bitmap, minx, maxx, miny, maxy, priority, category_or, opaque, opaque2, tgroup, x_offset, y_offset);
+		return;
+	}
+
 	struct GenericTilemapCallbackStruct sTileData;
 
 	// column (less than tile size) and line scroll
@@ -1004,9 +1323,10 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 
 				if (opaque == 0)
 				{
-					if (cur_map->skip_tiles[sTileData.gfx] && (cur_map->flags & TMAP_TRANSPARENT))	// skip this tile
-						if (cur_map->skip_tiles[sTileData.gfx][sTileData.code])
-							continue; 
+					INT32 tile_class = GenericTilemapTileClass(sTileData.gfx, sTileData.code);
+
+					if (tile_class == GFX_TILE_TRANSPARENT && (sTileData.flags & TILE_OPAQUE) == 0) continue; // skip this tile, unless the driver forces it opaque
+					if (tile_class == GFX_TILE_OPAQUE) sTileData.flags |= TILE_OPAQUE; // nothing to mask
 
 					if (sTileData.flags & TILE_SKIP) continue; // skip this tile
 
@@ -1065,6 +1385,10 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 			INT32 scry = scrolly % (cur_map->theight);
 			INT32 scrx = scrollx % (cur_map->twidth);
 
+			if (cur_map->flags & TMAP_FLIPX) {
+				scrx = -scrx; // the tiles run right to left, mirror the fine scroll once for the whole line
+			}
+
 			INT32 sy = y;
 			if (cur_map->flags & TMAP_FLIPY) {
 				sy = ((maxy - miny) - 1) - sy;
@@ -1117,9 +1441,10 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 
 				if (opaque == 0)
 				{
-					if (cur_map->skip_tiles[sTileData.gfx] && (cur_map->flags & TMAP_TRANSPARENT))	// skip this tile
-						if (cur_map->skip_tiles[sTileData.gfx][sTileData.code])
-							continue; 
+					INT32 tile_class = GenericTilemapTileClass(sTileData.gfx, sTileData.code);
+
+					if (tile_class == GFX_TILE_TRANSPARENT && (sTileData.flags & TILE_OPAQUE) == 0) continue; // skip this tile, unless the driver forces it opaque
+					if (tile_class == GFX_TILE_OPAQUE) sTileData.flags |= TILE_OPAQUE; // nothing to mask
 
 					if (sTileData.flags & TILE_SKIP) continue; // skip this tile
 
@@ -1149,7 +1474,6 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 
 				if (cur_map->flags & TMAP_FLIPX) {
 					sx = ((maxx - minx) - cur_map->twidth) - sx;
-					scrx = ((cur_map->twidth) - 1) - scrx;
 					flipx ^= TILE_FLIPX;
 				}
 
@@ -1261,11 +1585,10 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 
 				if (opaque == 0)
 				{
-					if (cur_map->skip_tiles[sTileData.gfx] && (cur_map->flags & TMAP_TRANSPARENT)) {	// skip this tile
-						if (cur_map->skip_tiles[sTileData.gfx][sTileData.code]) {
-							continue;
-						}
-					}
+					INT32 tile_class = GenericTilemapTileClass(sTileData.gfx, sTileData.code);
+
+					if (tile_class == GFX_TILE_TRANSPARENT && (sTileData.flags & TILE_OPAQUE) == 0) continue; // skip this tile, unless the driver forces it opaque
+					if (tile_class == GFX_TILE_OPAQUE) sTileData.flags |= TILE_OPAQUE; // nothing to mask
 
 					if (sTileData.flags & TILE_SKIP) continue; // skip this tile
 
@@ -1455,9 +1778,10 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 
 		if (opaque == 0)
 		{
-			if (cur_map->skip_tiles[sTileData.gfx] && (cur_map->flags & TMAP_TRANSPARENT))	// skip this tile
-				if (cur_map->skip_tiles[sTileData.gfx][sTileData.code])
-					continue; 
+			INT32 tile_class = GenericTilemapTileClass(sTileData.gfx, sTileData.code);
+
+			if (tile_class == GFX_TILE_TRANSPARENT && (sTileData.flags & TILE_OPAQUE) == 0) continue; // skip this tile, unless the driver forces it opaque
+			if (tile_class == GFX_TILE_OPAQUE) sTileData.flags |= TILE_OPAQUE; // nothing to mask
 
 			if (sTileData.flags & TILE_SKIP) continue; // skip this tile
 
@@ -168,6 +168,12 @@ void GenericTilemapSetEnable(INT32 which, INT32 enable);
 // Enable using the dirty tiles system for this tilemap
 void GenericTilemapUseDirtyTiles(INT32 which);
 
+// Keep the whole tilemap pre-rendered, GenericTilemapDraw() then only redraws the tiles marked
+// with GenericTilemapSetTileDirty() and composes scrolling out of the cache. Call
+// GenericTilemapAllTilesDirty() when something the tile callback reads changes globally
+// (tile or colour banks). Changing the gfx given to GenericTilemapSetGfx() does this itself.
+void GenericTilemapUseCache(INT32 which);
+
 // Mark tile as dirty (note that offset will be %= map_height * map_width!!)
 void GenericTilemapSetTileDirty(INT32 which, UINT32 offset);
 
@@ -14,6 +14,7 @@ Otherwise, use the Transfer code as usual.
 ================================================================================================*/
 
 #include "tiles_generic.h"
+#include "burn_simd.h"
 
 UINT8* pTileData;
 INT32 nScreenWidth, nScreenHeight;
@@ -21,6 +22,8 @@ static INT32 nScreenWidthMax, nScreenHeightMax, nScreenWidthMin, nScreenHeightMi
 
 UINT8 GenericTilesPRIMASK = 0x00;
 
+static void TileBlitInit();
+
 INT32 GenericTilesInit()
 {
 	Debug_GenericTilesInitted = 1;
@@ -41,6 +44,8 @@ INT32 GenericTilesInit()
 
 	GenericTilesPRIMASK = 0x00;
 
+	TileBlitInit();
+
 	nRet = BurnTransferInit();
 
 	GenericTilemapExit();
@@ -135,6 +140,65 @@ void GenericTilesSetGfx(INT32 nNum, UINT8 *GfxBase, INT32 nDepth, INT32 nTileWid
 	GenericTilemapSetGfx(nNum, GfxBase, nDepth, nTileWidth, nTileHeight, nGfxLen, nColorOffset, nColorMask);
 }
 
+// Classify every tile of a gfx bank once, so drawing can skip empty tiles and copy solid ones.
+// Call again whenever the tile data changes (e.g. tiles decoded from ram).
+void GenericTilesSetGfx(INT32 nNum, UINT8 *GfxBase, INT32 nDepth, INT32 nTileWidth, INT32 nTileHeight, INT32 nGfxLen, UINT32 nColorOffset, UINT32 nColorMask, INT32 nTransPen)
+{
+	GenericTilemapSetGfx(nNum, GfxBase, nDepth, nTileWidth, nTileHeight, nGfxLen, nColorOffset, nColorMask);
+	GenericTilesClassifyGfx(nNum, nTransPen);
+}
+
+void GenericTilesClassifyGfx(INT32 nNum, INT32 nTransPen)
+{
+	GenericTilesGfx *gfx = &GenericGfxData[nNum];
+
+#if defined FBNEO_DEBUG
+	if (gfx->gfxbase == NULL) {
+		bprintf (PRINT_ERROR, _T("GenericTilesClassifyGfx(%d, 0x%x); gfx[%d] not initialized!\n"), nNum, nTransPen, nNum);
+		return;
+	}
+#endif
+
+	INT32 nTileSize = gfx->width * gfx->height;
+	INT32 nTiles = gfx->gfx_len / nTileSize;
+
+	if (gfx->tile_class == NULL) {
+		gfx->tile_class = (UINT8*)BurnMalloc(nTiles);
+	}
+
+	gfx->trans_pen = nTransPen;
+
+	UINT8 *pSrc = gfx->gfxbase;
+
+	for (INT32 i = 0; i < nTiles; i++, pSrc += nTileSize)
+	{
+		INT32 nTrans = 0;
+
+		for (INT32 j = 0; j < nTileSize; j++) {
+			nTrans += (pSrc[j] == nTransPen);
+		}
+
+		if (nTrans == nTileSize) {
+			gfx->tile_class[i] = GFX_TILE_TRANSPARENT;
+		} else if (nTrans == 0) {
+			gfx->tile_class[i] = GFX_TILE_OPAQUE;
+		} else {
+			gfx->tile_class[i] = GFX_TILE_MIXED;
+		}
+	}
+}
+
+INT32 GenericTilesGetTileClass(INT32 nNum, INT32 nCode, INT32 nTransPen)
+{
+	GenericTilesGfx *gfx = &GenericGfxData[nNum];
+
+	if (gfx->tile_class == NULL || gfx->trans_pen != nTransPen) {
+		return GFX_TILE_MIXED;
+	}
+
+	return gfx->tile_class[nCode % gfx->code_mask];
+}
+
 // ----------------------------------------------------------------------------
 // Colour-depth independant image transfer
 
@@ -360,4481 +424,596 @@ void BurnTransferFlip(INT32 bFlipX, INT32 bFlipY)
 		for (INT32 y = 0; y < nScreenHeight / 2; y++) {
 			memcpy (tmp,  src1, nScreenWidth * 2);
 			memcpy (src1, src2, nScreenWidth * 2);
-			memcpy (src2, tmp,  nScreenWidth * 2);
-			src1 += nScreenWidth;
-			src2 -= nScreenWidth;
-		}
-	}
-}
-
-void BurnTransferRealloc()
-{
-	BurnBitmapAllocate(0, nTransWidth, nTransHeight + nTransOverflow, true);
-
-	pTransDraw = BurnBitmapGetBitmap(0);
-	pPrioDraw = BurnBitmapGetPriomap(0);
-
-	BurnTransferClear();
-}
-
-/*================================================================================================
-Graphics Decoding
-================================================================================================*/
-
-inline static INT32 readbit(const UINT8 *src, INT32 bitnum)
-{
-	return src[bitnum / 8] & (0x80 >> (bitnum % 8));
-}
-
-void GfxDecode(INT32 num, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
-{
-	INT32 c;
-
-	for (c = 0; c < num; c++) {
-		INT32 plane, x, y;
-
-		UINT8 *dp = pDest + (c * xSize * ySize);
-		memset(dp, 0, xSize * ySize);
-
-		for (plane = 0; plane < numPlanes; plane++) {
-			INT32 planebit = 1 << (numPlanes - 1 - plane);
-			INT32 planeoffs = (c * modulo) + planeoffsets[plane];
-
-			for (y = 0; y < ySize; y++) {
-				INT32 yoffs = planeoffs + yoffsets[y];
-				dp = pDest + (c * xSize * ySize) + (y * xSize);
-
-				for (x = 0; x < xSize; x++) {
-					if (readbit(pSrc, yoffs + xoffsets[x])) dp[x] |= planebit;
-				}
-			}
-		}
-	}
-}
-
-void GfxDecodeSingle(INT32 which, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
-{
-	INT32 plane, x, y;
-
-	UINT8 *dp = pDest + (which * xSize * ySize);
-	memset(dp, 0, xSize * ySize);
-
-	for (plane = 0; plane < numPlanes; plane++) {
-		INT32 planebit = 1 << (numPlanes - 1 - plane);
-		INT32 planeoffs = (which * modulo) + planeoffsets[plane];
-
-		for (y = 0; y < ySize; y++) {
-			INT32 yoffs = planeoffs + yoffsets[y];
-			dp = pDest + (which * xSize * ySize) + (y * xSize);
-
-			for (x = 0; x < xSize; x++) {
-				if (readbit(pSrc, yoffs + xoffsets[x])) dp[x] |= planebit;
-			}
-		}
-	}
-}
-
-//================================================================================================
-
-#define PLOTPIXEL_PRIO(x) { pPixel[x] = nPalette + pTileData[x]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_PRIO_FLIPX(x, a) { pPixel[x] = nPalette + pTileData[a]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_PRIO_MASK(x, mc) if (pTileData[x] != mc) { pPixel[x] = nPalette + pTileData[x]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_PRIO_MASK_FLIPX(x, a, mc) if (pTileData[a] != mc) { pPixel[x] = nPalette + pTileData[a]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-
-#define PLOTPIXEL(x) pPixel[x] = nPalette + pTileData[x];
-#define PLOTPIXEL_FLIPX(x, a) pPixel[x] = nPalette + pTileData[a];
-#define PLOTPIXEL_MASK(x, mc) if (pTileData[x] != mc) {pPixel[x] = nPalette + pTileData[x];}
-#define PLOTPIXEL_MASK_FLIPX(x, a, mc) if (pTileData[a] != mc) {pPixel[x] = nPalette + pTileData[a] ;}
-
-#define PLOTPIXEL_PRIO_TRANSMASK(x) if (pTransTable[pTileData[x]] == 0) { pPixel[x] = nPalette + pTileData[x]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_PRIO_TRANSMASK_FLIPX(x, a) if (pTransTable[pTileData[a]] == 0) { pPixel[x] = nPalette + pTileData[a]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_TRANSMASK(x) if (pTransTable[pTileData[x]] == 0) { pPixel[x] = nPalette + pTileData[x];}
-#define PLOTPIXEL_TRANSMASK_FLIPX(x, a) if (pTransTable[pTileData[a]] == 0) { pPixel[x] = nPalette + pTileData[a] ;}
-
-#define CLIPPIXEL(x, sx, a) if ((sx + x) >= nScreenWidthMin && (sx + x) < nScreenWidthMax) { a; };
-
-/*================================================================================================
-8 x 8 Functions
-================================================================================================*/
-
-void Render8x8Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL(0);
-		PLOTPIXEL(1);
-		PLOTPIXEL(2);
-		PLOTPIXEL(3);
-		PLOTPIXEL(4);
-		PLOTPIXEL(5);
-		PLOTPIXEL(6);
-		PLOTPIXEL(7);
-	}
-}
-
-void Render8x8Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL(7));
-	}
-}
-
-void Render8x8Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_FLIPX(7, 0);
-		PLOTPIXEL_FLIPX(6, 1);
-		PLOTPIXEL_FLIPX(5, 2);
-		PLOTPIXEL_FLIPX(4, 3);
-		PLOTPIXEL_FLIPX(3, 4);
-		PLOTPIXEL_FLIPX(2, 5);
-		PLOTPIXEL_FLIPX(1, 6);
-		PLOTPIXEL_FLIPX(0, 7);
-	}
-}
-
-void Render8x8Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_FLIPX(0, 7));
-	}
-}
-
-void Render8x8Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL(0);
-		PLOTPIXEL(1);
-		PLOTPIXEL(2);
-		PLOTPIXEL(3);
-		PLOTPIXEL(4);
-		PLOTPIXEL(5);
-		PLOTPIXEL(6);
-		PLOTPIXEL(7);
-	}
-}
-
-void Render8x8Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL(7));
-	}
-}
-
-void Render8x8Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_FLIPX(7, 0);
-		PLOTPIXEL_FLIPX(6, 1);
-		PLOTPIXEL_FLIPX(5, 2);
-		PLOTPIXEL_FLIPX(4, 3);
-		PLOTPIXEL_FLIPX(3, 4);
-		PLOTPIXEL_FLIPX(2, 5);
-		PLOTPIXEL_FLIPX(1, 6);
-		PLOTPIXEL_FLIPX(0, 7);
-	}
-}
-
-void Render8x8Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_FLIPX(0, 7));
-	}
-}
-
-/*================================================================================================
-8 x 8 Functions with Masking
-================================================================================================*/
-
-void Render8x8Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK(0, nMaskColour);
-		PLOTPIXEL_MASK(1, nMaskColour);
-		PLOTPIXEL_MASK(2, nMaskColour);
-		PLOTPIXEL_MASK(3, nMaskColour);
-		PLOTPIXEL_MASK(4, nMaskColour);
-		PLOTPIXEL_MASK(5, nMaskColour);
-		PLOTPIXEL_MASK(6, nMaskColour);
-		PLOTPIXEL_MASK(7, nMaskColour);
-	}
-}
-
-void Render8x8Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK(7, nMaskColour));
-	}
-}
-
-void Render8x8Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour);
-	}
-}
-
-void Render8x8Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour));
-	}
-}
-
-void Render8x8Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK(0, nMaskColour);
-		PLOTPIXEL_MASK(1, nMaskColour);
-		PLOTPIXEL_MASK(2, nMaskColour);
-		PLOTPIXEL_MASK(3, nMaskColour);
-		PLOTPIXEL_MASK(4, nMaskColour);
-		PLOTPIXEL_MASK(5, nMaskColour);
-		PLOTPIXEL_MASK(6, nMaskColour);
-		PLOTPIXEL_MASK(7, nMaskColour);
-	}
-}
-
-void Render8x8Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK(7, nMaskColour));
-	}
-}
-
-void Render8x8Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour);
-	}
-}
-
-void Render8x8Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour));
-	}
-}
-
-/*================================================================================================
-16 x 16 Functions
-================================================================================================*/
-
-void Render16x16Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-	}
-}
-
-void Render16x16Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-	}
-}
-
-void Render16x16Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_FLIPX(15,  0);
-		PLOTPIXEL_FLIPX(14,  1);
-		PLOTPIXEL_FLIPX(13,  2);
-		PLOTPIXEL_FLIPX(12,  3);
-		PLOTPIXEL_FLIPX(11,  4);
-		PLOTPIXEL_FLIPX(10,  5);
-		PLOTPIXEL_FLIPX( 9,  6);
-		PLOTPIXEL_FLIPX( 8,  7);
-		PLOTPIXEL_FLIPX( 7,  8);
-		PLOTPIXEL_FLIPX( 6,  9);
-		PLOTPIXEL_FLIPX( 5, 10);
-		PLOTPIXEL_FLIPX( 4, 11);
-		PLOTPIXEL_FLIPX( 3, 12);
-		PLOTPIXEL_FLIPX( 2, 13);
-		PLOTPIXEL_FLIPX( 1, 14);
-		PLOTPIXEL_FLIPX( 0, 15);
-	}
-}
-
-void Render16x16Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 15));
-	}
-}
-
-void Render16x16Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-	}
-}
-
-void Render16x16Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-	}
-}
-
-void Render16x16Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_FLIPX(15,  0);
-		PLOTPIXEL_FLIPX(14,  1);
-		PLOTPIXEL_FLIPX(13,  2);
-		PLOTPIXEL_FLIPX(12,  3);
-		PLOTPIXEL_FLIPX(11,  4);
-		PLOTPIXEL_FLIPX(10,  5);
-		PLOTPIXEL_FLIPX( 9,  6);
-		PLOTPIXEL_FLIPX( 8,  7);
-		PLOTPIXEL_FLIPX( 7,  8);
-		PLOTPIXEL_FLIPX( 6,  9);
-		PLOTPIXEL_FLIPX( 5, 10);
-		PLOTPIXEL_FLIPX( 4, 11);
-		PLOTPIXEL_FLIPX( 3, 12);
-		PLOTPIXEL_FLIPX( 2, 13);
-		PLOTPIXEL_FLIPX( 1, 14);
-		PLOTPIXEL_FLIPX( 0, 15);
-	}
-}
-
-void Render16x16Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 15));
-	}
-}
-
-/*================================================================================================
-16 x 16 Functions with Masking
-================================================================================================*/
-
-void Render16x16Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-	}
-}
-
-void Render16x16Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-	}
-}
-
-void Render16x16Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour);
-	}
-}
-
-void Render16x16Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour));
-	}
-}
-
-void Render16x16Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-	}
-}
-
-void Render16x16Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-	}
-}
-
-void Render16x16Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour);
-	}
-}
-
-void Render16x16Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour));
-	}
-}
-
-/*================================================================================================
-32 x 32 Functions
-================================================================================================*/
-
-void Render32x32Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-		PLOTPIXEL(16);
-		PLOTPIXEL(17);
-		PLOTPIXEL(18);
-		PLOTPIXEL(19);
-		PLOTPIXEL(20);
-		PLOTPIXEL(21);
-		PLOTPIXEL(22);
-		PLOTPIXEL(23);
-		PLOTPIXEL(24);
-		PLOTPIXEL(25);
-		PLOTPIXEL(26);
-		PLOTPIXEL(27);
-		PLOTPIXEL(28);
-		PLOTPIXEL(29);
-		PLOTPIXEL(30);
-		PLOTPIXEL(31);
-	}
-}
-
-void Render32x32Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL(31));
-	}
-}
-
-void Render32x32Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_FLIPX(31,  0);
-		PLOTPIXEL_FLIPX(30,  1);
-		PLOTPIXEL_FLIPX(29,  2);
-		PLOTPIXEL_FLIPX(28,  3);
-		PLOTPIXEL_FLIPX(27,  4);
-		PLOTPIXEL_FLIPX(26,  5);
-		PLOTPIXEL_FLIPX(25,  6);
-		PLOTPIXEL_FLIPX(24,  7);
-		PLOTPIXEL_FLIPX(23,  8);
-		PLOTPIXEL_FLIPX(22,  9);
-		PLOTPIXEL_FLIPX(21, 10);
-		PLOTPIXEL_FLIPX(20, 11);
-		PLOTPIXEL_FLIPX(19, 12);
-		PLOTPIXEL_FLIPX(18, 13);
-		PLOTPIXEL_FLIPX(17, 14);
-		PLOTPIXEL_FLIPX(16, 15);
-		PLOTPIXEL_FLIPX(15, 16);
-		PLOTPIXEL_FLIPX(14, 17);
-		PLOTPIXEL_FLIPX(13, 18);
-		PLOTPIXEL_FLIPX(12, 19);
-		PLOTPIXEL_FLIPX(11, 20);
-		PLOTPIXEL_FLIPX(10, 21);
-		PLOTPIXEL_FLIPX( 9, 22);
-		PLOTPIXEL_FLIPX( 8, 23);
-		PLOTPIXEL_FLIPX( 7, 24);
-		PLOTPIXEL_FLIPX( 6, 25);
-		PLOTPIXEL_FLIPX( 5, 26);
-		PLOTPIXEL_FLIPX( 4, 27);
-		PLOTPIXEL_FLIPX( 3, 28);
-		PLOTPIXEL_FLIPX( 2, 29);
-		PLOTPIXEL_FLIPX( 1, 30);
-		PLOTPIXEL_FLIPX( 0, 31);
-	}
-}
-
-void Render32x32Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 31));
-	}
-}
-
-void Render32x32Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-		PLOTPIXEL(16);
-		PLOTPIXEL(17);
-		PLOTPIXEL(18);
-		PLOTPIXEL(19);
-		PLOTPIXEL(20);
-		PLOTPIXEL(21);
-		PLOTPIXEL(22);
-		PLOTPIXEL(23);
-		PLOTPIXEL(24);
-		PLOTPIXEL(25);
-		PLOTPIXEL(26);
-		PLOTPIXEL(27);
-		PLOTPIXEL(28);
-		PLOTPIXEL(29);
-		PLOTPIXEL(30);
-		PLOTPIXEL(31);
-	}
-}
-
-void Render32x32Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL(31));
-	}
-}
-
-void Render32x32Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_FLIPX(31,  0);
-		PLOTPIXEL_FLIPX(30,  1);
-		PLOTPIXEL_FLIPX(29,  2);
-		PLOTPIXEL_FLIPX(28,  3);
-		PLOTPIXEL_FLIPX(27,  4);
-		PLOTPIXEL_FLIPX(26,  5);
-		PLOTPIXEL_FLIPX(25,  6);
-		PLOTPIXEL_FLIPX(24,  7);
-		PLOTPIXEL_FLIPX(23,  8);
-		PLOTPIXEL_FLIPX(22,  9);
-		PLOTPIXEL_FLIPX(21, 10);
-		PLOTPIXEL_FLIPX(20, 11);
-		PLOTPIXEL_FLIPX(19, 12);
-		PLOTPIXEL_FLIPX(18, 13);
-		PLOTPIXEL_FLIPX(17, 14);
-		PLOTPIXEL_FLIPX(16, 15);
-		PLOTPIXEL_FLIPX(15, 16);
-		PLOTPIXEL_FLIPX(14, 17);
-		PLOTPIXEL_FLIPX(13, 18);
-		PLOTPIXEL_FLIPX(12, 19);
-		PLOTPIXEL_FLIPX(11, 20);
-		PLOTPIXEL_FLIPX(10, 21);
-		PLOTPIXEL_FLIPX( 9, 22);
-		PLOTPIXEL_FLIPX( 8, 23);
-		PLOTPIXEL_FLIPX( 7, 24);
-		PLOTPIXEL_FLIPX( 6, 25);
-		PLOTPIXEL_FLIPX( 5, 26);
-		PLOTPIXEL_FLIPX( 4, 27);
-		PLOTPIXEL_FLIPX( 3, 28);
-		PLOTPIXEL_FLIPX( 2, 29);
-		PLOTPIXEL_FLIPX( 1, 30);
-		PLOTPIXEL_FLIPX( 0, 31);
-	}
-}
-
-void Render32x32Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 31));
-	}
-}
-
-/*================================================================================================
-32 x 32 Functions with Masking
-================================================================================================*/
-
-void Render32x32Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-		PLOTPIXEL_MASK(16, nMaskColour);
-		PLOTPIXEL_MASK(17, nMaskColour);
-		PLOTPIXEL_MASK(18, nMaskColour);
-		PLOTPIXEL_MASK(19, nMaskColour);
-		PLOTPIXEL_MASK(20, nMaskColour);
-		PLOTPIXEL_MASK(21, nMaskColour);
-		PLOTPIXEL_MASK(22, nMaskColour);
-		PLOTPIXEL_MASK(23, nMaskColour);
-		PLOTPIXEL_MASK(24, nMaskColour);
-		PLOTPIXEL_MASK(25, nMaskColour);
-		PLOTPIXEL_MASK(26, nMaskColour);
-		PLOTPIXEL_MASK(27, nMaskColour);
-		PLOTPIXEL_MASK(28, nMaskColour);
-		PLOTPIXEL_MASK(29, nMaskColour);
-		PLOTPIXEL_MASK(30, nMaskColour);
-		PLOTPIXEL_MASK(31, nMaskColour);
-	}
-}
-
-void Render32x32Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK(31, nMaskColour));
-	}
-}
-
-void Render32x32Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour);
-	}
-}
-
-void Render32x32Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour));
-	}
-}
-
-void Render32x32Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-		PLOTPIXEL_MASK(16, nMaskColour);
-		PLOTPIXEL_MASK(17, nMaskColour);
-		PLOTPIXEL_MASK(18, nMaskColour);
-		PLOTPIXEL_MASK(19, nMaskColour);
-		PLOTPIXEL_MASK(20, nMaskColour);
-		PLOTPIXEL_MASK(21, nMaskColour);
-		PLOTPIXEL_MASK(22, nMaskColour);
-		PLOTPIXEL_MASK(23, nMaskColour);
-		PLOTPIXEL_MASK(24, nMaskColour);
-		PLOTPIXEL_MASK(25, nMaskColour);
-		PLOTPIXEL_MASK(26, nMaskColour);
-		PLOTPIXEL_MASK(27, nMaskColour);
-		PLOTPIXEL_MASK(28, nMaskColour);
-		PLOTPIXEL_MASK(29, nMaskColour);
-		PLOTPIXEL_MASK(30, nMaskColour);
-		PLOTPIXEL_MASK(31, nMaskColour);
-	}
-}
-
-void Render32x32Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK(31, nMaskColour));
-	}
-}
-
-void Render32x32Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour);
-	}
-}
-
-void Render32x32Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour));
-	}
-}
-
-/*================================================================================================
-Custom Height and Width Functions
-================================================================================================*/
-
-void RenderCustomTile(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL(x);
-		}
-	}
-}
-
-void RenderCustomTile_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL(x));
-		}
-	}
-}
-
-void RenderCustomTile_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_FLIPX(nWidth - x - 1, x);
-		}
-	}
-}
-
-void RenderCustomTile_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_FLIPX(nWidth - x - 1, x));
-		}
-	}
-}
-
-void RenderCustomTile_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL(x);
-		}
-	}
-}
-
-void RenderCustomTile_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL(x));
-		}
-	}
-}
-
-void RenderCustomTile_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_FLIPX(nWidth - x - 1, x);
-		}
-	}
-}
-
-void RenderCustomTile_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_FLIPX(nWidth - x - 1, x));
-		}
-	}
-}
-
-/*================================================================================================
-Custom Height and Width Functions with Masking
-================================================================================================*/
-
-void RenderCustomTile_Mask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK(x, nMaskColour);
-		}
-	}
-}
-
-void RenderCustomTile_Mask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_MASK(x, nMaskColour));
-		}
-	}
-}
-
-void RenderCustomTile_Mask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
-}
-
-void RenderCustomTile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
-}
-
-void RenderCustomTile_Mask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK(x, nMaskColour);
-		}
-	}
-}
-
-void RenderCustomTile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_MASK(x, nMaskColour));
-		}
-	}
-}
-
-void RenderCustomTile_Mask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
-}
-
-void RenderCustomTile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
-}
-
-
-
-void Render8x8Tile_Prio(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO(0);
-		PLOTPIXEL_PRIO(1);
-		PLOTPIXEL_PRIO(2);
-		PLOTPIXEL_PRIO(3);
-		PLOTPIXEL_PRIO(4);
-		PLOTPIXEL_PRIO(5);
-		PLOTPIXEL_PRIO(6);
-		PLOTPIXEL_PRIO(7);
-	}
-}
-
-void Render8x8Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO(7));
-	}
-}
-
-void Render8x8Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_FLIPX(7, 0);
-		PLOTPIXEL_PRIO_FLIPX(6, 1);
-		PLOTPIXEL_PRIO_FLIPX(5, 2);
-		PLOTPIXEL_PRIO_FLIPX(4, 3);
-		PLOTPIXEL_PRIO_FLIPX(3, 4);
-		PLOTPIXEL_PRIO_FLIPX(2, 5);
-		PLOTPIXEL_PRIO_FLIPX(1, 6);
-		PLOTPIXEL_PRIO_FLIPX(0, 7);
-	}
-}
-
-void Render8x8Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_FLIPX(0, 7));
-	}
-}
-
-void Render8x8Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO(0);
-		PLOTPIXEL_PRIO(1);
-		PLOTPIXEL_PRIO(2);
-		PLOTPIXEL_PRIO(3);
-		PLOTPIXEL_PRIO(4);
-		PLOTPIXEL_PRIO(5);
-		PLOTPIXEL_PRIO(6);
-		PLOTPIXEL_PRIO(7);
-	}
-}
-
-void Render8x8Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO(7));
-	}
-}
-
-void Render8x8Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_FLIPX(7, 0);
-		PLOTPIXEL_PRIO_FLIPX(6, 1);
-		PLOTPIXEL_PRIO_FLIPX(5, 2);
-		PLOTPIXEL_PRIO_FLIPX(4, 3);
-		PLOTPIXEL_PRIO_FLIPX(3, 4);
-		PLOTPIXEL_PRIO_FLIPX(2, 5);
-		PLOTPIXEL_PRIO_FLIPX(1, 6);
-		PLOTPIXEL_PRIO_FLIPX(0, 7);
-	}
-}
-
-void Render8x8Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw+ ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_FLIPX(0, 7));
-	}
-}
-
-/*================================================================================================
-8 x 8 Functions with Masking
-================================================================================================*/
-
-void Render8x8Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK(0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(7, nMaskColour);
-	}
-}
-
-void Render8x8Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK(7, nMaskColour));
-	}
-}
-
-void Render8x8Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour);
-	}
-}
-
-void Render8x8Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour));
-	}
-}
-
-void Render8x8Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK(0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(7, nMaskColour);
-	}
-}
-
-void Render8x8Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK(7, nMaskColour));
-	}
-}
-
-void Render8x8Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour);
-	}
-}
-
-void Render8x8Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour));
-	}
-}
-
-/*================================================================================================
-16 x 16 Functions
-================================================================================================*/
-
-void Render16x16Tile_Prio(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-	}
-}
-
-void Render16x16Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-	}
-}
-
-void Render16x16Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_FLIPX(15,  0);
-		PLOTPIXEL_PRIO_FLIPX(14,  1);
-		PLOTPIXEL_PRIO_FLIPX(13,  2);
-		PLOTPIXEL_PRIO_FLIPX(12,  3);
-		PLOTPIXEL_PRIO_FLIPX(11,  4);
-		PLOTPIXEL_PRIO_FLIPX(10,  5);
-		PLOTPIXEL_PRIO_FLIPX( 9,  6);
-		PLOTPIXEL_PRIO_FLIPX( 8,  7);
-		PLOTPIXEL_PRIO_FLIPX( 7,  8);
-		PLOTPIXEL_PRIO_FLIPX( 6,  9);
-		PLOTPIXEL_PRIO_FLIPX( 5, 10);
-		PLOTPIXEL_PRIO_FLIPX( 4, 11);
-		PLOTPIXEL_PRIO_FLIPX( 3, 12);
-		PLOTPIXEL_PRIO_FLIPX( 2, 13);
-		PLOTPIXEL_PRIO_FLIPX( 1, 14);
-		PLOTPIXEL_PRIO_FLIPX( 0, 15);
-	}
-}
-
-void Render16x16Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 15));
-	}
-}
-
-void Render16x16Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-	}
-}
-
-void Render16x16Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-	}
-}
-
-void Render16x16Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_FLIPX(15,  0);
-		PLOTPIXEL_PRIO_FLIPX(14,  1);
-		PLOTPIXEL_PRIO_FLIPX(13,  2);
-		PLOTPIXEL_PRIO_FLIPX(12,  3);
-		PLOTPIXEL_PRIO_FLIPX(11,  4);
-		PLOTPIXEL_PRIO_FLIPX(10,  5);
-		PLOTPIXEL_PRIO_FLIPX( 9,  6);
-		PLOTPIXEL_PRIO_FLIPX( 8,  7);
-		PLOTPIXEL_PRIO_FLIPX( 7,  8);
-		PLOTPIXEL_PRIO_FLIPX( 6,  9);
-		PLOTPIXEL_PRIO_FLIPX( 5, 10);
-		PLOTPIXEL_PRIO_FLIPX( 4, 11);
-		PLOTPIXEL_PRIO_FLIPX( 3, 12);
-		PLOTPIXEL_PRIO_FLIPX( 2, 13);
-		PLOTPIXEL_PRIO_FLIPX( 1, 14);
-		PLOTPIXEL_PRIO_FLIPX( 0, 15);
-	}
-}
-
-void Render16x16Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 15));
-	}
-}
-
-/*================================================================================================
-16 x 16 Functions with Masking
-================================================================================================*/
-
-void Render16x16Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-	}
-}
-
-void Render16x16Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-	}
-}
-
-void Render16x16Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour);
-	}
-}
-
-void Render16x16Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour));
-	}
-}
-
-void Render16x16Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-	}
-}
-
-void Render16x16Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-	}
-}
-
-void Render16x16Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour);
-	}
-}
-
-void Render16x16Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour));
-	}
-}
-
-/*================================================================================================
-32 x 32 Functions
-================================================================================================*/
-
-void Render32x32Tile_Prio(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-		PLOTPIXEL_PRIO(16);
-		PLOTPIXEL_PRIO(17);
-		PLOTPIXEL_PRIO(18);
-		PLOTPIXEL_PRIO(19);
-		PLOTPIXEL_PRIO(20);
-		PLOTPIXEL_PRIO(21);
-		PLOTPIXEL_PRIO(22);
-		PLOTPIXEL_PRIO(23);
-		PLOTPIXEL_PRIO(24);
-		PLOTPIXEL_PRIO(25);
-		PLOTPIXEL_PRIO(26);
-		PLOTPIXEL_PRIO(27);
-		PLOTPIXEL_PRIO(28);
-		PLOTPIXEL_PRIO(29);
-		PLOTPIXEL_PRIO(30);
-		PLOTPIXEL_PRIO(31);
-	}
-}
-
-void Render32x32Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO(31));
-	}
-}
-
-void Render32x32Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_FLIPX(31,  0);
-		PLOTPIXEL_PRIO_FLIPX(30,  1);
-		PLOTPIXEL_PRIO_FLIPX(29,  2);
-		PLOTPIXEL_PRIO_FLIPX(28,  3);
-		PLOTPIXEL_PRIO_FLIPX(27,  4);
-		PLOTPIXEL_PRIO_FLIPX(26,  5);
-		PLOTPIXEL_PRIO_FLIPX(25,  6);
-		PLOTPIXEL_PRIO_FLIPX(24,  7);
-		PLOTPIXEL_PRIO_FLIPX(23,  8);
-		PLOTPIXEL_PRIO_FLIPX(22,  9);
-		PLOTPIXEL_PRIO_FLIPX(21, 10);
-		PLOTPIXEL_PRIO_FLIPX(20, 11);
-		PLOTPIXEL_PRIO_FLIPX(19, 12);
-		PLOTPIXEL_PRIO_FLIPX(18, 13);
-		PLOTPIXEL_PRIO_FLIPX(17, 14);
-		PLOTPIXEL_PRIO_FLIPX(16, 15);
-		PLOTPIXEL_PRIO_FLIPX(15, 16);
-		PLOTPIXEL_PRIO_FLIPX(14, 17);
-		PLOTPIXEL_PRIO_FLIPX(13, 18);
-		PLOTPIXEL_PRIO_FLIPX(12, 19);
-		PLOTPIXEL_PRIO_FLIPX(11, 20);
-		PLOTPIXEL_PRIO_FLIPX(10, 21);
-		PLOTPIXEL_PRIO_FLIPX( 9, 22);
-		PLOTPIXEL_PRIO_FLIPX( 8, 23);
-		PLOTPIXEL_PRIO_FLIPX( 7, 24);
-		PLOTPIXEL_PRIO_FLIPX( 6, 25);
-		PLOTPIXEL_PRIO_FLIPX( 5, 26);
-		PLOTPIXEL_PRIO_FLIPX( 4, 27);
-		PLOTPIXEL_PRIO_FLIPX( 3, 28);
-		PLOTPIXEL_PRIO_FLIPX( 2, 29);
-		PLOTPIXEL_PRIO_FLIPX( 1, 30);
-		PLOTPIXEL_PRIO_FLIPX( 0, 31);
-	}
-}
-
-void Render32x32Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 31));
-	}
-}
-
-void Render32x32Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-		PLOTPIXEL_PRIO(16);
-		PLOTPIXEL_PRIO(17);
-		PLOTPIXEL_PRIO(18);
-		PLOTPIXEL_PRIO(19);
-		PLOTPIXEL_PRIO(20);
-		PLOTPIXEL_PRIO(21);
-		PLOTPIXEL_PRIO(22);
-		PLOTPIXEL_PRIO(23);
-		PLOTPIXEL_PRIO(24);
-		PLOTPIXEL_PRIO(25);
-		PLOTPIXEL_PRIO(26);
-		PLOTPIXEL_PRIO(27);
-		PLOTPIXEL_PRIO(28);
-		PLOTPIXEL_PRIO(29);
-		PLOTPIXEL_PRIO(30);
-		PLOTPIXEL_PRIO(31);
-	}
-}
-
-void Render32x32Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO(31));
-	}
-}
-
-void Render32x32Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_FLIPX(31,  0);
-		PLOTPIXEL_PRIO_FLIPX(30,  1);
-		PLOTPIXEL_PRIO_FLIPX(29,  2);
-		PLOTPIXEL_PRIO_FLIPX(28,  3);
-		PLOTPIXEL_PRIO_FLIPX(27,  4);
-		PLOTPIXEL_PRIO_FLIPX(26,  5);
-		PLOTPIXEL_PRIO_FLIPX(25,  6);
-		PLOTPIXEL_PRIO_FLIPX(24,  7);
-		PLOTPIXEL_PRIO_FLIPX(23,  8);
-		PLOTPIXEL_PRIO_FLIPX(22,  9);
-		PLOTPIXEL_PRIO_FLIPX(21, 10);
-		PLOTPIXEL_PRIO_FLIPX(20, 11);
-		PLOTPIXEL_PRIO_FLIPX(19, 12);
-		PLOTPIXEL_PRIO_FLIPX(18, 13);
-		PLOTPIXEL_PRIO_FLIPX(17, 14);
-		PLOTPIXEL_PRIO_FLIPX(16, 15);
-		PLOTPIXEL_PRIO_FLIPX(15, 16);
-		PLOTPIXEL_PRIO_FLIPX(14, 17);
-		PLOTPIXEL_PRIO_FLIPX(13, 18);
-		PLOTPIXEL_PRIO_FLIPX(12, 19);
-		PLOTPIXEL_PRIO_FLIPX(11, 20);
-		PLOTPIXEL_PRIO_FLIPX(10, 21);
-		PLOTPIXEL_PRIO_FLIPX( 9, 22);
-		PLOTPIXEL_PRIO_FLIPX( 8, 23);
-		PLOTPIXEL_PRIO_FLIPX( 7, 24);
-		PLOTPIXEL_PRIO_FLIPX( 6, 25);
-		PLOTPIXEL_PRIO_FLIPX( 5, 26);
-		PLOTPIXEL_PRIO_FLIPX( 4, 27);
-		PLOTPIXEL_PRIO_FLIPX( 3, 28);
-		PLOTPIXEL_PRIO_FLIPX( 2, 29);
-		PLOTPIXEL_PRIO_FLIPX( 1, 30);
-		PLOTPIXEL_PRIO_FLIPX( 0, 31);
-	}
-}
-
-void Render32x32Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 31));
-	}
-}
-
-/*================================================================================================
-32 x 32 Functions with Masking
-================================================================================================*/
-
-void Render32x32Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(31, nMaskColour);
-	}
-}
-
-void Render32x32Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK(31, nMaskColour));
-	}
-}
-
-void Render32x32Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour);
+			memcpy (src2, tmp,  nScreenWidth * 2);
+			src1 += nScreenWidth;
+			src2 -= nScreenWidth;
+		}
 	}
 }
 
-void Render32x32Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+void BurnTransferRealloc()
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
+	BurnBitmapAllocate(0, nTransWidth, nTransHeight + nTransOverflow, true);
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
+	pTransDraw = BurnBitmapGetBitmap(0);
+	pPrioDraw = BurnBitmapGetPriomap(0);
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
+	BurnTransferClear();
+}
 
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+/*================================================================================================
+Graphics Decoding
+================================================================================================*/
 
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+inline static INT32 readbit(const UINT8 *src, INT32 bitnum)
+{
+	return src[bitnum / 8] & (0x80 >> (bitnum % 8));
 }
 
-void Render32x32Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+void GfxDecode(INT32 num, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipY called without init\n"));
-#endif
+	INT32 c;
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(31, nMaskColour);
-	}
-}
+	for (c = 0; c < num; c++) {
+		INT32 plane, x, y;
 
-void Render32x32Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
+		UINT8 *dp = pDest + (c * xSize * ySize);
+		memset(dp, 0, xSize * ySize);
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
+		for (plane = 0; plane < numPlanes; plane++) {
+			INT32 planebit = 1 << (numPlanes - 1 - plane);
+			INT32 planeoffs = (c * modulo) + planeoffsets[plane];
 
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
+			for (y = 0; y < ySize; y++) {
+				INT32 yoffs = planeoffs + yoffsets[y];
+				dp = pDest + (c * xSize * ySize) + (y * xSize);
 
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
+				for (x = 0; x < xSize; x++) {
+					if (readbit(pSrc, yoffs + xoffsets[x])) dp[x] |= planebit;
+				}
+			}
 		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK(31, nMaskColour));
 	}
 }
 
-void Render32x32Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+void GfxDecodeSingle(INT32 which, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour);
-	}
-}
+	INT32 plane, x, y;
 
-void Render32x32Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
+	UINT8 *dp = pDest + (which * xSize * ySize);
+	memset(dp, 0, xSize * ySize);
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
+	for (plane = 0; plane < numPlanes; plane++) {
+		INT32 planebit = 1 << (numPlanes - 1 - plane);
+		INT32 planeoffs = (which * modulo) + planeoffsets[plane];
 
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
+		for (y = 0; y < ySize; y++) {
+			INT32 yoffs = planeoffs + yoffsets[y];
+			dp = pDest + (which * xSize * ySize) + (y * xSize);
 
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
+			for (x = 0; x < xSize; x++) {
+				if (readbit(pSrc, yoffs + xoffsets[x])) dp[x] |= planebit;
+			}
 		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour));
 	}
 }
 
 /*================================================================================================
-Custom Height and Width Functions
+Tile Blitters
+
+Whole-tile kernels used by the Render*Tile functions. Each kernel draws nHeight rows of nWidth
+(a multiple of 8) pixels, adding nPalette to each source pixel. nPitch is negative for FlipY.
+The Mask kernels leave pixels equal to nMaskColour untouched. SSE2/AVX2/NEON versions are
+picked at runtime by TileBlitInit(), the C versions are the reference and the fallback.
 ================================================================================================*/
 
-void RenderCustomTile_Prio(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile called without init\n"));
+#if defined (BURN_SSE2) && defined (__GNUC__)
+ #define TILE_BLIT_AVX2
+ #include <immintrin.h>
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
+typedef void (*pTileBlit)(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32 nMaskColour);
 
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO(x);
-		}
-	}
-}
+static struct {
+	pTileBlit Copy;
+	pTileBlit CopyFlipX;
+	pTileBlit Mask;
+	pTileBlit MaskFlipX;
+} TileBlit;
 
-void RenderCustomTile_Prio_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+static void TileBlitCopy_C(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
 		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO(x));
+			pPixel[x] = nPalette + pSrc[x];
 		}
 	}
 }
 
-void RenderCustomTile_Prio_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+static void TileBlitCopyFlipX_C(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
 		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x);
+			pPixel[x] = nPalette + pSrc[nWidth - 1 - x];
 		}
 	}
 }
 
-void RenderCustomTile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+static void TileBlitMask_C(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32 nMaskColour)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
 		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x));
+			if (pSrc[x] != nMaskColour) pPixel[x] = nPalette + pSrc[x];
 		}
 	}
 }
 
-void RenderCustomTile_Prio_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+static void TileBlitMaskFlipX_C(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32 nMaskColour)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
 		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO(x);
+			if (pSrc[nWidth - 1 - x] != nMaskColour) pPixel[x] = nPalette + pSrc[nWidth - 1 - x];
 		}
 	}
 }
 
-void RenderCustomTile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
+#if defined (BURN_SSE2)
 
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
+// 8 source pixels widened to 16 bits
+#define SSE2_LOAD8(s)		_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(s)), _mm_setzero_si128())
+// Reverse the order of 8 16-bit lanes
+#define SSE2_REVERSE8(v)	_mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0x1b), 0x1b), 0x4e)
+// Keep the destination where the source equals the mask colour
+#define SSE2_MASKED(d, v, m)	_mm_or_si128(_mm_and_si128(m, d), _mm_andnot_si128(m, v))
 
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+static void TileBlitCopy_SSE2(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32)
+{
+	const __m128i pal = _mm_set1_epi16((INT16)nPalette);
 
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO(x));
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
+		for (INT32 x = 0; x < nWidth; x += 8) {
+			_mm_storeu_si128((__m128i*)(pPixel + x), _mm_add_epi16(SSE2_LOAD8(pSrc + x), pal));
 		}
 	}
 }
 
-void RenderCustomTile_Prio_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+static void TileBlitCopyFlipX_SSE2(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
+	const __m128i pal = _mm_set1_epi16((INT16)nPalette);
 
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x);
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
+		for (INT32 x = 0; x < nWidth; x += 8) {
+			__m128i v = SSE2_LOAD8(pSrc + nWidth - 8 - x);
+			_mm_storeu_si128((__m128i*)(pPixel + x), _mm_add_epi16(SSE2_REVERSE8(v), pal));
 		}
 	}
 }
 
-void RenderCustomTile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+static void TileBlitMask_SSE2(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32 nMaskColour)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipXY_Clip called without init\n"));
-#endif
+	const __m128i pal = _mm_set1_epi16((INT16)nPalette);
+	const __m128i mask = _mm_set1_epi16((INT16)nMaskColour);
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x));
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
+		for (INT32 x = 0; x < nWidth; x += 8) {
+			__m128i v = SSE2_LOAD8(pSrc + x);
+			__m128i m = _mm_cmpeq_epi16(v, mask);
+			__m128i d = _mm_loadu_si128((const __m128i*)(pPixel + x));
+			_mm_storeu_si128((__m128i*)(pPixel + x), SSE2_MASKED(d, _mm_add_epi16(v, pal), m));
 		}
 	}
 }
 
-/*================================================================================================
-Custom Height and Width Functions with Masking
-================================================================================================*/
-
-void RenderCustomTile_Prio_Mask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+static void TileBlitMaskFlipX_SSE2(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32 nMaskColour)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
+	const __m128i pal = _mm_set1_epi16((INT16)nPalette);
+	const __m128i mask = _mm_set1_epi16((INT16)nMaskColour);
 
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK(x, nMaskColour);
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
+		for (INT32 x = 0; x < nWidth; x += 8) {
+			__m128i v = SSE2_REVERSE8(SSE2_LOAD8(pSrc + nWidth - 8 - x));
+			__m128i m = _mm_cmpeq_epi16(v, mask);
+			__m128i d = _mm_loadu_si128((const __m128i*)(pPixel + x));
+			_mm_storeu_si128((__m128i*)(pPixel + x), SSE2_MASKED(d, _mm_add_epi16(v, pal), m));
 		}
 	}
 }
 
-void RenderCustomTile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
+#if defined (TILE_BLIT_AVX2)
 
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+// 8 pixel wide tiles gain nothing from 256-bit lanes and use the SSE2 kernels
 
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_MASK(x, nMaskColour));
-		}
-	}
-}
+#define AVX2_LOAD16(s)		_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(s)))
 
-void RenderCustomTile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+__attribute__((target("avx2"))) static inline __m256i AVX2_Reverse16(__m256i v)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
+	const __m256i rev = _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+										 14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+	v = _mm256_shuffle_epi8(v, rev);				// reverse within each 128-bit lane
+	return _mm256_permute2x128_si256(v, v, 0x01);	// then swap the lanes
 }
 
-void RenderCustomTile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+__attribute__((target("avx2"))) static void TileBlitCopy_AVX2(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32 nMaskColour)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
+	if (nWidth & 8) {
+		TileBlitCopy_SSE2(pPixel, nPitch, pSrc, nWidth, nHeight, nPalette, nMaskColour);
+		return;
+	}
 
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+	const __m256i pal = _mm256_set1_epi16((INT16)nPalette);
 
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
+		for (INT32 x = 0; x < nWidth; x += 16) {
+			_mm256_storeu_si256((__m256i*)(pPixel + x), _mm256_add_epi16(AVX2_LOAD16(pSrc + x), pal));
 		}
 	}
 }
 
-void RenderCustomTile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+__attribute__((target("avx2"))) static void TileBlitCopyFlipX_AVX2(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32 nMaskColour)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
+	if (nWidth & 8) {
+		TileBlitCopyFlipX_SSE2(pPixel, nPitch, pSrc, nWidth, nHeight, nPalette, nMaskColour);
+		return;
+	}
 
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
+	const __m256i pal = _mm256_set1_epi16((INT16)nPalette);
 
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK(x, nMaskColour);
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
+		for (INT32 x = 0; x < nWidth; x += 16) {
+			__m256i v = AVX2_Reverse16(AVX2_LOAD16(pSrc + nWidth - 16 - x));
+			_mm256_storeu_si256((__m256i*)(pPixel + x), _mm256_add_epi16(v, pal));
 		}
 	}
 }
 
-void RenderCustomTile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+__attribute__((target("avx2"))) static void TileBlitMask_AVX2(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32 nMaskColour)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
+	if (nWidth & 8) {
+		TileBlitMask_SSE2(pPixel, nPitch, pSrc, nWidth, nHeight, nPalette, nMaskColour);
+		return;
+	}
 
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+	const __m256i pal = _mm256_set1_epi16((INT16)nPalette);
+	const __m256i mask = _mm256_set1_epi16((INT16)nMaskColour);
 
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_MASK(x, nMaskColour));
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
+		for (INT32 x = 0; x < nWidth; x += 16) {
+			__m256i v = AVX2_LOAD16(pSrc + x);
+			__m256i m = _mm256_cmpeq_epi16(v, mask);
+			__m256i d = _mm256_loadu_si256((const __m256i*)(pPixel + x));
+			_mm256_storeu_si256((__m256i*)(pPixel + x), _mm256_blendv_epi8(_mm256_add_epi16(v, pal), d, m));
 		}
 	}
 }
 
-void RenderCustomTile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+__attribute__((target("avx2"))) static void TileBlitMaskFlipX_AVX2(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32 nMaskColour)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
+	if (nWidth & 8) {
+		TileBlitMaskFlipX_SSE2(pPixel, nPitch, pSrc, nWidth, nHeight, nPalette, nMaskColour);
+		return;
+	}
 
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
+	const __m256i pal = _mm256_set1_epi16((INT16)nPalette);
+	const __m256i mask = _mm256_set1_epi16((INT16)nMaskColour);
 
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
+		for (INT32 x = 0; x < nWidth; x += 16) {
+			__m256i v = AVX2_Reverse16(AVX2_LOAD16(pSrc + nWidth - 16 - x));
+			__m256i m = _mm256_cmpeq_epi16(v, mask);
+			__m256i d = _mm256_loadu_si256((const __m256i*)(pPixel + x));
+			_mm256_storeu_si256((__m256i*)(pPixel + x), _mm256_blendv_epi8(_mm256_add_epi16(v, pal), d, m));
 		}
 	}
 }
 
-void RenderCustomTile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
+#if defined (BURN_NEON)
 
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
+#define NEON_LOAD8(s)		vmovl_u8(vld1_u8(s))
+#define NEON_REVERSE8(v)	vcombine_u16(vget_high_u16(vrev64q_u16(v)), vget_low_u16(vrev64q_u16(v)))
 
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+static void TileBlitCopy_NEON(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32)
+{
+	const uint16x8_t pal = vdupq_n_u16((UINT16)nPalette);
 
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
+		for (INT32 x = 0; x < nWidth; x += 8) {
+			vst1q_u16(pPixel + x, vaddq_u16(NEON_LOAD8(pSrc + x), pal));
 		}
 	}
 }
 
-
-
-
-
-
-
-
-
-void RenderCustomTile_Prio_TransMask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+static void TileBlitCopyFlipX_NEON(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
+	const uint16x8_t pal = vdupq_n_u16((UINT16)nPalette);
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK(x);
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
+		for (INT32 x = 0; x < nWidth; x += 8) {
+			uint16x8_t v = NEON_LOAD8(pSrc + nWidth - 8 - x);
+			vst1q_u16(pPixel + x, vaddq_u16(NEON_REVERSE8(v), pal));
 		}
 	}
 }
 
-void RenderCustomTile_Prio_TransMask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+static void TileBlitMask_NEON(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32 nMaskColour)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+	const uint16x8_t pal = vdupq_n_u16((UINT16)nPalette);
+	const uint16x8_t mask = vdupq_n_u16((UINT16)nMaskColour);
 
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_TRANSMASK(x));
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
+		for (INT32 x = 0; x < nWidth; x += 8) {
+			uint16x8_t v = NEON_LOAD8(pSrc + x);
+			vst1q_u16(pPixel + x, vbslq_u16(vceqq_u16(v, mask), vld1q_u16(pPixel + x), vaddq_u16(v, pal)));
 		}
 	}
 }
 
-void RenderCustomTile_Prio_TransMask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+static void TileBlitMaskFlipX_NEON(UINT16* pPixel, INT32 nPitch, const UINT8* pSrc, INT32 nWidth, INT32 nHeight, UINT32 nPalette, INT32 nMaskColour)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
+	const uint16x8_t pal = vdupq_n_u16((UINT16)nPalette);
+	const uint16x8_t mask = vdupq_n_u16((UINT16)nMaskColour);
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x);
+	for (INT32 y = 0; y < nHeight; y++, pPixel += nPitch, pSrc += nWidth) {
+		for (INT32 x = 0; x < nWidth; x += 8) {
+			uint16x8_t v = NEON_LOAD8(pSrc + nWidth - 8 - x);
+			v = NEON_REVERSE8(v);
+			vst1q_u16(pPixel + x, vbslq_u16(vceqq_u16(v, mask), vld1q_u16(pPixel + x), vaddq_u16(v, pal)));
 		}
 	}
 }
 
-void RenderCustomTile_Prio_TransMask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
+static void TileBlitInit()
+{
+	TileBlit.Copy      = TileBlitCopy_C;
+	TileBlit.CopyFlipX = TileBlitCopyFlipX_C;
+	TileBlit.Mask      = TileBlitMask_C;
+	TileBlit.MaskFlipX = TileBlitMaskFlipX_C;
 
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+#if defined (BURN_SSE2)
+	TileBlit.Copy      = TileBlitCopy_SSE2;
+	TileBlit.CopyFlipX = TileBlitCopyFlipX_SSE2;
+	TileBlit.Mask      = TileBlitMask_SSE2;
+	TileBlit.MaskFlipX = TileBlitMaskFlipX_SSE2;
+#endif
 
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x));
-		}
+#if defined (TILE_BLIT_AVX2)
+	if (__builtin_cpu_supports("avx2")) {
+		TileBlit.Copy      = TileBlitCopy_AVX2;
+		TileBlit.CopyFlipX = TileBlitCopyFlipX_AVX2;
+		TileBlit.Mask      = TileBlitMask_AVX2;
+		TileBlit.MaskFlipX = TileBlitMaskFlipX_AVX2;
 	}
-}
+#endif
 
-void RenderCustomTile_Prio_TransMask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY called without init\n"));
+#if defined (BURN_NEON)
+	TileBlit.Copy      = TileBlitCopy_NEON;
+	TileBlit.CopyFlipX = TileBlitCopyFlipX_NEON;
+	TileBlit.Mask      = TileBlitMask_NEON;
+	TileBlit.MaskFlipX = TileBlitMaskFlipX_NEON;
 #endif
+}
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
+/*================================================================================================
+Tile Renderer Template
 
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
+Every Render*Tile function below is a thin wrapper around RenderTileT, specialised at compile time
+on tile size (0 = custom nWidth x nHeight), transparency mode, X/Y flip, clipping, priority and
+alpha blending. Clipping is done once per tile by narrowing the row and column range, so the inner
+loop never tests the clip rectangle. Untouched opaque and masked tiles go to the TileBlit kernels.
+================================================================================================*/
 
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK(x);
-		}
-	}
-}
+#define TILE_DRAW_OPAQUE	0					// draw every pixel
+#define TILE_DRAW_MASK		1					// skip pixels equal to nMaskColour
+#define TILE_DRAW_TRANSTAB	2					// skip pixels where pTransTable[pixel] != 0
+
+struct TileArgs {
+	INT32 nWidth, nHeight;
+	INT32 nTileNumber;
+	INT32 StartX, StartY;
+	UINT32 nPalette;
+	INT32 nMaskColour;
+	UINT8 *pTransTable;
+	INT32 nPriority;
+	UINT32 *pPalette;						// alpha blending only, maps nPalette + pixel to RGB
+	INT32 nAlpha;							// alpha blending only, 0 - 256 (256 = opaque)
+	UINT8 *pTile;
+};
 
-void RenderCustomTile_Prio_TransMask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+template <typename T, INT32 nSize, INT32 nTrans, bool bFlipX, bool bFlipY, bool bClip, bool bPrio, bool bAlpha>
+inline static void RenderTileT(T* pDestDraw, const TileArgs &a)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
+	const INT32 nWidth  = nSize ? nSize : a.nWidth;
+	const INT32 nHeight = nSize ? nSize : a.nHeight;
+	const UINT32 nPalette = a.nPalette;
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
+	pTileData = a.pTile + (a.nTileNumber * nWidth * nHeight);
 
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
+	INT32 x0 = 0, x1 = nWidth, y0 = 0, y1 = nHeight;
 
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+	if (bClip) {
+		if (a.StartX < nScreenWidthMin) x0 = nScreenWidthMin - a.StartX;
+		if (a.StartX + nWidth > nScreenWidthMax) x1 = nScreenWidthMax - a.StartX;
+		if (a.StartY < nScreenHeightMin) y0 = nScreenHeightMin - a.StartY;
+		if (a.StartY + nHeight > nScreenHeightMax) y1 = nScreenHeightMax - a.StartY;
 
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_TRANSMASK(x));
-		}
+		if (x0 >= x1 || y0 >= y1) return;
 	}
-}
 
-void RenderCustomTile_Prio_TransMask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
+	// Whole opaque or masked tiles on the 16-bit buffer use the SIMD kernels
+	if (sizeof(T) == sizeof(UINT16) && !bPrio && !bAlpha && nTrans != TILE_DRAW_TRANSTAB && (nWidth & 7) == 0 &&
+		x0 == 0 && x1 == nWidth && y0 == 0 && y1 == nHeight)
+	{
+		UINT16* pPixel = (UINT16*)pDestDraw + ((a.StartY + (bFlipY ? nHeight - 1 : 0)) * nScreenWidth) + a.StartX;
+		INT32 nPitch = bFlipY ? -nScreenWidth : nScreenWidth;
 
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x);
+		// Mask colours outside 0 - 255 never match a pixel, so the tile is drawn solid
+		if (nTrans == TILE_DRAW_MASK && (UINT32)a.nMaskColour <= 0xff) {
+			(bFlipX ? TileBlit.MaskFlipX : TileBlit.Mask)(pPixel, nPitch, pTileData, nWidth, nHeight, nPalette, a.nMaskColour);
+		} else {
+			(bFlipX ? TileBlit.CopyFlipX : TileBlit.Copy)(pPixel, nPitch, pTileData, nWidth, nHeight, nPalette, 0);
 		}
+		return;
 	}
-}
 
-void RenderCustomTile_Prio_TransMask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
+	for (INT32 y = y0; y < y1; y++) {
+		const UINT8* pSrc = pTileData + ((bFlipY ? (nHeight - 1 - y) : y) * nWidth);
+		T* pPixel = pDestDraw + ((a.StartY + y) * nScreenWidth) + a.StartX;
+		UINT8* pPri = bPrio ? (pPrioDraw + ((a.StartY + y) * nScreenWidth) + a.StartX) : NULL;
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
+		for (INT32 x = x0; x < x1; x++) {
+			const INT32 c = pSrc[bFlipX ? (nWidth - 1 - x) : x];
 
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
+			if (nTrans == TILE_DRAW_MASK && c == a.nMaskColour) continue;
+			if (nTrans == TILE_DRAW_TRANSTAB && a.pTransTable[c]) continue;
 
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+			if (bAlpha) {
+				pPixel[x] = alpha_blend(pPixel[x], a.pPalette[nPalette + c], a.nAlpha);
+			} else {
+				pPixel[x] = nPalette + c;
+			}
 
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x));
+			if (bPrio) pPri[x] = a.nPriority | (pPri[x] & GenericTilesPRIMASK);
 		}
 	}
 }
 
+/*================================================================================================
+Exported Tile Functions
 
+TILE_FUNC defines one wrapper, TILE_FUNCS the eight flip / clip variants of a family.
+PARAMS is the exported parameter list and ARGS the matching TileArgs initialiser, both in brackets.
+================================================================================================*/
 
-#undef PLOTPIXEL_PRIO_TRANSMASK
-#undef PLOTPIXEL_PRIO_MASK_FLIPX
-#undef PLOTPIXEL_TRANSMASK
-#undef PLOTPIXEL_TRANSMASK_FLIPX
-
-#undef PLOTPIXEL
-#undef PLOTPIXEL_FLIPX
-#undef PLOTPIXEL_MASK
-#undef CLIPPIXEL
-
-#undef PLOTPIXEL_PRIO
-#undef PLOTPIXEL_PRIO_FLIPX
-#undef PLOTPIXEL_PRIO_MASK
-#undef PLOTPIXEL_PRIO_MASK_FLIPX
+#if defined FBNEO_DEBUG
+ #define TILE_FUNC_CHECK(name)	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T(#name) _T(" called without init\n"));
+#else
+ #define TILE_FUNC_CHECK(name)
+#endif
+
+#define TILE_EXPAND(...)	__VA_ARGS__
+
+#define TILE_FUNC(name, size, trans, prio, flipx, flipy, clip, PARAMS, ARGS)						\
+void name PARAMS																					\
+{																									\
+	TILE_FUNC_CHECK(name)																			\
+	TileArgs a = { TILE_EXPAND ARGS };																\
+	RenderTileT<UINT16, size, trans, flipx, flipy, clip, prio, false>(pDestDraw, a);				\
+}
+
+#define TILE_FUNCS(name, size, trans, prio, PARAMS, ARGS)											\
+	TILE_FUNC(name,                size, trans, prio, false, false, false, PARAMS, ARGS)			\
+	TILE_FUNC(name##_Clip,         size, trans, prio, false, false, true,  PARAMS, ARGS)			\
+	TILE_FUNC(name##_FlipX,        size, trans, prio, true,  false, false, PARAMS, ARGS)			\
+	TILE_FUNC(name##_FlipX_Clip,   size, trans, prio, true,  false, true,  PARAMS, ARGS)			\
+	TILE_FUNC(name##_FlipY,        size, trans, prio, false, true,  false, PARAMS, ARGS)			\
+	TILE_FUNC(name##_FlipY_Clip,   size, trans, prio, false, true,  true,  PARAMS, ARGS)			\
+	TILE_FUNC(name##_FlipXY,       size, trans, prio, true,  true,  false, PARAMS, ARGS)			\
+	TILE_FUNC(name##_FlipXY_Clip,  size, trans, prio, true,  true,  true,  PARAMS, ARGS)
+
+#define TILE_PALETTE	((UINT32)((nTilePalette << nColourDepth) + nPaletteOffset))
+
+// Fixed size tiles (8 x 8, 16 x 16, 32 x 32)
+#define TILE_PARAMS				(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+#define TILE_ARGS				(0, 0, nTileNumber, StartX, StartY, TILE_PALETTE, 0, NULL, 0, NULL, 0, pTile)
+#define TILE_PARAMS_MASK		(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+#define TILE_ARGS_MASK			(0, 0, nTileNumber, StartX, StartY, TILE_PALETTE, nMaskColour, NULL, 0, NULL, 0, pTile)
+#define TILE_PARAMS_PRIO		(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+#define TILE_ARGS_PRIO			(0, 0, nTileNumber, StartX, StartY, TILE_PALETTE, 0, NULL, nPriority, NULL, 0, pTile)
+#define TILE_PARAMS_PRIO_MASK	(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+#define TILE_ARGS_PRIO_MASK		(0, 0, nTileNumber, StartX, StartY, TILE_PALETTE, nMaskColour, NULL, nPriority, NULL, 0, pTile)
+
+// Custom size tiles
+#define CTILE_PARAMS			(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+#define CTILE_ARGS				(nWidth, nHeight, nTileNumber, StartX, StartY, TILE_PALETTE, 0, NULL, 0, NULL, 0, pTile)
+#define CTILE_PARAMS_MASK		(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+#define CTILE_ARGS_MASK			(nWidth, nHeight, nTileNumber, StartX, StartY, TILE_PALETTE, nMaskColour, NULL, 0, NULL, 0, pTile)
+#define CTILE_PARAMS_TRANS		(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, UINT8 *pTile)
+#define CTILE_ARGS_TRANS		(nWidth, nHeight, nTileNumber, StartX, StartY, TILE_PALETTE, 0, pTransTable, 0, NULL, 0, pTile)
+#define CTILE_PARAMS_PRIO		(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+#define CTILE_ARGS_PRIO			(nWidth, nHeight, nTileNumber, StartX, StartY, TILE_PALETTE, 0, NULL, nPriority, NULL, 0, pTile)
+#define CTILE_PARAMS_PRIO_MASK	(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+#define CTILE_ARGS_PRIO_MASK	(nWidth, nHeight, nTileNumber, StartX, StartY, TILE_PALETTE, nMaskColour, NULL, nPriority, NULL, 0, pTile)
+#define CTILE_PARAMS_PRIO_TRANS	(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
+#define CTILE_ARGS_PRIO_TRANS	(nWidth, nHeight, nTileNumber, StartX, StartY, TILE_PALETTE, 0, pTransTable, nPriority, NULL, 0, pTile)
+
+TILE_FUNCS(Render8x8Tile,                   8, TILE_DRAW_OPAQUE,   false, TILE_PARAMS,           TILE_ARGS)
+TILE_FUNCS(Render8x8Tile_Mask,              8, TILE_DRAW_MASK,     false, TILE_PARAMS_MASK,      TILE_ARGS_MASK)
+TILE_FUNCS(Render8x8Tile_Prio,              8, TILE_DRAW_OPAQUE,   true,  TILE_PARAMS_PRIO,      TILE_ARGS_PRIO)
+TILE_FUNCS(Render8x8Tile_Prio_Mask,         8, TILE_DRAW_MASK,     true,  TILE_PARAMS_PRIO_MASK, TILE_ARGS_PRIO_MASK)
+
+TILE_FUNCS(Render16x16Tile,                16, TILE_DRAW_OPAQUE,   false, TILE_PARAMS,           TILE_ARGS)
+TILE_FUNCS(Render16x16Tile_Mask,           16, TILE_DRAW_MASK,     false, TILE_PARAMS_MASK,      TILE_ARGS_MASK)
+TILE_FUNCS(Render16x16Tile_Prio,           16, TILE_DRAW_OPAQUE,   true,  TILE_PARAMS_PRIO,      TILE_ARGS_PRIO)
+TILE_FUNCS(Render16x16Tile_Prio_Mask,      16, TILE_DRAW_MASK,     true,  TILE_PARAMS_PRIO_MASK, TILE_ARGS_PRIO_MASK)
+
+TILE_FUNCS(Render32x32Tile,                32, TILE_DRAW_OPAQUE,   false, TILE_PARAMS,           TILE_ARGS)
+TILE_FUNCS(Render32x32Tile_Mask,           32, TILE_DRAW_MASK,     false, TILE_PARAMS_MASK,      TILE_ARGS_MASK)
+TILE_FUNCS(Render32x32Tile_Prio,           32, TILE_DRAW_OPAQUE,   true,  TILE_PARAMS_PRIO,      TILE_ARGS_PRIO)
+TILE_FUNCS(Render32x32Tile_Prio_Mask,      32, TILE_DRAW_MASK,     true,  TILE_PARAMS_PRIO_MASK, TILE_ARGS_PRIO_MASK)
+
+TILE_FUNCS(RenderCustomTile,                0, TILE_DRAW_OPAQUE,   false, CTILE_PARAMS,            CTILE_ARGS)
+TILE_FUNCS(RenderCustomTile_Mask,           0, TILE_DRAW_MASK,     false, CTILE_PARAMS_MASK,       CTILE_ARGS_MASK)
+TILE_FUNCS(RenderCustomTile_TransMask,      0, TILE_DRAW_TRANSTAB, false, CTILE_PARAMS_TRANS,      CTILE_ARGS_TRANS)
+TILE_FUNCS(RenderCustomTile_Prio,           0, TILE_DRAW_OPAQUE,   true,  CTILE_PARAMS_PRIO,       CTILE_ARGS_PRIO)
+TILE_FUNCS(RenderCustomTile_Prio_Mask,      0, TILE_DRAW_MASK,     true,  CTILE_PARAMS_PRIO_MASK,  CTILE_ARGS_PRIO_MASK)
+TILE_FUNCS(RenderCustomTile_Prio_TransMask, 0, TILE_DRAW_TRANSTAB, true,  CTILE_PARAMS_PRIO_TRANS, CTILE_ARGS_PRIO_TRANS)
+
+// Alpha blended tiles, drawn onto a 32-bit RGB buffer of nScreenWidth x nScreenHeight (always clipped)
+void RenderCustomTile_Alpha(UINT32* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 FlipX, INT32 FlipY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT32* pPalette, INT32 nAlpha, UINT8 *pTile)
+{
+	TILE_FUNC_CHECK(RenderCustomTile_Alpha)
+
+	TileArgs a = { nWidth, nHeight, nTileNumber, StartX, StartY, TILE_PALETTE, nMaskColour, NULL, 0, pPalette, nAlpha, pTile };
+
+	if (FlipY) {
+		if (FlipX) {
+			RenderTileT<UINT32, 0, TILE_DRAW_MASK, true,  true,  true, false, true>(pDestDraw, a);
+		} else {
+			RenderTileT<UINT32, 0, TILE_DRAW_MASK, false, true,  true, false, true>(pDestDraw, a);
+		}
+	} else {
+		if (FlipX) {
+			RenderTileT<UINT32, 0, TILE_DRAW_MASK, true,  false, true, false, true>(pDestDraw, a);
+		} else {
+			RenderTileT<UINT32, 0, TILE_DRAW_MASK, false, false, true, false, true>(pDestDraw, a);
+		}
+	}
+}
+
+#undef TILE_DRAW_OPAQUE
+#undef TILE_DRAW_MASK
+#undef TILE_DRAW_TRANSTAB
+#undef TILE_FUNC_CHECK
+#undef TILE_EXPAND
+#undef TILE_FUNC
+#undef TILE_FUNCS
+#undef TILE_PALETTE
+#undef TILE_PARAMS
+#undef TILE_ARGS
+#undef TILE_PARAMS_MASK
+#undef TILE_ARGS_MASK
+#undef TILE_PARAMS_PRIO
+#undef TILE_ARGS_PRIO
+#undef TILE_PARAMS_PRIO_MASK
+#undef TILE_ARGS_PRIO_MASK
+#undef CTILE_PARAMS
+#undef CTILE_ARGS
+#undef CTILE_PARAMS_MASK
+#undef CTILE_ARGS_MASK
+#undef CTILE_PARAMS_TRANS
+#undef CTILE_ARGS_TRANS
+#undef CTILE_PARAMS_PRIO
+#undef CTILE_ARGS_PRIO
+#undef CTILE_PARAMS_PRIO_MASK
+#undef CTILE_ARGS_PRIO_MASK
+#undef CTILE_PARAMS_PRIO_TRANS
+#undef CTILE_ARGS_PRIO_TRANS
 
 /*================================================================================================
 Merged tile functions (flipping/clipping merged)
@@ -5829,6 +2008,15 @@ void DrawGfxTile(INT32 nBitmap, INT32 nGfx, INT32 nTileNumber, INT32 nStartX, IN
 
 void DrawGfxMaskTile(INT32 nBitmap, INT32 nGfx, INT32 nTileNumber, INT32 nStartX, INT32 nStartY, INT32 nFlipx, INT32 nFlipy, INT32 nTilePalette, INT32 nMaskColor)
 {
+	INT32 nClass = GenericTilesGetTileClass(nGfx, nTileNumber, nMaskColor);
+
+	if (nClass == GFX_TILE_TRANSPARENT) return;
+
+	if (nClass == GFX_TILE_OPAQUE) {
+		DrawGfxTile(nBitmap, nGfx, nTileNumber, nStartX, nStartY, nFlipx, nFlipy, nTilePalette);
+		return;
+	}
+
 	UINT16 *bitmap;
 	if (nBitmap != 0)
 	{
@@ -5883,6 +2071,15 @@ void DrawGfxPrioTile(INT32 nBitmap, INT32 nGfx, INT32 nTileNumber, INT32 nStartX
 
 void DrawGfxPrioMaskTile(INT32 nBitmap, INT32 nGfx, INT32 nTileNumber, INT32 nStartX, INT32 nStartY, INT32 nFlipx, INT32 nFlipy, INT32 nTilePalette, INT32 nMaskColor, INT32 nPriority)
 {
+	INT32 nClass = GenericTilesGetTileClass(nGfx, nTileNumber, nMaskColor);
+
+	if (nClass == GFX_TILE_TRANSPARENT) return;
+
+	if (nClass == GFX_TILE_OPAQUE) {
+		DrawGfxPrioTile(nBitmap, nGfx, nTileNumber, nStartX, nStartY, nFlipx, nFlipy, nTilePalette, nPriority);
+		return;
+	}
+
 	UINT16 *bitmap;
 	if (nBitmap != 0)
 	{
@@ -11,6 +11,15 @@ extern PRIORITY_TYPE* pPrioDraw;
 int GenericTilesInit();
 int GenericTilesExit();
 void GenericTilesSetGfx(INT32 nNum, UINT8 *GfxBase, INT32 nDepth, INT32 nTileWidth, INT32 nTileHeight, INT32 nGfxLen, UINT32 nColorOffset, UINT32 nColorMask);
+
+// Tile classification against a transparent pen, see GenericTilesClassifyGfx()
+#define GFX_TILE_MIXED			0
+#define GFX_TILE_TRANSPARENT	1	// every pixel is the transparent pen
+#define GFX_TILE_OPAQUE			2	// no pixel is the transparent pen
+
+void GenericTilesSetGfx(INT32 nNum, UINT8 *GfxBase, INT32 nDepth, INT32 nTileWidth, INT32 nTileHeight, INT32 nGfxLen, UINT32 nColorOffset, UINT32 nColorMask, INT32 nTransPen);
+void GenericTilesClassifyGfx(INT32 nNum, INT32 nTransPen);
+INT32 GenericTilesGetTileClass(INT32 nNum, INT32 nCode, INT32 nTransPen);
 void BurnTransferClear();
 INT32 BurnTransferCopy(UINT32* pPalette);
 
@@ -86,6 +95,19 @@ void RenderZoomedSprite(unsigned short* pDestDraw, int nWidth, int nHeight, int
 
 void RenderTileTranstab(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 trans_col, INT32 sx, INT32 sy, INT32 flipx, INT32 flipy, INT32 width, INT32 height, UINT8 *tab);
 
+// Custom size tiles, pixels with pTransTable[pixel] != 0 are skipped
+void RenderCustomTile_TransMask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, UINT8 *pTile);
+void RenderCustomTile_TransMask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, UINT8 *pTile);
+void RenderCustomTile_TransMask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, UINT8 *pTile);
+void RenderCustomTile_TransMask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, UINT8 *pTile);
+void RenderCustomTile_TransMask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, UINT8 *pTile);
+void RenderCustomTile_TransMask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, UINT8 *pTile);
+void RenderCustomTile_TransMask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, UINT8 *pTile);
+void RenderCustomTile_TransMask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, UINT8 *pTile);
+
+// Custom size tile alpha blended onto a 32-bit RGB buffer (nAlpha 0 - 256), always clipped
+void RenderCustomTile_Alpha(UINT32* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 FlipX, INT32 FlipY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT32* pPalette, INT32 nAlpha, UINT8 *pTile);
+
 INT32 BurnTransferInit();
 void BurnTransferExit();
 
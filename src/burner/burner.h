@@ -11,6 +11,8 @@ typedef char TCHAR;
 #endif
 
 typedef int INT32;
+typedef unsigned char UINT8;
+typedef unsigned int UINT32;
 
 #define TEXT(a) a
 #define MAX_PATH 260
@@ -27,5 +29,53 @@ extern int InpExit();
 // Function prototypes
 INT32 BurnLibInit();
 INT32 BurnLibExit();
+INT32 BurnDrvReset();
+
+// statec.cpp (metal_state_helpers.cpp in the metal build)
+#ifdef __cplusplus
+extern "C" {
+#endif
+INT32 BurnStateCompress(UINT8** pDef, INT32* pnDefLen, INT32 bAll);
+INT32 BurnStateDecompress(UINT8* Def, INT32 nDefLen, INT32 bAll);
+INT32 BurnStateDeltaInit(INT32 nPageSize);
+INT32 BurnStateDeltaRebase();
+INT32 BurnStateDeltaGetMaxLen();
+INT32 BurnStateDeltaSave(UINT8* pDef, INT32 nDefMaxLen, INT32* pnDefLen);
+INT32 BurnStateDeltaLoad(UINT8* Def, INT32 nDefLen);
+void BurnStateDeltaExit();
+UINT32 BurnStateDeltaChecksum(UINT8* Def, INT32 nDefLen);
+#ifdef __cplusplus
+}
+#endif
+
+// rollback.cpp
+struct RollbackTransport {
+	INT32 (*Send)(const UINT8* pData, INT32 nLen);
+	INT32 (*Receive)(UINT8* pData, INT32 nMaxLen);		// non-blocking, 0 = nothing waiting
+};
+struct RollbackStats {
+	INT32 nRollbacks;
+	INT32 nFramesResimulated;
+	double dResimulateMs;								// nFramesResimulated / dResimulateMs = frames per ms
+	INT32 nPredicted;
+	INT32 nStalls;
+	INT32 nChecksMatched;
+};
+
+extern INT32 bRollbackSession;
+INT32 RollbackInit(INT32 nLocalPlayer, INT32 nDelay, INT32 nPredict, RollbackTransport* pt);
+void RollbackExit();
+INT32 RollbackFrame();									// call after the inputs are made, non-zero = don't run this frame
+bool RollbackDesynced();
+void RollbackGetStats(RollbackStats* ps);
+RollbackTransport* RollbackUdpOpen(INT32 nLocalPort, const char* szRemoteHost, INT32 nRemotePort);
+void RollbackUdpClose();
+
+// zipfn.cpp
+struct ZipPrefetch { char* szZip; INT32 nEntry; INT32 nLen; };	// szZip has no extension, NULL = don't prefetch
+
+INT32 ZipPrefetchStart(struct ZipPrefetch* pList, INT32 nCount);
+INT32 ZipPrefetchLoad(INT32 nItem, UINT8* Dest, INT32 nLen, INT32* pnWrote);	// -1 = not prefetched, load it normally
+void ZipPrefetchStop();
 
 #endif // _BURNER_H 
\ No newline at end of file
@@ -0,0 +1,654 @@
+// Rollback netplay session                                    (see burner.h)
+#include "burner.h"
+#include <chrono>
+
+#if defined (_WIN32)
+ #include <winsock2.h>
+ #include <ws2tcpip.h>
+ typedef int socklen_t;
+#else
+ #include <sys/types.h>
+ #include <sys/socket.h>
+ #include <netinet/in.h>
+ #include <arpa/inet.h>
+ #include <netdb.h>
+ #include <unistd.h>
+ #include <fcntl.h>
+ #define closesocket close
+#endif
+
+// history
+//
+// Two player sessions.  Every frame:
+//  - the local input is packed into a block and queued nInputDelay frames ahead,
+//  - all unacknowledged local blocks go out in one packet (lost packets don't matter),
+//  - remote blocks that arrived are checked against what was predicted for them,
+//    if one was wrong, the state from that frame is loaded and the frames up to now
+//    are simulated again with drawing and sound disabled,
+//  - the remote block for this frame is predicted by repeating the last known one.
+// States are kept in a ring as deltas (BurnStateDelta*), their checksums are exchanged
+// for frames both sides know all inputs for, a mismatch means the session desynced.
+
+#define DEBUG_ROLLBACK 0
+#define rollbacklog(x) do { if (DEBUG_ROLLBACK) bprintf x; } while (0)
+
+#define ROLLBACK_RING			32			// frames of inputs and states kept
+#define ROLLBACK_INPUT_MAX		64			// bytes in one player's input block
+#define ROLLBACK_PACKET_MAX		(sizeof(RollbackPacket) + ROLLBACK_RING * ROLLBACK_INPUT_MAX)
+
+static const UINT32 ROLLBACK_MAGIC = 0x314b4252; // "RBK1"
+
+// the header goes out in network byte order, the input blocks are bytes already
+struct RollbackPacket {
+	UINT32 nMagic;
+	INT32 nFirstFrame;		// frame of the first input block
+	UINT16 nCount;			// input blocks that follow
+	UINT16 nInputSize;
+	INT32 nAckFrame;		// last frame we have the sender's input for
+	INT32 nCheckFrame;		// frame nChecksum belongs to, -1 = none
+	UINT32 nChecksum;
+};
+
+struct RollbackInput { UINT8 Data[ROLLBACK_INPUT_MAX]; INT32 nFrame; bool bKnown; };
+struct RollbackState { UINT8* Data; INT32 nLen; INT32 nFrame; UINT32 nChecksum; bool bChecksum; };
+
+INT32 bRollbackSession = 0;
+
+static RollbackTransport* pTransport = NULL;
+static RollbackInput Inputs[2][ROLLBACK_RING];
+static RollbackState States[ROLLBACK_RING];
+static INT32 nStateMaxLen = 0;
+
+static INT32 nLocal = 0;				// local player, 0 or 1
+static INT32 nInputDelay = 0;
+static INT32 nMaxPredict = 0;
+static INT32 nFrame = 0;				// frame about to run
+static INT32 nRemoteFrame = -1;			// last frame with a known remote input
+static INT32 nRemoteAck = -1;			// last frame of ours the remote has
+static INT32 nFirstWrong = 0x7fffffff;	// first frame simulated with a wrong prediction
+static INT32 nStateBase = 0;			// can't roll back past this frame (reference rebased)
+static INT32 nPendingCheckFrame = -1;
+static UINT32 nPendingChecksum = 0;
+static bool bDesynced = false;
+
+static RollbackStats Stats;
+
+// ---------------------------------------------------------------------------
+// Input blocks, laid out like the Kaillera ones: digital bits, then analog & constant bytes
+
+static INT32 nPlayerOffset[2], nPlayerInputs[2], nCommonOffset, nCommonInputs;
+static INT32 nInputSize = 0;
+
+static INT32 RollbackInitInputs()
+{
+	struct BurnInputInfo bii;
+	memset(&bii, 0, sizeof(bii));
+
+	UINT32 i = 0;
+
+	for (INT32 p = 0; p < 2; p++) {
+		char szString[3] = "P?";
+		szString[1] = p + '1';
+		nPlayerOffset[p] = i;
+		while (i < nGameInpCount && BurnDrvGetInputInfo(&bii, i) == 0 && !_strnicmp(bii.szName, szString, 2)) {
+			i++;
+		}
+		nPlayerInputs[p] = i - nPlayerOffset[p];
+	}
+
+	// skip P3 / P4, then the common inputs up to the dip switches
+	while (i < nGameInpCount && BurnDrvGetInputInfo(&bii, i) == 0 && bii.szName[0] == 'P' && bii.szName[1] >= '3' && bii.szName[1] <= '9') {
+		i++;
+	}
+
+	nCommonOffset = i;
+	while (i < nGameInpCount && BurnDrvGetInputInfo(&bii, i) == 0 && (bii.nType & BIT_GROUP_CONSTANT) == 0) {
+		i++;
+	}
+	nCommonInputs = i - nCommonOffset;
+
+	nInputSize = 0;
+	for (INT32 p = 0; p < 2; p++) {
+		INT32 nBits = nCommonInputs, nBytes = 0;
+
+		for (INT32 j = 0; j < nPlayerInputs[p]; j++) {
+			BurnDrvGetInputInfo(&bii, nPlayerOffset[p] + j);
+			if (bii.nType == BIT_DIGITAL) {
+				nBits++;
+			} else {
+				nBytes += (bii.nType & BIT_GROUP_ANALOG) ? 2 : 1;
+			}
+		}
+
+		if ((nBits + 7) / 8 + nBytes > nInputSize) {
+			nInputSize = (nBits + 7) / 8 + nBytes;
+		}
+	}
+
+	if (nInputSize > ROLLBACK_INPUT_MAX) {
+		bprintf(PRINT_ERROR, _T("Rollback: input block too large (%d bytes)\n"), nInputSize);
+		return 1;
+	}
+
+	if (nInputSize == 0) nInputSize = 1;
+
+	return 0;
+}
+
+static void RollbackPackInput(INT32 nPlayer, UINT8* pBlock)
+{
+	struct BurnInputInfo bii;
+	memset(&bii, 0, sizeof(bii));
+	memset(pBlock, 0, ROLLBACK_INPUT_MAX);
+
+	INT32 i, j = 0;
+
+	for (i = 0; i < nPlayerInputs[nPlayer]; i++) {
+		BurnDrvGetInputInfo(&bii, nPlayerOffset[nPlayer] + i);
+		if (bii.nType == BIT_DIGITAL) {
+			if (bii.pVal && *bii.pVal) pBlock[j >> 3] |= 1 << (j & 7);
+			j++;
+		}
+	}
+	for (i = 0; i < nCommonInputs; i++, j++) {
+		BurnDrvGetInputInfo(&bii, nCommonOffset + i);
+		if (bii.pVal && *bii.pVal) pBlock[j >> 3] |= 1 << (j & 7);
+	}
+
+	j = (j + 7) >> 3;
+
+	for (i = 0; i < nPlayerInputs[nPlayer]; i++) {
+		BurnDrvGetInputInfo(&bii, nPlayerOffset[nPlayer] + i);
+		if (bii.nType == BIT_DIGITAL) continue;
+
+		if (bii.nType & BIT_GROUP_ANALOG) {
+			if (bii.pShortVal) {
+				pBlock[j + 0] = *bii.pShortVal >> 8;
+				pBlock[j + 1] = *bii.pShortVal & 0xff;
+			}
+			j += 2;
+		} else {
+			if (bii.pVal) pBlock[j] = *bii.pVal;
+			j++;
+		}
+	}
+}
+
+// common inputs (service, reset, ..) are taken from player 1's block
+static void RollbackUnpackInput(INT32 nPlayer, const UINT8* pBlock)
+{
+	struct BurnInputInfo bii;
+	memset(&bii, 0, sizeof(bii));
+
+	INT32 i, j = 0;
+
+	for (i = 0; i < nPlayerInputs[nPlayer]; i++) {
+		BurnDrvGetInputInfo(&bii, nPlayerOffset[nPlayer] + i);
+		if (bii.nType == BIT_DIGITAL) {
+			if (bii.pVal) *bii.pVal = (pBlock[j >> 3] >> (j & 7)) & 1;
+			j++;
+		}
+	}
+	for (i = 0; i < nCommonInputs; i++, j++) {
+		if (nPlayer != 0) continue;
+		BurnDrvGetInputInfo(&bii, nCommonOffset + i);
+		if (bii.pVal) *bii.pVal = (pBlock[j >> 3] >> (j & 7)) & 1;
+	}
+
+	j = (j + 7) >> 3;
+
+	for (i = 0; i < nPlayerInputs[nPlayer]; i++) {
+		BurnDrvGetInputInfo(&bii, nPlayerOffset[nPlayer] + i);
+		if (bii.nType == BIT_DIGITAL) continue;
+
+		if (bii.nType & BIT_GROUP_ANALOG) {
+			if (bii.pShortVal) *bii.pShortVal = (pBlock[j] << 8) | pBlock[j + 1];
+			j += 2;
+		} else {
+			if (bii.pVal) *bii.pVal = pBlock[j];
+			j++;
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+// State ring
+
+static INT32 RollbackSaveState(INT32 nStateFrame)
+{
+	RollbackState* ps = &States[nStateFrame % ROLLBACK_RING];
+
+	if (BurnStateDeltaSave(ps->Data, nStateMaxLen, &ps->nLen)) {
+		// the driver's list of areas changed, older deltas can't be loaded anymore
+		rollbacklog((0, _T("Rollback: rebasing states at frame %d\n"), nStateFrame));
+
+		if (BurnStateDeltaRebase()) return 1;
+
+		nStateMaxLen = BurnStateDeltaGetMaxLen();
+		for (INT32 i = 0; i < ROLLBACK_RING; i++) {
+			free(States[i].Data);
+			States[i].Data = (UINT8*)malloc(nStateMaxLen);
+			States[i].nFrame = -1;
+			if (States[i].Data == NULL) return 1;
+		}
+		nStateBase = nStateFrame;
+
+		if (BurnStateDeltaSave(ps->Data, nStateMaxLen, &ps->nLen)) return 1;
+	}
+
+	ps->nFrame = nStateFrame;
+	ps->bChecksum = false;
+
+	return 0;
+}
+
+static INT32 RollbackChecksum(INT32 nStateFrame, UINT32* pnChecksum)
+{
+	RollbackState* ps = &States[nStateFrame % ROLLBACK_RING];
+
+	if (ps->nFrame != nStateFrame) return 1;
+
+	if (!ps->bChecksum) {
+		ps->nChecksum = BurnStateDeltaChecksum(ps->Data, ps->nLen);
+		ps->bChecksum = true;
+	}
+
+	*pnChecksum = ps->nChecksum;
+
+	return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Packets
+
+static void RollbackSend()
+{
+	UINT8 Packet[ROLLBACK_PACKET_MAX];
+	RollbackPacket* pp = (RollbackPacket*)Packet;
+
+	INT32 nFirst = nRemoteAck + 1;
+	INT32 nLast = nFrame + nInputDelay;
+	if (nFirst < nLast - (ROLLBACK_RING - 1)) nFirst = nLast - (ROLLBACK_RING - 1);
+
+	// the newest state both sides have all the inputs for
+	INT32 nCheckFrame = (nRemoteFrame + 1 < nFrame - 1) ? (nRemoteFrame + 1) : (nFrame - 1);
+	UINT32 nChecksum = 0;
+	if (nCheckFrame <= nStateBase || RollbackChecksum(nCheckFrame, &nChecksum)) {
+		nCheckFrame = -1;
+		nChecksum = 0;
+	}
+
+	pp->nMagic = htonl(ROLLBACK_MAGIC);
+	pp->nFirstFrame = htonl(nFirst);
+	pp->nCount = htons((nLast >= nFirst) ? (nLast - nFirst + 1) : 0);
+	pp->nInputSize = htons(nInputSize);
+	pp->nAckFrame = htonl(nRemoteFrame);
+	pp->nCheckFrame = htonl(nCheckFrame);
+	pp->nChecksum = htonl(nChecksum);
+
+	UINT8* pData = Packet + sizeof(RollbackPacket);
+	for (INT32 f = nFirst; f <= nLast; f++) {
+		memcpy(pData, Inputs[nLocal][f % ROLLBACK_RING].Data, nInputSize);
+		pData += nInputSize;
+	}
+
+	pTransport->Send(Packet, pData - Packet);
+}
+
+static void RollbackCheckDesync(INT32 nCheckFrame, UINT32 nChecksum)
+{
+	UINT32 nLocalChecksum;
+
+	if (nCheckFrame <= nStateBase || RollbackChecksum(nCheckFrame, &nLocalChecksum)) return;
+
+	if (nLocalChecksum != nChecksum && !bDesynced) {
+		bprintf(PRINT_ERROR, _T("Rollback: desync at frame %d (%08x local, %08x remote)\n"), nCheckFrame, nLocalChecksum, nChecksum);
+		bDesynced = true;
+	}
+
+	Stats.nChecksMatched += (nLocalChecksum == nChecksum);
+}
+
+static void RollbackReceive()
+{
+	UINT8 Packet[ROLLBACK_PACKET_MAX];
+	INT32 nLen;
+
+	while ((nLen = pTransport->Receive(Packet, sizeof(Packet))) > 0) {
+		if (nLen < (INT32)sizeof(RollbackPacket)) continue;
+
+		RollbackPacket Header;
+		RollbackPacket* pp = &Header;
+		memcpy(pp, Packet, sizeof(RollbackPacket));
+		pp->nMagic = ntohl(pp->nMagic);
+		pp->nFirstFrame = ntohl(pp->nFirstFrame);
+		pp->nCount = ntohs(pp->nCount);
+		pp->nInputSize = ntohs(pp->nInputSize);
+		pp->nAckFrame = ntohl(pp->nAckFrame);
+		pp->nCheckFrame = ntohl(pp->nCheckFrame);
+		pp->nChecksum = ntohl(pp->nChecksum);
+
+		if (pp->nMagic != ROLLBACK_MAGIC || pp->nInputSize != nInputSize) continue;
+		if (nLen < (INT32)(sizeof(RollbackPacket) + pp->nCount * nInputSize)) continue;
+
+		if (pp->nAckFrame > nRemoteAck) nRemoteAck = pp->nAckFrame;
+
+		const UINT8* pData = Packet + sizeof(RollbackPacket);
+		for (INT32 i = 0; i < pp->nCount; i++, pData += nInputSize) {
+			INT32 f = pp->nFirstFrame + i;
+
+			if (f != nRemoteFrame + 1) continue;			// old, or a gap: wait for a resend
+
+			RollbackInput* pi = &Inputs[nLocal ^ 1][f % ROLLBACK_RING];
+
+			if (f < nFrame && pi->nFrame == f && memcmp(pi->Data, pData, nInputSize)) {
+				if (f < nFirstWrong) nFirstWrong = f;
+			}
+
+			memcpy(pi->Data, pData, nInputSize);
+			pi->nFrame = f;
+			pi->bKnown = true;
+			nRemoteFrame = f;
+		}
+
+		if (pp->nCheckFrame >= 0) {
+			nPendingCheckFrame = pp->nCheckFrame;
+			nPendingChecksum = pp->nChecksum;
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+// Remote input for frame f: the real one, or the last known one repeated
+static const UINT8* RollbackRemoteInput(INT32 f)
+{
+	RollbackInput* pi = &Inputs[nLocal ^ 1][f % ROLLBACK_RING];
+
+	if (!(pi->nFrame == f && pi->bKnown)) {
+		RollbackInput* pl = &Inputs[nLocal ^ 1][nRemoteFrame % ROLLBACK_RING];
+
+		if (nRemoteFrame >= 0 && pl->nFrame == nRemoteFrame) {
+			memcpy(pi->Data, pl->Data, nInputSize);
+		} else {
+			memset(pi->Data, 0, nInputSize);
+		}
+		pi->nFrame = f;
+		pi->bKnown = false;
+		Stats.nPredicted++;
+	}
+
+	return pi->Data;
+}
+
+static void RollbackApplyInputs(INT32 f)
+{
+	RollbackUnpackInput(nLocal, Inputs[nLocal][f % ROLLBACK_RING].Data);
+	RollbackUnpackInput(nLocal ^ 1, RollbackRemoteInput(f));
+}
+
+static INT32 RollbackResimulate()
+{
+	INT32 nFrom = nFirstWrong;
+	nFirstWrong = 0x7fffffff;
+
+	if (nFrom < nStateBase || nFrom < nFrame - ROLLBACK_RING + 1) {
+		bprintf(PRINT_ERROR, _T("Rollback: can't roll back to frame %d\n"), nFrom);
+		bDesynced = true;
+		return 1;
+	}
+
+	RollbackState* ps = &States[nFrom % ROLLBACK_RING];
+	if (ps->nFrame != nFrom || BurnStateDeltaLoad(ps->Data, ps->nLen)) {
+		bprintf(PRINT_ERROR, _T("Rollback: state for frame %d is gone\n"), nFrom);
+		bDesynced = true;
+		return 1;
+	}
+
+	UINT8* pBurnDraw_temp = pBurnDraw;
+	INT16* pBurnSoundOut_temp = pBurnSoundOut;
+	UINT32 nCurrentFrame_temp = nCurrentFrame;
+	pBurnDraw = NULL;
+	pBurnSoundOut = NULL;
+	bBurnRunAheadFrame = 1;						// hidden frames, no hiscores, cheats, etc.
+
+	auto tStart = std::chrono::steady_clock::now();
+
+	for (INT32 f = nFrom; f < nFrame; f++) {
+		if (f != nFrom && RollbackSaveState(f)) break;
+		RollbackApplyInputs(f);
+		nCurrentFrame = nCurrentFrame_temp - (nFrame - f);
+		BurnDrvFrame();
+		Stats.nFramesResimulated++;
+	}
+
+	Stats.dResimulateMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tStart).count();
+	Stats.nRollbacks++;
+
+	bBurnRunAheadFrame = 0;
+	nCurrentFrame = nCurrentFrame_temp;
+	pBurnSoundOut = pBurnSoundOut_temp;
+	pBurnDraw = pBurnDraw_temp;
+
+	return 0;
+}
+
+INT32 RollbackFrame()
+{
+	if (!bRollbackSession) return 0;
+
+	// queue the local input, once - it may have been sent already if we stalled
+	RollbackInput* pi = &Inputs[nLocal][(nFrame + nInputDelay) % ROLLBACK_RING];
+	if (pi->nFrame != nFrame + nInputDelay) {
+		RollbackPackInput(nLocal, pi->Data);
+		pi->nFrame = nFrame + nInputDelay;
+		pi->bKnown = true;
+	}
+
+	RollbackReceive();
+
+	if (nFirstWrong < nFrame) {
+		RollbackResimulate();
+	}
+
+	if (nPendingCheckFrame >= 0 && nPendingCheckFrame <= nRemoteFrame + 1 && nPendingCheckFrame < nFrame) {
+		RollbackCheckDesync(nPendingCheckFrame, nPendingChecksum);
+		nPendingCheckFrame = -1;
+	}
+
+	RollbackSend();
+
+	// too far ahead of the remote side, wait for it
+	if (nFrame - nRemoteFrame > nMaxPredict) {
+		Stats.nStalls++;
+		return 1;
+	}
+
+	if (RollbackSaveState(nFrame)) {
+		bprintf(PRINT_ERROR, _T("Rollback: can't save state, ending session\n"));
+		RollbackExit();
+		return 0;
+	}
+
+	RollbackApplyInputs(nFrame);
+	nFrame++;
+
+	return 0;
+}
+
+INT32 RollbackInit(INT32 nLocalPlayer, INT32 nDelay, INT32 nPredict, RollbackTransport* pt)
+{
+	RollbackExit();
+
+	if (pt == NULL || nLocalPlayer < 0 || nLocalPlayer > 1) return 1;
+
+	if (RollbackInitInputs()) return 1;
+
+	if (BurnStateDeltaInit(0)) {
+		bprintf(PRINT_ERROR, _T("Rollback: can't capture the reference state\n"));
+		return 1;
+	}
+
+	nStateMaxLen = BurnStateDeltaGetMaxLen();
+	for (INT32 i = 0; i < ROLLBACK_RING; i++) {
+		States[i].Data = (UINT8*)malloc(nStateMaxLen);
+		States[i].nFrame = -1;
+		if (States[i].Data == NULL) {
+			RollbackExit();
+			BurnStateDeltaExit();
+			return 1;
+		}
+	}
+
+	pTransport = pt;
+	nLocal = nLocalPlayer;
+	nInputDelay = (nDelay < 0) ? 0 : (nDelay > 8) ? 8 : nDelay;
+
+	// the remote side can send inputs up to nMaxPredict + 2 * nInputDelay frames past the
+	// oldest one we may roll back to, all of those have to fit in the ring
+	INT32 nPredictMax = (ROLLBACK_RING - 2 * nInputDelay) / 2 - 1;
+	nMaxPredict = (nPredict < 1) ? 1 : (nPredict > nPredictMax) ? nPredictMax : nPredict;
+
+	for (INT32 p = 0; p < 2; p++) {
+		for (INT32 i = 0; i < ROLLBACK_RING; i++) {
+			memset(&Inputs[p][i], 0, sizeof(RollbackInput));
+			Inputs[p][i].nFrame = -1;
+		}
+
+		// the first nInputDelay frames have no input from either side
+		for (INT32 f = 0; f < nInputDelay; f++) {
+			Inputs[p][f].nFrame = f;
+			Inputs[p][f].bKnown = true;
+		}
+	}
+
+	nFrame = 0;
+	nRemoteFrame = nInputDelay - 1;
+	nRemoteAck = nInputDelay - 1;
+	nFirstWrong = 0x7fffffff;
+	nStateBase = 0;
+	nPendingCheckFrame = -1;
+	bDesynced = false;
+	memset(&Stats, 0, sizeof(Stats));
+
+	bRollbackSession = 1;
+
+	bprintf(0, _T("Rollback: player %d, input delay %d, predicting up to %d frames, %d byte inputs, %x byte states\n"), nLocal + 1, nInputDelay, nMaxPredict, nInputSize, nStateMaxLen);
+
+	return 0;
+}
+
+void RollbackExit()
+{
+	if (bRollbackSession && Stats.nFramesResimulated) {
+		bprintf(0, _T("Rollback: %d rollbacks, %d frames re-simulated, %.2f frames/ms\n"), Stats.nRollbacks, Stats.nFramesResimulated, Stats.nFramesResimulated / (Stats.dResimulateMs > 0 ? Stats.dResimulateMs : 1));
+	}
+
+	for (INT32 i = 0; i < ROLLBACK_RING; i++) {
+		free(States[i].Data);
+		States[i].Data = NULL;
+		States[i].nFrame = -1;
+	}
+
+	if (bRollbackSession) BurnStateDeltaExit();
+
+	pTransport = NULL;
+	nStateMaxLen = 0;
+	bRollbackSession = 0;
+}
+
+bool RollbackDesynced()
+{
+	return bDesynced;
+}
+
+void RollbackGetStats(RollbackStats* ps)
+{
+	*ps = Stats;
+}
+
+// ---------------------------------------------------------------------------
+// UDP transport, non-blocking.  For a loopback test run two instances with
+// RollbackUdpOpen(7000, "127.0.0.1", 7001) and RollbackUdpOpen(7001, "127.0.0.1", 7000).
+
+static INT32 nUdpSocket = -1;
+static struct sockaddr_in UdpRemote;
+
+static INT32 RollbackUdpSend(const UINT8* pData, INT32 nLen)
+{
+	return sendto(nUdpSocket, (const char*)pData, nLen, 0, (struct sockaddr*)&UdpRemote, sizeof(UdpRemote));
+}
+
+static INT32 RollbackUdpReceive(UINT8* pData, INT32 nMaxLen)
+{
+	struct sockaddr_in From;
+	socklen_t nFromLen = sizeof(From);
+
+	INT32 nLen = recvfrom(nUdpSocket, (char*)pData, nMaxLen, 0, (struct sockaddr*)&From, &nFromLen);
+
+	// only take packets from the peer
+	if (nLen > 0 && (From.sin_addr.s_addr != UdpRemote.sin_addr.s_addr || From.sin_port != UdpRemote.sin_port)) return 0;
+
+	return nLen;
+}
+
+static RollbackTransport UdpTransport = { RollbackUdpSend, RollbackUdpReceive };
+
+RollbackTransport* RollbackUdpOpen(INT32 nLocalPort, const char* szRemoteHost, INT32 nRemotePort)
+{
+	RollbackUdpClose();
+
+#if defined (_WIN32)
+	WSADATA wsa;
+	if (WSAStartup(MAKEWORD(2, 2), &wsa)) return NULL;
+#endif
+
+	struct addrinfo Hints, *pResult = NULL;
+	memset(&Hints, 0, sizeof(Hints));
+	Hints.ai_family = AF_INET;
+	Hints.ai_socktype = SOCK_DGRAM;
+
+	if (getaddrinfo(szRemoteHost, NULL, &Hints, &pResult) || pResult == NULL) {
+		bprintf(PRINT_ERROR, _T("Rollback: can't resolve %s\n"), szRemoteHost);
+		return NULL;
+	}
+
+	memcpy(&UdpRemote, pResult->ai_addr, sizeof(UdpRemote));
+	UdpRemote.sin_port = htons(nRemotePort);
+	freeaddrinfo(pResult);
+
+	nUdpSocket = socket(AF_INET, SOCK_DGRAM, 0);
+	if (nUdpSocket < 0) return NULL;
+
+	struct sockaddr_in Local;
+	memset(&Local, 0, sizeof(Local));
+	Local.sin_family = AF_INET;
+	Local.sin_addr.s_addr = htonl(INADDR_ANY);
+	Local.sin_port = htons(nLocalPort);
+
+	if (bind(nUdpSocket, (struct sockaddr*)&Local, sizeof(Local)) < 0) {
+		bprintf(PRINT_ERROR, _T("Rollback: can't bind port %d\n"), nLocalPort);
+		RollbackUdpClose();
+		return NULL;
+	}
+
+#if defined (_WIN32)
+	u_long nNonBlocking = 1;
+	ioctlsocket(nUdpSocket, FIONBIO, &nNonBlocking);
+#else
+	fcntl(nUdpSocket, F_SETFL, fcntl(nUdpSocket, F_GETFL, 0) | O_NONBLOCK);
+#endif
+
+	return &UdpTransport;
+}
+
+void RollbackUdpClose()
+{
+	if (nUdpSocket >= 0) {
+		closesocket(nUdpSocket);
+		nUdpSocket = -1;
+#if defined (_WIN32)
+		WSACleanup();
+#endif
+	}
+}
@@ -391,23 +391,30 @@ static int __cdecl BzipBurnLoadRom(unsigned char* Dest, int* pnWrote, int i)
 	}
 
 	nWantZip = RomFind[i].nZip;                                                          // Which zip file it is in
-	if (nCurrentZip != nWantZip)                                                         // If we haven't got the right zip file currently open
+
+	nRet = ZipPrefetchLoad(i, Dest, ri.nLen, pnWrote);                                   // Already inflated by a prefetch thread?
+	if (nRet < 0)
 	{
-		ZipClose();
-		nCurrentZip = -1;
-		if (ZipOpen(TCHARToANSI(szBzipName[nWantZip], NULL, 0)))
+		if (nCurrentZip != nWantZip)                                                 // If we haven't got the right zip file currently open
 		{
-			return 1;
+			ZipClose();
+			nCurrentZip = -1;
+			if (ZipOpen(TCHARToANSI(szBzipName[nWantZip], NULL, 0)))
+			{
+				return 1;
+			}
+			nCurrentZip = nWantZip;
 		}
-		nCurrentZip = nWantZip;
+
+		// Read in file and return how many bytes we read
+		nRet = ZipLoadFile(Dest, ri.nLen, pnWrote, RomFind[i].nPos);
 	}
 
-	// Read in file and return how many bytes we read
-	if (ZipLoadFile(Dest, ri.nLen, pnWrote, RomFind[i].nPos))
+	if (nRet)
 	{
 		// Error loading from the zip file
 		TCHAR szTemp[128] = _T("");
-		_stprintf(szTemp, _T("%s reading %.30hs from %.30s"), nRet == 2 ? _T("CRC error") : _T("Error"), pszRomName, GetFilenameW(szBzipName[nCurrentZip]));
+		_stprintf(szTemp, _T("%s reading %.30hs from %.30s"), nRet == 2 ? _T("CRC error") : _T("Error"), pszRomName, GetFilenameW(szBzipName[nWantZip]));
 		fprintf(stderr, szTemp);
 		AppError(szTemp, 1);
 		return 1;
@@ -741,6 +748,35 @@ int BzipOpen(bool bootApp)
 			}
 		}
 
+		// Start inflating the roms in the background, in the order drivers usually load them
+		struct ZipPrefetch* pPrefetch = (struct ZipPrefetch*)malloc(nRomCount * sizeof(struct ZipPrefetch));
+		if (pPrefetch)
+		{
+			char szZipName[BZIP_MAX][MAX_PATH];
+			for (int z = 0; z < BZIP_MAX; z++)
+			{
+				szZipName[z][0] = 0;
+				if (szBzipName[z])
+				{
+					TCHARToANSI(szBzipName[z], szZipName[z], MAX_PATH);
+				}
+			}
+
+			for (int i = 0; i < nRomCount; i++)
+			{
+				struct BurnRomInfo ri;
+				memset(&ri, 0, sizeof(ri));
+				BurnDrvGetRomInfo(&ri, i);
+
+				pPrefetch[i].szZip  = (RomFind[i].nState && szZipName[RomFind[i].nZip][0]) ? szZipName[RomFind[i].nZip] : NULL;
+				pPrefetch[i].nEntry = RomFind[i].nPos;
+				pPrefetch[i].nLen   = ri.nLen;
+			}
+
+			ZipPrefetchStart(pPrefetch, nRomCount);
+			free(pPrefetch);
+		}
+
 		BurnExtLoadRom = BzipBurnLoadRom;                                                                         // Okay to call our function to load each rom
 	}
 	else
@@ -784,6 +820,7 @@ int BzipOpen(bool bootApp)
 
 int BzipClose()
 {
+	ZipPrefetchStop();
 	ZipClose();
 	nCurrentZip = -1;                                                                                                    // Close the last zip file if open
 
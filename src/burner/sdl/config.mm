@@ -124,6 +124,11 @@ int ConfigAppLoad()
 		VAR(nInterpolation);
 		VAR(nFMInterpolation);
 		VAR(EnableHiscores);
+		VAR(bBurnShareRegions);
+		VAR(bBurnAsyncDevices);
+		VAR(bSekBlockCache);
+		VAR(bRunAhead);
+		VAR(nRunAheadFrames);
 		// Other
 		STR(szAppRomPaths[0]);
 		STR(szAppRomPaths[1]);
@@ -170,6 +175,7 @@ int ConfigAppLoad()
 		STR(szAppListsPath);
 		STR(szAppDatListsPath);
 		STR(szAppArchivesPath);
+		STR(szBurnRomCachePath);
 
 #undef STR
 #undef FLT
@@ -238,6 +244,16 @@ int ConfigAppSave()
 	VAR(nFMInterpolation);
 	_ftprintf(f, _T("\n// If non-zero, enable high score saving support.\n"));
 	VAR(EnableHiscores);
+	_ftprintf(f, _T("\n// If non-zero, share rom regions with other instances running the same game\n"));
+	VAR(bBurnShareRegions);
+	_ftprintf(f, _T("\n// If non-zero, render the sound chips that support it on a helper thread, one frame behind\n"));
+	VAR(bBurnAsyncDevices);
+	_ftprintf(f, _T("\n// If non-zero, replay recorded runs of 68000 code from rom instead of decoding each opcode\n"));
+	VAR(bSekBlockCache);
+	_ftprintf(f, _T("\n// If non-zero, enable run-ahead mode for the reduction of input lag\n"));
+	VAR(bRunAhead);
+	_ftprintf(f, _T("\n// Number of frames to run ahead (1 - 4)\n"));
+	VAR(nRunAheadFrames);
 
 	fprintf(f, "\n// The paths to search for rom zips. (include trailing slash)\n");
 	STR(szAppRomPaths[0]);
@@ -310,6 +326,8 @@ int ConfigAppSave()
 	STR(szAppDatListsPath);
 	fprintf(f, "\n// UNUSED CURRENTLY (include trailing slash)\n");
 	STR(szAppArchivesPath);
+	fprintf(f, "\n// Decrypted ROM cache path, leave empty to disable (include trailing slash)\n");
+	STR(szBurnRomCachePath);
 	fprintf(f, "\n\n\n");
 
 #undef STR
@@ -36,6 +36,10 @@ char videofiltering[3];
 bool gamefound = 0;
 const char* romname = NULL;
 
+// -rollback <player> <local port> <remote host> <remote port> [input delay]
+static int nRollbackPlayer = 0, nRollbackLocalPort = 0, nRollbackRemotePort = 0, nRollbackDelay = 1;
+static const char* szRollbackHost = NULL;
+
 extern void InitSupportPaths();
 
 #ifdef BUILD_SDL2
@@ -116,6 +120,17 @@ int parseSwitches(int argc, char* argv[])
 			i++;
 			_tcscpy(CDEmuImage, argv[i]);
 		}
+		else if (strcmp(argv[i], "-rollback") == 0)
+		{
+			if (i + 4 >= argc) return 1;
+			nRollbackPlayer = atoi(argv[++i]) - 1;
+			nRollbackLocalPort = atoi(argv[++i]);
+			szRollbackHost = argv[++i];
+			nRollbackRemotePort = atoi(argv[++i]);
+			if (i + 1 < argc && argv[i + 1][0] >= '0' && argv[i + 1][0] <= '9') {
+				nRollbackDelay = atoi(argv[++i]);
+			}
+		}
 	}
 	return 0;
 }
@@ -242,7 +257,20 @@ void DoGame(int gameToRun)
 	{
 		MediaInit();
 		display_set_controls();
+
+		if (szRollbackHost) {
+			RollbackTransport* pt = RollbackUdpOpen(nRollbackLocalPort, szRollbackHost, nRollbackRemotePort);
+			if (pt == NULL || RollbackInit(nRollbackPlayer, nRollbackDelay, 8, pt)) {
+				printf("Couldn't start the rollback session.\n");
+			}
+		}
+
 		RunMessageLoop();
+
+		if (bRollbackSession) {
+			RollbackExit();
+		}
+		RollbackUdpClose();
 	}
 	else
 	{
@@ -316,7 +344,7 @@ int main(int argc, char* argv[])
 
 	if (!switchesOK || ((romname == NULL) && !usemenu && !bAlwaysMenu && !dat))
 	{
-		printf("Usage: %s [-cd] [-joy] [-menu] [-novsync] [-integerscale] [-windowscale <num>] [-fullscreen] [-dat] [-autosave] [-nearest] [-linear] [-best] <romname>\n", argv[0]);
+		printf("Usage: %s [-cd] [-joy] [-menu] [-novsync] [-integerscale] [-windowscale <num>] [-fullscreen] [-dat] [-autosave] [-nearest] [-linear] [-best] [-rollback <player> <local port> <remote host> <remote port> [delay]] <romname>\n", argv[0]);
 		printf("Note the -menu switch does not require a romname\n");
 		printf("e.g.: %s mslug\n", argv[0]);
 		printf("e.g.: %s -windowscale 1 asteroid\n", argv[0]);
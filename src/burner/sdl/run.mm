@@ -154,13 +154,19 @@ static int RunFrame(int bDraw, int bPause)
 		nFramesEmulated++;
 		nCurrentFrame++;
 		InputMake(true);
+
+		if (bRollbackSession && RollbackFrame()) {	// waiting for the other side, this frame didn't happen
+			nFramesEmulated--;
+			nCurrentFrame--;
+			return 0;
+		}
 	}
 
 	if (bDraw)
 	{
 		nFramesRendered++;
 
-		if (!bRunAhead || (BurnDrvGetFlags() & BDF_RUNAHEAD_DISABLED) || bAppDoFast) {     // Run-Ahead feature 				-dink aug 02, 2021
+		if (!bRunAhead || (BurnDrvGetFlags() & BDF_RUNAHEAD_DISABLED) || bAppDoFast || bRollbackSession) {     // Run-Ahead feature 				-dink aug 02, 2021
 			if (VidFrame()) {				// Do one frame w/o RunAhead or if FFWD is pressed.
 				// VidFrame() failed, but we must run a driver frame because we have
             	// a clocked input.  Possibly from recording or netplay(!)
@@ -176,9 +182,16 @@ static int RunFrame(int bDraw, int bPause)
 				StateRunAheadSave();
 				INT16 *pBurnSoundOut_temp = pBurnSoundOut;
 				pBurnSoundOut = NULL;
-				nCurrentFrame++;
 				bBurnRunAheadFrame = 1;
 
+				INT32 nFrames = StateRunAheadFrames();
+				for (INT32 i = 1; i < nFrames; i++) {	// hidden frames: no video, no audio
+					pBurnDraw = (BurnDrvGetFlags() & BDF_RUNAHEAD_DRAWSYNC) ? pVidImage : NULL;
+					nCurrentFrame++;
+					BurnDrvFrame();
+				}
+				nCurrentFrame++;
+
 				if (VidFrame()) {
 					// VidFrame() failed, but we must run a driver frame because we have
 					// an input.  Possibly from recording or netplay(!)
@@ -187,7 +200,7 @@ static int RunFrame(int bDraw, int bPause)
 				}
 
 				bBurnRunAheadFrame = 0;
-				nCurrentFrame--;
+				nCurrentFrame -= nFrames;
 				StateRunAheadLoad();
 				pBurnSoundOut = pBurnSoundOut_temp; // restore pointer, for wav & avi writer
 		}
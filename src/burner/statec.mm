@@ -3,6 +3,7 @@
 
 // BurnStateCompress: Save a state, "Compress" == organized into a buffer
 // BurnStateDecompress: Load a state from buffer
+// BurnStateDelta*: Incremental in-memory states against a reference image (see below)
 
 #define DEBUG_STATEC 0
 #define stateclog(x) do { if (DEBUG_STATEC) bprintf x; } while (0)
@@ -140,7 +141,7 @@ static INT32 __cdecl LoadAcb(struct BurnArea* pba)
 }
 
 // Save a state, "Compress" == organized into a buffer
-INT32 BurnStateCompress(UINT8** pDef, INT32* pnDefLen, INT32 bAll)
+extern "C" INT32 BurnStateCompress(UINT8** pDef, INT32* pnDefLen, INT32 bAll)
 {
 	UINT32 nAddEEPROM = (bWithEEPROM) ? ACB_EEPROM : 0;
 
@@ -174,7 +175,7 @@ INT32 BurnStateCompress(UINT8** pDef, INT32* pnDefLen, INT32 bAll)
 }
 
 // Load a state from buffer
-INT32 BurnStateDecompress(UINT8* Def, INT32 nDefLen, INT32 bAll)
+extern "C" INT32 BurnStateDecompress(UINT8* Def, INT32 nDefLen, INT32 bAll)
 {
 	UINT32 nAddEEPROM = (bWithEEPROM) ? ACB_EEPROM : 0;
 
@@ -209,3 +210,291 @@ INT32 BurnStateDecompress(UINT8* Def, INT32 nDefLen, INT32 bAll)
 
 	return 0;
 }
+
+// ---------------------------------------------------------------------------
+// Delta states: in-memory incremental snapshots for per-frame use (rollback, episode resets)
+//
+// BurnStateDeltaInit: capture a reference image of all volatile areas
+// BurnStateDeltaSave: store only the pages that changed since the reference image
+// BurnStateDeltaLoad: restore a frame by replaying the reference image + stored pages
+//
+// Delta buffer layout:
+//   header: BLOCK_ID_DELTA, reference id, number of runs
+//   runs:   area index, offset into area, run length, data
+// Runs are emitted in BurnAreaScan order, adjacent changed pages are merged into one run.
+
+static const UINT32 BLOCK_ID_DELTA = 0xa55a0002;
+static const UINT32 DELTA_SIZE_HEADER = sizeof(UINT32) * 3; // block id, reference id, run count
+static const UINT32 DELTA_SIZE_1_RUN = sizeof(UINT32) * 3;  // area index, offset, length
+
+struct DeltaArea { UINT32 nLen; UINT32 nRefPos; };
+
+static DeltaArea* DeltaAreas = NULL;
+static INT32 nDeltaAreas = 0;
+static INT32 nDeltaAreaPos = 0; // area index during a scan
+static UINT8* DeltaRef = NULL;  // reference image, all areas back-to-back
+static INT32 nDeltaRefLen = 0;
+static INT32 nDeltaMaxLen = 0;  // worst case delta buffer size (every page changed)
+static UINT32 nDeltaPageSize = 0;
+static UINT32 nDeltaRefId = 0;
+static UINT32 nDeltaRuns = 0;
+static bool bDeltaError = false;
+
+static INT32 __cdecl DeltaLenAcb(struct BurnArea* pba)
+{
+	UINT32 nPages = (pba->nLen + nDeltaPageSize - 1) / nDeltaPageSize;
+
+	nDeltaRefLen += pba->nLen;
+	nDeltaMaxLen += pba->nLen + nPages * DELTA_SIZE_1_RUN;
+	nDeltaAreas++;
+	return 0;
+}
+
+static INT32 __cdecl DeltaRefAcb(struct BurnArea* pba)
+{
+	if (nDeltaAreaPos >= nDeltaAreas || pba->nLen + nBufferPosition > (UINT32)nDeltaRefLen) {
+		bDeltaError = true;
+		return 1;
+	}
+
+	DeltaAreas[nDeltaAreaPos].nLen = pba->nLen;
+	DeltaAreas[nDeltaAreaPos].nRefPos = nBufferPosition;
+	nDeltaAreaPos++;
+
+	AddToBuffer(pba->Data, pba->nLen);
+
+	return 0;
+}
+
+static INT32 __cdecl DeltaSaveAcb(struct BurnArea* pba)
+{
+	if (bDeltaError) return 1;
+
+	if (nDeltaAreaPos >= nDeltaAreas || DeltaAreas[nDeltaAreaPos].nLen != pba->nLen) {
+		stateclog((0, _T("DeltaSaveAcb(): area layout changed at \"%S\", rebase needed\n"), pba->szName));
+		bDeltaError = true;
+		return 1;
+	}
+
+	UINT8* pData = (UINT8*)pba->Data;
+	UINT8* pRef = DeltaRef + DeltaAreas[nDeltaAreaPos].nRefPos;
+	UINT32 nRunStart = 0;
+	UINT32 nRunLen = 0;
+
+	for (UINT32 nOffset = 0; nOffset < pba->nLen; nOffset += nDeltaPageSize) {
+		UINT32 nLen = pba->nLen - nOffset;
+		if (nLen > nDeltaPageSize) nLen = nDeltaPageSize;
+
+		if (memcmp(pData + nOffset, pRef + nOffset, nLen) != 0) {
+			if (nRunLen == 0) nRunStart = nOffset;
+			nRunLen += nLen;
+			continue;
+		}
+
+		if (nRunLen) {
+			UINT32 nArea = nDeltaAreaPos;
+			AddToBuffer(&nArea, sizeof(UINT32));
+			AddToBuffer(&nRunStart, sizeof(UINT32));
+			AddToBuffer(&nRunLen, sizeof(UINT32));
+			AddToBuffer(pData + nRunStart, nRunLen);
+			nDeltaRuns++;
+			nRunLen = 0;
+		}
+	}
+
+	if (nRunLen) {
+		UINT32 nArea = nDeltaAreaPos;
+		AddToBuffer(&nArea, sizeof(UINT32));
+		AddToBuffer(&nRunStart, sizeof(UINT32));
+		AddToBuffer(&nRunLen, sizeof(UINT32));
+		AddToBuffer(pData + nRunStart, nRunLen);
+		nDeltaRuns++;
+	}
+
+	nDeltaAreaPos++;
+
+	return 0;
+}
+
+static INT32 __cdecl DeltaLoadAcb(struct BurnArea* pba)
+{
+	if (bDeltaError) return 1;
+
+	if (nDeltaAreaPos >= nDeltaAreas || DeltaAreas[nDeltaAreaPos].nLen != pba->nLen) {
+		stateclog((0, _T("DeltaLoadAcb(): area layout changed at \"%S\", can't restore\n"), pba->szName));
+		bDeltaError = true;
+		return 1;
+	}
+
+	UINT8* pData = (UINT8*)pba->Data;
+
+	memcpy(pData, DeltaRef + DeltaAreas[nDeltaAreaPos].nRefPos, pba->nLen);
+
+	// apply the runs belonging to this area
+	while (nDeltaRuns && nBufferPosition + DELTA_SIZE_1_RUN <= nStateLoadFileLength) {
+		UINT32 nArea, nOffset, nLen;
+		memcpy(&nArea, pBuffer, sizeof(UINT32));
+		if (nArea != (UINT32)nDeltaAreaPos) break;
+
+		GetFromBuffer(NULL, sizeof(UINT32));
+		GetFromBuffer(&nOffset, sizeof(UINT32));
+		GetFromBuffer(&nLen, sizeof(UINT32));
+
+		if (nOffset + nLen > pba->nLen || nBufferPosition + nLen > nStateLoadFileLength) {
+			stateclog((0, _T("DeltaLoadAcb(): corrupt run in \"%S\"\n"), pba->szName));
+			bDeltaError = true;
+			return 1;
+		}
+
+		GetFromBuffer(pData + nOffset, nLen);
+		nDeltaRuns--;
+	}
+
+	nDeltaAreaPos++;
+
+	return 0;
+}
+
+extern "C" void BurnStateDeltaExit()
+{
+	if (DeltaAreas) {
+		free(DeltaAreas);
+		DeltaAreas = NULL;
+	}
+	if (DeltaRef) {
+		free(DeltaRef);
+		DeltaRef = NULL;
+	}
+
+	nDeltaAreas = 0;
+	nDeltaRefLen = 0;
+	nDeltaMaxLen = 0;
+}
+
+// Capture the reference image, nPageSize must be a power of 2 (0 = default, 256 bytes)
+extern "C" INT32 BurnStateDeltaInit(INT32 nPageSize)
+{
+	BurnStateDeltaExit();
+
+	if (nPageSize <= 0) nPageSize = 0x100;
+	if (nPageSize & (nPageSize - 1)) return 1;
+
+	nDeltaPageSize = nPageSize;
+	nDeltaMaxLen = DELTA_SIZE_HEADER;
+	BurnAcb = DeltaLenAcb;
+	BurnAreaScan(ACB_FULLSCAN | ACB_READ, NULL);
+
+	DeltaAreas = (DeltaArea*)malloc((nDeltaAreas ? nDeltaAreas : 1) * sizeof(DeltaArea));
+	DeltaRef = (UINT8*)malloc(nDeltaRefLen ? nDeltaRefLen : 1);
+	if (DeltaAreas == NULL || DeltaRef == NULL) {
+		BurnStateDeltaExit();
+		return 1;
+	}
+
+	bDeltaError = false;
+	nDeltaAreaPos = 0;
+	nBufferPosition = 0;
+	pBuffer = DeltaRef;
+	BurnAcb = DeltaRefAcb;
+	BurnAreaScan(ACB_FULLSCAN | ACB_READ, NULL);
+
+	if (bDeltaError || nDeltaAreaPos != nDeltaAreas) {
+		stateclog((0, _T("BurnStateDeltaInit(): area scan mismatch\n")));
+		BurnStateDeltaExit();
+		return 1;
+	}
+
+	nDeltaRefId++;
+
+	stateclog((0, _T("BurnStateDeltaInit(): areas  %x  reference  %x  max delta  %x\n"), nDeltaAreas, nDeltaRefLen, nDeltaMaxLen));
+
+	return 0;
+}
+
+// Re-capture the reference image from the current state (keeps the page size)
+extern "C" INT32 BurnStateDeltaRebase()
+{
+	return BurnStateDeltaInit(nDeltaPageSize);
+}
+
+// Size of a buffer large enough to hold any delta against the current reference
+extern "C" INT32 BurnStateDeltaGetMaxLen()
+{
+	return nDeltaMaxLen;
+}
+
+// Save the pages that differ from the reference image into caller-supplied pDef
+extern "C" INT32 BurnStateDeltaSave(UINT8* pDef, INT32 nDefMaxLen, INT32* pnDefLen)
+{
+	if (DeltaRef == NULL || pDef == NULL || nDefMaxLen < nDeltaMaxLen) return 1;
+
+	bDeltaError = false;
+	nDeltaAreaPos = 0;
+	nDeltaRuns = 0;
+	nBufferPosition = 0;
+	pBuffer = pDef;
+
+	UINT32 nRuns = 0;
+	AddToBuffer((void*)&BLOCK_ID_DELTA, sizeof(UINT32));
+	AddToBuffer(&nDeltaRefId, sizeof(UINT32));
+	AddToBuffer(&nRuns, sizeof(UINT32)); // filled in below
+
+	BurnAcb = DeltaSaveAcb;
+	BurnAreaScan(ACB_FULLSCAN | ACB_READ, NULL);
+
+	if (bDeltaError || nDeltaAreaPos != nDeltaAreas) {
+		stateclog((0, _T("BurnStateDeltaSave(): area layout changed, rebase needed\n")));
+		return 1;
+	}
+
+	memcpy(pDef + sizeof(UINT32) * 2, &nDeltaRuns, sizeof(UINT32));
+
+	if (pnDefLen) *pnDefLen = nBufferPosition;
+
+	return 0;
+}
+
+// Restore the reference image with the pages from Def applied on top
+extern "C" INT32 BurnStateDeltaLoad(UINT8* Def, INT32 nDefLen)
+{
+	if (DeltaRef == NULL || Def == NULL || nDefLen < (INT32)DELTA_SIZE_HEADER) return 1;
+
+	nStateLoadFileLength = nDefLen;
+	nBufferPosition = 0;
+	pBuffer = Def;
+
+	UINT32 test_header, ref_id;
+	GetFromBuffer(&test_header, sizeof(UINT32));
+	GetFromBuffer(&ref_id, sizeof(UINT32));
+	GetFromBuffer(&nDeltaRuns, sizeof(UINT32));
+
+	if (test_header != BLOCK_ID_DELTA || ref_id != nDeltaRefId) {
+		stateclog((0, _T("BurnStateDeltaLoad(): delta doesn't belong to the current reference!\n")));
+		return 1;
+	}
+
+	bDeltaError = false;
+	nDeltaAreaPos = 0;
+	BurnAcb = DeltaLoadAcb;
+	BurnAreaScan(ACB_FULLSCAN | ACB_WRITE, NULL);
+
+	if (bDeltaError || nDeltaRuns != 0) {
+		stateclog((0, _T("BurnStateDeltaLoad(): %x runs left over, state may be inconsistent\n"), nDeltaRuns));
+		return 1;
+	}
+
+	return 0;
+}
+
+// Checksum of the state held in a delta, for comparing states between machines:
+// covers the runs only, the reference id is local to this instance
+extern "C" UINT32 BurnStateDeltaChecksum(UINT8* Def, INT32 nDefLen)
+{
+	UINT32 hash = 0x811c9dc5;
+
+	for (INT32 i = DELTA_SIZE_HEADER; i < nDefLen; i++) {
+		hash = (hash ^ Def[i]) * 0x01000193;
+	}
+
+	return hash;
+}
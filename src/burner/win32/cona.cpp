@@ -254,6 +254,7 @@ int ConfigAppLoad()
 		VAR(bForce60Hz);
 		VAR(bAlwaysDrawFrames);
 		VAR(bRunAhead);
+		VAR(nRunAheadFrames);
 
 		VAR(nVidSelect);
 		VAR(nVidBlitterOpt[0]);
@@ -621,6 +622,8 @@ int ConfigAppSave()
 	VAR(bAlwaysDrawFrames);
 	_ftprintf(h, _T("\n// If non-zero, enable run-ahead mode for the reduction of input lag\n"));
 	VAR(bRunAhead);
+	_ftprintf(h, _T("\n// Number of frames to run ahead (1 - 4)\n"));
+	VAR(nRunAheadFrames);
 
 	_ftprintf(h, _T("\n"));
 	_ftprintf(h, _T("// --- DirectDraw blitter module settings -------------------------------------\n"));
@@ -313,9 +313,16 @@ int RunFrame(int bDraw, int bPause)
 				StateRunAheadSave();
 				INT16 *pBurnSoundOut_temp = pBurnSoundOut;
 				pBurnSoundOut = NULL;
-				nCurrentFrame++;
 				bBurnRunAheadFrame = 1;
 
+				INT32 nFrames = StateRunAheadFrames();
+				for (INT32 i = 1; i < nFrames; i++) {	// hidden frames: no video, no audio
+					pBurnDraw = (BurnDrvGetFlags() & BDF_RUNAHEAD_DRAWSYNC) ? pVidImage : NULL;
+					nCurrentFrame++;
+					BurnDrvFrame();
+				}
+				nCurrentFrame++;
+
 				if (VidFrame()) {
 					// VidFrame() failed, but we must run a driver frame because we have
 					// an input.  Possibly from recording or netplay(!)
@@ -324,7 +331,7 @@ int RunFrame(int bDraw, int bPause)
 				}
 
 				bBurnRunAheadFrame = 0;
-				nCurrentFrame--;
+				nCurrentFrame -= nFrames;
 				StateRunAheadLoad();
 				pBurnSoundOut = pBurnSoundOut_temp; // restore pointer, for wav & avi writer
 			}
@@ -267,6 +267,253 @@ INT32 ZipLoadFile(UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry)
 	return 0;
 }
 
+// ----------------------------------------------------------------------------
+// Prefetch: inflate the roms of a set on worker threads while the driver is
+// still asking for earlier ones.  Each worker has its own unzip handle, the
+// crc is checked by unzCloseCurrentFile() on the worker as usual.
+// Only .zip archives are prefetched, anything else is loaded as before.
+
+#if !defined(BUILD_WIN32) && !defined(SDL_WINDOWS)
+#include <pthread.h>
+#include <unistd.h>
+#define ZIP_PREFETCH
+#endif
+
+#ifdef ZIP_PREFETCH
+
+#define ZIP_PREFETCH_THREADS	8
+#define ZIP_PREFETCH_BUDGET		(128 << 20)		// bytes inflated but not yet handed over
+
+#define PREFETCH_QUEUED			0
+#define PREFETCH_RUNNING		1
+#define PREFETCH_DONE			2
+#define PREFETCH_TAKEN			3
+
+struct ZipPrefetchJob {
+	char szZip[MAX_PATH];
+	INT32 nEntry;
+	INT32 nLen;
+	INT32 nState;
+	INT32 nRet;
+	INT32 nWrote;
+	UINT8* pData;
+};
+
+static struct ZipPrefetchJob* PrefetchJob = NULL;
+static INT32 nPrefetchCount = 0;
+static INT32 nPrefetchNext = 0;
+static INT32 nPrefetchBytes = 0;
+static bool bPrefetchStop = false;
+
+static pthread_mutex_t PrefetchMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t PrefetchCond = PTHREAD_COND_INITIALIZER;
+static pthread_t PrefetchThread[ZIP_PREFETCH_THREADS];
+static INT32 nPrefetchThreads = 0;
+
+// Inflate one job with the worker's own handle, reopened when the archive changes
+static void ZipPrefetchInflate(struct ZipPrefetchJob* pJob, unzFile* pZip, char* szOpen)
+{
+	pJob->nRet = 1;
+	pJob->nWrote = 0;
+
+	if (*pZip == NULL || strcmp(szOpen, pJob->szZip)) {
+		if (*pZip) unzClose(*pZip);
+		strcpy(szOpen, pJob->szZip);
+		*pZip = unzOpen(szOpen);
+		if (*pZip == NULL) return;
+	}
+
+	if (unzGoToFirstFile(*pZip) != UNZ_OK) return;
+	for (INT32 i = 0; i < pJob->nEntry; i++) {
+		if (unzGoToNextFile(*pZip) != UNZ_OK) return;
+	}
+
+	pJob->pData = (UINT8*)malloc(pJob->nLen);
+	if (pJob->pData == NULL) return;
+
+	if (unzOpenCurrentFile(*pZip) != UNZ_OK) return;
+
+	INT32 nRet = unzReadCurrentFile(*pZip, pJob->pData, pJob->nLen);
+	if (nRet >= 0) pJob->nWrote = nRet;
+
+	nRet = unzCloseCurrentFile(*pZip);
+	pJob->nRet = (nRet == UNZ_CRCERROR) ? 2 : (nRet != UNZ_OK) ? 1 : 0;
+}
+
+static void* ZipPrefetchProc(void*)
+{
+	unzFile Zip = NULL;
+	char szOpen[MAX_PATH] = "";
+
+	pthread_mutex_lock(&PrefetchMutex);
+
+	while (!bPrefetchStop) {
+		// Skip anything the loader has already fetched itself
+		while (nPrefetchNext < nPrefetchCount && PrefetchJob[nPrefetchNext].nState != PREFETCH_QUEUED) {
+			nPrefetchNext++;
+		}
+		if (nPrefetchNext >= nPrefetchCount) break;
+
+		struct ZipPrefetchJob* pJob = &PrefetchJob[nPrefetchNext];
+
+		// Wait for the loader to catch up, a single big rom always gets through
+		if (nPrefetchBytes > 0 && nPrefetchBytes + pJob->nLen > ZIP_PREFETCH_BUDGET) {
+			pthread_cond_wait(&PrefetchCond, &PrefetchMutex);
+			continue;
+		}
+
+		pJob->nState = PREFETCH_RUNNING;
+		nPrefetchBytes += pJob->nLen;
+		nPrefetchNext++;
+
+		pthread_mutex_unlock(&PrefetchMutex);
+		ZipPrefetchInflate(pJob, &Zip, szOpen);
+		pthread_mutex_lock(&PrefetchMutex);
+
+		pJob->nState = PREFETCH_DONE;
+		pthread_cond_broadcast(&PrefetchCond);
+	}
+
+	pthread_mutex_unlock(&PrefetchMutex);
+
+	if (Zip) unzClose(Zip);
+
+	return NULL;
+}
+
+INT32 ZipPrefetchStart(struct ZipPrefetch* pList, INT32 nCount)
+{
+	ZipPrefetchStop();
+
+	if (pList == NULL || nCount <= 0) return 1;
+
+	PrefetchJob = (struct ZipPrefetchJob*)malloc(nCount * sizeof(struct ZipPrefetchJob));
+	if (PrefetchJob == NULL) return 1;
+	memset(PrefetchJob, 0, nCount * sizeof(struct ZipPrefetchJob));
+
+	for (INT32 i = 0; i < nCount; i++) {
+		struct ZipPrefetchJob* pJob = &PrefetchJob[i];
+
+		pJob->nEntry = pList[i].nEntry;
+		pJob->nLen = pList[i].nLen;
+
+		// Roms we can't prefetch are simply never queued
+		if (pList[i].szZip == NULL || pList[i].nLen <= 0) {
+			pJob->nState = PREFETCH_TAKEN;
+			continue;
+		}
+
+		snprintf(pJob->szZip, MAX_PATH, "%s.zip", pList[i].szZip);
+
+		FILE* fp = fopen(pJob->szZip, "rb");
+		if (fp == NULL) {
+			pJob->nState = PREFETCH_TAKEN;
+			continue;
+		}
+		fclose(fp);
+	}
+
+	nPrefetchCount = nCount;
+	nPrefetchNext = 0;
+	nPrefetchBytes = 0;
+	bPrefetchStop = false;
+
+	INT32 nThreads = sysconf(_SC_NPROCESSORS_ONLN);
+	if (nThreads > ZIP_PREFETCH_THREADS) nThreads = ZIP_PREFETCH_THREADS;
+
+	for (nPrefetchThreads = 0; nPrefetchThreads < nThreads; nPrefetchThreads++) {
+		if (pthread_create(&PrefetchThread[nPrefetchThreads], NULL, ZipPrefetchProc, NULL)) break;
+	}
+
+	return 0;
+}
+
+INT32 ZipPrefetchLoad(INT32 nItem, UINT8* Dest, INT32 nLen, INT32* pnWrote)
+{
+	if (PrefetchJob == NULL || nItem < 0 || nItem >= nPrefetchCount) return -1;
+
+	struct ZipPrefetchJob* pJob = &PrefetchJob[nItem];
+
+	pthread_mutex_lock(&PrefetchMutex);
+
+	// Not started yet, so load it the normal way rather than wait for it
+	if (pJob->nState == PREFETCH_QUEUED || pJob->nState == PREFETCH_TAKEN) {
+		if (pJob->nState == PREFETCH_QUEUED) pJob->nState = PREFETCH_TAKEN;
+		pthread_mutex_unlock(&PrefetchMutex);
+		return -1;
+	}
+
+	while (pJob->nState == PREFETCH_RUNNING) {
+		pthread_cond_wait(&PrefetchCond, &PrefetchMutex);
+	}
+
+	UINT8* pData = pJob->pData;
+	INT32 nRet = pJob->nRet;
+	INT32 nWrote = pJob->nWrote;
+
+	pJob->pData = NULL;
+	pJob->nState = PREFETCH_TAKEN;
+	nPrefetchBytes -= pJob->nLen;
+	pthread_cond_broadcast(&PrefetchCond);
+
+	pthread_mutex_unlock(&PrefetchMutex);
+
+	// Let the normal path retry (and report) anything that failed on the worker,
+	// or that wants more than was prefetched; the job's budget is given back already
+	if (nRet == 1 || nLen > pJob->nLen) {
+		free(pData);
+		return -1;
+	}
+
+	if (nWrote > nLen) nWrote = nLen;
+	memcpy(Dest, pData, nWrote);
+	if (pnWrote != NULL) *pnWrote = nWrote;
+
+	free(pData);
+
+	return nRet;
+}
+
+void ZipPrefetchStop()
+{
+	pthread_mutex_lock(&PrefetchMutex);
+	bPrefetchStop = true;
+	pthread_cond_broadcast(&PrefetchCond);
+	pthread_mutex_unlock(&PrefetchMutex);
+
+	for (INT32 i = 0; i < nPrefetchThreads; i++) {
+		pthread_join(PrefetchThread[i], NULL);
+	}
+	nPrefetchThreads = 0;
+
+	if (PrefetchJob) {
+		for (INT32 i = 0; i < nPrefetchCount; i++) {
+			free(PrefetchJob[i].pData);
+		}
+		free(PrefetchJob);
+		PrefetchJob = NULL;
+	}
+	nPrefetchCount = 0;
+}
+
+#else
+
+INT32 ZipPrefetchStart(struct ZipPrefetch*, INT32)
+{
+	return 1;
+}
+
+INT32 ZipPrefetchLoad(INT32, UINT8*, INT32, INT32*)
+{
+	return -1;
+}
+
+void ZipPrefetchStop()
+{
+}
+
+#endif
+
 // Load one file directly, added by regret
 INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, INT32* pnWrote)
 {
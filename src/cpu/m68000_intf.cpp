@@ -246,6 +246,9 @@ DEFLONGHANDLERS(0)
 // Mapped Memory lookup (+ SEK_WADD * 2 for fetch)
 #define FIND_F(x) pSekExt->MemMap[(x >> SEK_SHIFT) + SEK_WADD * 2]
 
+// Flag the page holding x in the dirty map (direct memory writes only)
+#define MARK_W(x) do { if (pSekExt->DirtyTrack) pSekExt->DirtyMap[((x) >> (SEK_SHIFT + 5)) & (SEK_PAGE_COUNT / 32 - 1)] |= 1U << (((x) >> SEK_SHIFT) & 31); } while (0)
+
 // Normal memory access functions
 inline static UINT8 ReadByte(UINT32 a)
 {
@@ -293,6 +296,7 @@ inline static void WriteByte(UINT32 a, UINT8 d)
 
 	pr = FIND_W(a);
 	if ((uintptr_t)pr >= SEK_MAXHANDLER) {
+		MARK_W(a);
 		a ^= 1;
 		pr[a & SEK_PAGEM] = (UINT8)d;
 		return;
@@ -312,6 +316,7 @@ inline static void WriteByteROM(UINT32 a, UINT8 d)
 	// (on non-encrypted games, Fetch is mapped to Read)
 	pr = FIND_F(a);
 	if ((uintptr_t)pr >= SEK_MAXHANDLER) {
+		MARK_W(a);
 		a ^= 1;
 		pr[a & SEK_PAGEM] = (UINT8)d;
 		return;
@@ -392,6 +397,7 @@ inline static void WriteWord(UINT32 a, UINT16 d)
 		}
 		else
 		{
+			MARK_W(a);
 			*((UINT16*)(pr + (a & SEK_PAGEM))) = (UINT16)BURN_ENDIAN_SWAP_INT16(d);
 			return;
 		}
@@ -410,6 +416,7 @@ inline static void WriteWordROM(UINT32 a, UINT16 d)
 	#endif
 	pr = FIND_R(a);
 	if ((uintptr_t)pr >= SEK_MAXHANDLER) {
+		MARK_W(a);
 		*((UINT16*)(pr + (a & SEK_PAGEM))) = (UINT16)d;
 		return;
 	}
@@ -517,6 +524,8 @@ inline static void WriteLong(UINT32 a, UINT32 d)
 		else
 		{
 			d = (d >> 16) | (d << 16);
+			MARK_W(a);
+			MARK_W(a + 3);
 			*((UINT32*)(pr + (a & SEK_PAGEM))) = BURN_ENDIAN_SWAP_INT32(d);
 
 			return;
@@ -536,6 +545,8 @@ inline static void WriteLongROM(UINT32 a, UINT32 d)
 	pr = FIND_R(a);
 	if ((uintptr_t)pr >= SEK_MAXHANDLER) {
 		d = (d >> 16) | (d << 16);
+		MARK_W(a);
+		MARK_W(a + 3);
 		*((UINT32*)(pr + (a & SEK_PAGEM))) = d;
 		return;
 	}
@@ -573,6 +584,7 @@ void __fastcall WriteByteBP(UINT32 a, UINT8 d)
 	CheckBreakpoint_W(a, ~0);
 
 	if ((uintptr_t)pr >= SEK_MAXHANDLER) {
+		MARK_W(a);
 		a ^= 1;
 		pr[a & SEK_PAGEM] = (UINT8)d;
 		return;
@@ -607,6 +619,7 @@ void __fastcall WriteWordBP(UINT32 a, UINT16 d)
 	CheckBreakpoint_W(a, ~1);
 
 	if ((uintptr_t)pr >= SEK_MAXHANDLER) {
+		MARK_W(a);
 		*((UINT16*)(pr + (a & SEK_PAGEM))) = (UINT16)d;
 		return;
 	}
@@ -643,6 +656,8 @@ void __fastcall WriteLongBP(UINT32 a, UINT32 d)
 
 	if ((uintptr_t)pr >= SEK_MAXHANDLER) {
 		d = (d >> 16) | (d << 16);
+		MARK_W(a);
+		MARK_W(a + 3);
 		*((UINT32*)(pr + (a & SEK_PAGEM))) = d;
 		return;
 	}
@@ -796,6 +811,82 @@ struct A68KInter a68k_inter_breakpoint = {
 
 #endif
 
+// ----------------------------------------------------------------------------
+// Block cache (see m68k_block in m68k/m68k.h)
+
+INT32 bSekBlockCache = 0;
+
+#ifdef EMU_M68K
+#define SEK_BLOCK_COUNT	(1024)						// one slot per opcode address, 2 pages before they wrap
+
+// Forget the blocks recorded from nStart - nEnd on the active CPU
+static void SekBlockCacheInvalidate(UINT32 nStart, UINT32 nEnd)
+{
+	m68k_block* pBlock = pSekExt->BlockCache;
+
+	if (pBlock == NULL) {
+		return;
+	}
+
+	UINT32 nFirst = (nStart & ~SEK_PAGEM) >> 1;
+	UINT32 nCount = SEK_BLOCK_COUNT;
+
+	if (nEnd - nStart < SEK_BLOCK_COUNT * 2) {
+		nCount = ((nEnd | SEK_PAGEM) - (nStart & ~SEK_PAGEM) + 1) >> 1;
+		if (nCount > SEK_BLOCK_COUNT) nCount = SEK_BLOCK_COUNT;
+	}
+
+	for (UINT32 i = 0; i < nCount; i++) {
+		m68k_block* b = pBlock + ((nFirst + i) & (SEK_BLOCK_COUNT - 1));
+		b->page = NULL;
+		b->count = 0;									// also stops a replay of it that's in progress
+	}
+}
+
+// The block for the opcode at pc, or NULL for handlers, the last word of a page and
+// pages that are also mapped for writing (ram), where the code changes too often.
+// Writes to the other pages are caught when the block is replayed (see m68ki_block_run)
+m68k_block* M68KBlockFind(UINT32 pc)
+{
+	UINT32 a = pc & nSekAddressMaskActive;
+	m68k_block* pBlock;
+	UINT8* pr;
+
+	if (pSekExt->BlockCache == NULL || (a & 1) || (a & SEK_PAGEM) > SEK_PAGEM - 3) {
+		return NULL;
+	}
+
+	pr = FIND_F(a);
+	if ((uintptr_t)pr < SEK_MAXHANDLER || pr == FIND_W(a)) {
+		return NULL;
+	}
+
+	pBlock = pSekExt->BlockCache + ((a >> 1) & (SEK_BLOCK_COUNT - 1));
+
+	if (pBlock->pc != pc || pBlock->page != pr) {		// new pc, or SekMapMemory() put something else here
+		pBlock->pc = pc;
+		pBlock->start = pc - (a & SEK_PAGEM);
+		pBlock->end = pBlock->start + SEK_PAGE_SIZE;
+		pBlock->page = pr;
+		pBlock->count = 0;
+	}
+
+	return pBlock;
+}
+#endif
+
+void SekBlockCacheFlush()
+{
+#if defined FBNEO_DEBUG
+	if (!DebugCPU_SekInitted) bprintf(PRINT_ERROR, _T("SekBlockCacheFlush called without init\n"));
+	if (nSekActive == -1) bprintf(PRINT_ERROR, _T("SekBlockCacheFlush called when no CPU open\n"));
+#endif
+
+#ifdef EMU_M68K
+	SekBlockCacheInvalidate(0, ~0U);
+#endif
+}
+
 // ----------------------------------------------------------------------------
 // Memory accesses (non-emu specific)
 
@@ -811,9 +902,15 @@ void SekWriteByte(UINT32 a, UINT8 d) { WriteByte(a, d); }
 void SekWriteWord(UINT32 a, UINT16 d) { WriteWord(a, d); }
 void SekWriteLong(UINT32 a, UINT32 d) { WriteLong(a, d); }
 
-void SekWriteByteROM(UINT32 a, UINT8 d) { WriteByteROM(a, d); }
-void SekWriteWordROM(UINT32 a, UINT16 d) { WriteWordROM(a, d); }
-void SekWriteLongROM(UINT32 a, UINT32 d) { WriteLongROM(a, d); }
+#ifdef EMU_M68K
+ #define SEK_BLOCK_WRITTEN(a, n) SekBlockCacheInvalidate((a) & nSekAddressMaskActive, ((a) & nSekAddressMaskActive) + (n) - 1)
+#else
+ #define SEK_BLOCK_WRITTEN(a, n)
+#endif
+
+void SekWriteByteROM(UINT32 a, UINT8 d) { WriteByteROM(a, d); SEK_BLOCK_WRITTEN(a, 1); }
+void SekWriteWordROM(UINT32 a, UINT16 d) { WriteWordROM(a, d); SEK_BLOCK_WRITTEN(a, 2); }
+void SekWriteLongROM(UINT32 a, UINT32 d) { WriteLongROM(a, d); SEK_BLOCK_WRITTEN(a, 4); }
 
 // ----------------------------------------------------------------------------
 // Callbacks for A68K
@@ -1203,6 +1300,10 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
 
 #ifdef EMU_M68K
 		m68k_init();
+		if (bSekBlockCache) {
+			ps->BlockCache = (m68k_block*)calloc(SEK_BLOCK_COUNT, sizeof(m68k_block));	// without it the cpu just runs uncached
+		}
+		m68k_set_block_cache(ps->BlockCache);			// goes into the context SekInitCPUM68K() takes
 		if (SekInitCPUM68K(nCount, nCPUType)) {
 			SekExit();
 			return 1;
@@ -1283,6 +1384,9 @@ void SekExit()
 #endif
 		// Deallocate other context data
 		if (SekExt[i]) {
+#ifdef EMU_M68K
+			free(SekExt[i]->BlockCache);
+#endif
 			free(SekExt[i]);
 			SekExt[i] = NULL;
 		}
@@ -1316,6 +1420,7 @@ void SekReset()
 #endif
 
 #ifdef EMU_M68K
+		SekBlockCacheFlush();						// drivers often patch their rom on reset
 		m68k_pulse_reset();
 		for (INT32 i = 0; i < 8; i++) {
 			nSekVIRQPending[nSekActive][i] = 0;
@@ -2023,6 +2128,13 @@ INT32 SekMapMemory(UINT8* pMemory, UINT32 nStart, UINT32 nEnd, INT32 nType)
 	UINT8* Ptr = pMemory - nStart;
 	UINT8** pMemMap = pSekExt->MemMap + (nStart >> SEK_SHIFT);
 
+#ifdef EMU_M68K
+	// Blocks recorded from whatever was mapped here before
+	if (nType & MAP_FETCH) {
+		SekBlockCacheInvalidate(nStart, nEnd);
+	}
+#endif
+
 	// Special case for ROM banks
 	if (nType == MAP_ROM) {
 		for (UINT32 i = (nStart & ~SEK_PAGEM); i <= nEnd; i += SEK_PAGE_SIZE, pMemMap++) {
@@ -2075,6 +2187,83 @@ INT32 SekMapHandler(uintptr_t nHandler, UINT32 nStart, UINT32 nEnd, INT32 nType)
 	return 0;
 }
 
+// ----------------------------------------------------------------------------
+// Dirty page tracking
+
+// Turn tracking on or off for the active CPU, the map starts out clean
+void SekDirtyEnable(INT32 bEnable)
+{
+#if defined FBNEO_DEBUG
+	if (!DebugCPU_SekInitted) bprintf(PRINT_ERROR, _T("SekDirtyEnable called without init\n"));
+	if (nSekActive == -1) bprintf(PRINT_ERROR, _T("SekDirtyEnable called when no CPU open\n"));
+#endif
+
+	pSekExt->DirtyTrack = bEnable ? 1 : 0;
+	memset(pSekExt->DirtyMap, 0, sizeof(pSekExt->DirtyMap));
+}
+
+void SekDirtyClear()
+{
+#if defined FBNEO_DEBUG
+	if (!DebugCPU_SekInitted) bprintf(PRINT_ERROR, _T("SekDirtyClear called without init\n"));
+	if (nSekActive == -1) bprintf(PRINT_ERROR, _T("SekDirtyClear called when no CPU open\n"));
+#endif
+
+	memset(pSekExt->DirtyMap, 0, sizeof(pSekExt->DirtyMap));
+}
+
+// Returns 1 if any page in nStart - nEnd was written since the last clear
+INT32 SekDirtyRange(UINT32 nStart, UINT32 nEnd)
+{
+#if defined FBNEO_DEBUG
+	if (!DebugCPU_SekInitted) bprintf(PRINT_ERROR, _T("SekDirtyRange called without init\n"));
+	if (nSekActive == -1) bprintf(PRINT_ERROR, _T("SekDirtyRange called when no CPU open\n"));
+#endif
+
+	UINT32 nPage = (nStart >> SEK_SHIFT) & SEK_MASK;
+	UINT32 nLast = (nEnd >> SEK_SHIFT) & SEK_MASK;
+
+	for (; nPage <= nLast; nPage++) {
+		UINT32 nWord = pSekExt->DirtyMap[nPage >> 5];
+
+		if (nWord == 0) {					// skip clean runs 32 pages at a time
+			nPage |= 31;
+			continue;
+		}
+		if (nWord & (1U << (nPage & 31))) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+// Fill pnAddress with the start address of each dirty page, returns the number of dirty pages
+INT32 SekDirtyGetPages(UINT32* pnAddress, INT32 nMaxPages)
+{
+#if defined FBNEO_DEBUG
+	if (!DebugCPU_SekInitted) bprintf(PRINT_ERROR, _T("SekDirtyGetPages called without init\n"));
+	if (nSekActive == -1) bprintf(PRINT_ERROR, _T("SekDirtyGetPages called when no CPU open\n"));
+#endif
+
+	INT32 nCount = 0;
+
+	for (INT32 i = 0; i < SEK_PAGE_COUNT / 32; i++) {
+		UINT32 nWord = pSekExt->DirtyMap[i];
+
+		for (INT32 j = 0; nWord; j++, nWord >>= 1) {
+			if (nWord & 1) {
+				if (nCount < nMaxPages && pnAddress) {
+					pnAddress[nCount] = ((i << 5) + j) << SEK_SHIFT;
+				}
+				nCount++;
+			}
+		}
+	}
+
+	return nCount;
+}
+
 // Set callbacks
 INT32 SekSetResetCallback(pSekResetCallback pCallback)
 {
@@ -2598,6 +2787,11 @@ INT32 SekScan(INT32 nAction)
 				ba.nLen = m68k_context_size_no_pointers();
 				ba.szName = szName;
 				BurnAcb(&ba);
+
+				// the memory the blocks were recorded from was just overwritten
+				if ((nAction & ACB_WRITE) && SekExt[i]->BlockCache) {
+					memset(SekExt[i]->BlockCache, 0, SEK_BLOCK_COUNT * sizeof(m68k_block));
+				}
 			}
 #endif
 
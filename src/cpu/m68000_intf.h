@@ -105,6 +105,16 @@ struct SekExt {
 	pSekIrqCallback IrqCallback;
 	pSekCmpCallback CmpCallback;
 	pSekTASCallback TASCallback;
+
+	// Pages written through the direct memory map since the last SekDirtyClear()
+	// One bit per SEK_PAGE_SIZE page, only kept while DirtyTrack is set
+	UINT32 DirtyMap[SEK_PAGE_COUNT / 32];
+	INT32 DirtyTrack;
+
+#ifdef EMU_M68K
+	// Recorded runs of opcodes from ROM pages, NULL unless bSekBlockCache was set at init
+	m68k_block* BlockCache;
+#endif
 };
 
 #define SEK_DEF_READ_WORD(i, a) { UINT16 d; d = (UINT16)(pSekExt->ReadByte[i](a) << 8); d |= (UINT16)(pSekExt->ReadByte[i]((a) + 1)); return d; }
@@ -257,6 +267,16 @@ void SekSetAddressMask(UINT32 nAddressMask);
 INT32 SekMapMemory(UINT8* pMemory, UINT32 nStart, UINT32 nEnd, INT32 nType);
 INT32 SekMapHandler(uintptr_t nHandler, UINT32 nStart, UINT32 nEnd, INT32 nType);
 
+// Dirty page tracking for the active CPU (writes through handlers are not tracked)
+void SekDirtyEnable(INT32 bEnable);
+void SekDirtyClear();
+INT32 SekDirtyRange(UINT32 nStart, UINT32 nEnd);
+INT32 SekDirtyGetPages(UINT32* pnAddress, INT32 nMaxPages);
+
+// Block cache for the Musashi core, set bSekBlockCache before SekInit() to use it
+extern INT32 bSekBlockCache;
+void SekBlockCacheFlush();					// call after changing ROM other than through SekWrite*ROM()
+
 // Set handlers
 INT32 SekSetReadByteHandler(INT32 i, pSekReadByteHandler pHandler);
 INT32 SekSetWriteByteHandler(INT32 i, pSekWriteByteHandler pHandler);
@@ -380,6 +380,49 @@ unsigned int m68k_disassemble(char* str_buff, unsigned int pc, unsigned int cpu_
 unsigned int m68k_disassemble_raw(char* str_buff, unsigned int pc, const unsigned char* opdata, const unsigned char* argdata, unsigned int cpu_type);
 
 
+/* ======================================================================== */
+/* ============================== BLOCK CACHE ============================= */
+/* ======================================================================== */
+
+/* A run of opcodes recorded the first time it executes from a fetch page,
+ * then replayed by m68k_execute() without fetching and dispatching each
+ * opcode again.  Replay leaves the block as soon as the pc isn't the next
+ * recorded one (taken branch, exception, interrupt), and cuts the block
+ * short at the first opcode whose words in the page have changed since it
+ * was recorded, whoever wrote them.
+ * Blocks come from M68K_BLOCK_CALLBACK (see m68kconf.h).  The host owns pc,
+ * start, end and page, the core fills in count and op[].
+ */
+#define M68K_BLOCK_OPS 16
+
+typedef struct
+{
+	void (*handler)(void);      /* opcode handler, the ea mode is part of it */
+	unsigned int pc;            /* address of the opcode */
+	unsigned short ir;          /* the opcode */
+	unsigned short pref;        /* the word after it, for the prefetch queue */
+	unsigned int cycles;        /* base cycles for the opcode */
+	const unsigned short* mem;  /* the opcode in the page */
+	unsigned short raw[2];      /* mem[0] and mem[1] when it was recorded */
+} m68k_block_op;
+
+typedef struct
+{
+	unsigned int pc;            /* address of the first opcode */
+	unsigned int start;         /* start of the fetch page */
+	unsigned int end;           /* end of the fetch page, nothing is recorded past it */
+	void* page;                 /* host memory of the page when it was recorded */
+	unsigned int count;         /* recorded opcodes, 0 until it has run once */
+	m68k_block_op op[M68K_BLOCK_OPS];
+} m68k_block;
+
+/* Tell the current context whether the host has blocks for it.  While this
+ * is NULL (the default) m68k_execute() doesn't call M68K_BLOCK_CALLBACK at
+ * all, so cpus without a block cache pay nothing for it.
+ */
+void m68k_set_block_cache(m68k_block* cache);
+
+
 /* ======================================================================== */
 /* ============================= CONFIGURATION ============================ */
 /* ======================================================================== */
@@ -167,6 +167,19 @@
 #define M68K_EMULATE_PREFETCH       OPT_ON
 
 
+/* If ON, runs of opcodes are recorded into the m68k_block the callback
+ * returns for the pc, and replayed without fetching each opcode again.
+ * The callback returns NULL where the code can't be cached.
+ * Off in debug builds so every fetch still reaches the breakpoint handlers.
+ */
+#ifdef FBNEO_DEBUG
+ #define M68K_BLOCK_CACHE            OPT_OFF
+#else
+ #define M68K_BLOCK_CACHE            OPT_SPECIFY_HANDLER
+#endif
+#define M68K_BLOCK_CALLBACK(A)      M68KBlockFind(A)
+
+
 /* If ON, the CPU will generate address error exceptions if it tries to
  * access a word or longword at an odd address.
  * NOTE: This is only emulated properly for 68000 mode.
@@ -226,6 +239,7 @@ int M68KTASCallback(void);
 unsigned int __fastcall M68KFetchByte(unsigned int a);
 unsigned int __fastcall M68KFetchWord(unsigned int a);
 unsigned int __fastcall M68KFetchLong(unsigned int a);
+m68k_block* M68KBlockFind(unsigned int pc);
 
 extern unsigned int (*SekDbgFetchByteDisassembler)(unsigned int);
 extern unsigned int (*SekDbgFetchWordDisassembler)(unsigned int);
@@ -694,6 +694,11 @@ void m68k_set_instr_hook_callback(void  (*callback)(unsigned int pc))
 	CALLBACK_INSTR_HOOK = callback ? callback : default_instr_hook_callback;
 }
 
+void m68k_set_block_cache(m68k_block* cache)
+{
+	m68ki_cpu.block_cache = cache;
+}
+
 #include <stdio.h>
 /* Set the CPU type. */
 void m68k_set_cpu_type(unsigned int cpu_type)
@@ -804,6 +809,118 @@ int m68k_check_shouldinterrupt(void)
 	return (CPU_INT_LEVEL > FLAG_INT_MASK);
 }
 
+#if M68K_BLOCK_CACHE
+/* Replay a recorded block, the same steps as the loop in m68k_execute()
+ * with the opcode, prefetch word and cycles taken from the block.
+ * count is read again after each opcode, the host clears it if the opcode
+ * remapped or patched the block's page.  Anything else writing the page
+ * (ram handlers, mirrors, other cpus, dma) is caught by comparing the words
+ * in the page before each opcode: the block is cut short there, and
+ * recorded again once it is empty.
+ */
+static void m68ki_block_run(m68k_block* block)
+{
+	const m68k_block_op* op = block->op;
+
+	do
+	{
+#if M68K_EMULATE_PREFETCH
+		if (op->mem[0] != op->raw[0] || op->mem[1] != op->raw[1])
+#else
+		if (op->mem[0] != op->raw[0])
+#endif
+		{
+			block->count = (uint)(op - block->op);
+			break;
+		}
+
+		m68ki_trace_t1(); /* auto-disable (see m68kcpu.h) */
+		m68ki_use_data_space(); /* auto-disable (see m68kcpu.h) */
+		m68ki_instr_hook(REG_PC); /* auto-disable (see m68kcpu.h) */
+
+		REG_PPC = REG_PC;
+		#if defined (BUILD_WIN32)
+			if (pc_changed_cb) {
+				pc_changed_cb(REG_PC);
+			}
+		#endif
+		REG_IR = op->ir;
+		REG_PC += 2;
+#if M68K_EMULATE_PREFETCH
+		CPU_PREF_ADDR = REG_PC;
+		CPU_PREF_DATA = op->pref;
+#endif
+		op->handler();
+		USE_CYCLES(op->cycles);
+
+		m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
+		op++;
+	} while(op < block->op + block->count && REG_PC == op->pc && GET_CYCLES() > 0 && !m68ki_cpu.end_run);
+}
+
+/* Run normally from the start of an empty block, recording each opcode until
+ * the pc leaves the block's page or the block is full.
+ * An opcode that came from a prefetch queue loaded before its page was written
+ * still runs as the old opcode, but ends the block there.
+ */
+static void m68ki_block_record(m68k_block* block)
+{
+	m68k_block_op* op = block->op;
+	uint count = 0;
+	uint stale = 0;
+
+	do
+	{
+		m68ki_trace_t1(); /* auto-disable (see m68kcpu.h) */
+		m68ki_use_data_space(); /* auto-disable (see m68kcpu.h) */
+		m68ki_instr_hook(REG_PC); /* auto-disable (see m68kcpu.h) */
+
+		REG_PPC = REG_PC;
+		#if defined (BUILD_WIN32)
+			if (pc_changed_cb) {
+				pc_changed_cb(REG_PC);
+			}
+		#endif
+		REG_IR = m68ki_read_imm_16();
+
+#if M68K_EMULATE_PREFETCH
+		stale = (REG_IR != MASK_OUT_ABOVE_16(m68k_read_immediate_16(ADDRESS_68K(REG_PPC))));
+#endif
+		if (!stale)
+		{
+			op->handler = m68ki_instruction_jump_table[REG_IR];
+			op->pc = REG_PPC;
+			op->ir = REG_IR;
+#if M68K_EMULATE_PREFETCH
+			op->pref = CPU_PREF_DATA;
+#else
+			op->pref = 0;
+#endif
+			op->cycles = CYC_INSTRUCTION[REG_IR];
+			op->mem = (const unsigned short*)((const unsigned char*)block->page + (REG_PPC - block->start));
+			op->raw[0] = op->mem[0];
+			op->raw[1] = op->mem[1];
+			op++;
+			count++;
+		}
+
+		m68ki_instruction_jump_table[REG_IR]();
+		USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+
+		m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
+
+		/* the opcode and the word after it must both be in the page, and the
+		 * host must not have dropped the block while the opcode ran
+		 */
+	} while(!stale && count < M68K_BLOCK_OPS && block->page && !(REG_PC & 1) &&
+			REG_PC - block->pc <= block->end - block->pc - 4 &&
+			GET_CYCLES() > 0 && !m68ki_cpu.end_run);
+
+	if (block->page)
+		block->count = count;
+}
+#endif /* M68K_BLOCK_CACHE */
+
 /* Execute some instructions until we use up num_cycles clock cycles */
 /* ASG: removed per-instruction interrupt checks */
 int m68k_execute(int num_cycles)
@@ -829,6 +946,22 @@ int m68k_execute(int num_cycles)
 		/* Main loop.  Keep going until we run out of clock cycles */
 		do
 		{
+#if M68K_BLOCK_CACHE
+			/* Replay (or record) the block for this pc if the host has one */
+			if (m68ki_cpu.block_cache)
+			{
+				m68k_block* block = m68ki_block_find(REG_PC);
+				if (block)
+				{
+					if (block->count)
+						m68ki_block_run(block);
+					else
+						m68ki_block_record(block);
+					continue;
+				}
+			}
+#endif
+
 			/* Set tracing accodring to T1. (T0 is done inside instruction) */
 			m68ki_trace_t1(); /* auto-disable (see m68kcpu.h) */
 
@@ -1021,6 +1154,7 @@ void m68k_init(void)
 	m68k_set_pc_changed_callback(NULL);
 	m68k_set_fc_callback(NULL);
 	m68k_set_instr_hook_callback(NULL);
+	m68k_set_block_cache(NULL);
 
 	megadrive_sr_checkint_mode = 0;
 }
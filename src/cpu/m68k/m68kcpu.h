@@ -501,6 +501,12 @@
 	#define m68ki_instr_hook(pc)
 #endif /* M68K_INSTRUCTION_HOOK */
 
+#if M68K_BLOCK_CACHE
+	#define m68ki_block_find(pc) M68K_BLOCK_CALLBACK(pc)
+#else
+	#define m68ki_block_find(pc) NULL
+#endif /* M68K_BLOCK_CACHE */
+
 #if M68K_MONITOR_PC
 	#if M68K_MONITOR_PC == OPT_SPECIFY_HANDLER
 		#define m68ki_pc_changed(A) M68K_SET_PC_CALLBACK(ADDRESS_68K(A))
@@ -920,6 +926,8 @@ struct _m68ki_cpu_core
 	void (*set_fc_callback)(unsigned int new_fc);     /* Called when the CPU function code changes */
 	void (*instr_hook_callback)(unsigned int pc);     /* Called every instruction cycle prior to execution */
 
+	m68k_block* block_cache;                          /* Host's blocks for this cpu, NULL = don't look for any */
+
 };
 
 
@@ -114,6 +114,11 @@ static Z80WriteProgHandler Z80ProgramWrite;
 static Z80ReadOpHandler Z80CPUReadOp;
 static Z80ReadOpArgHandler Z80CPUReadOpArg;
 
+// Host page tables, 256 byte pages. A NULL page goes through the handlers above
+static UINT8 *Z80NullMap[0x200];
+static UINT8 **Z80CPUOpMap = Z80NullMap;		// 0x100 opcode pages, then 0x100 argument pages
+static UINT8 **Z80ProgramMap = Z80NullMap;	// pages RM() may read without Z80ProgramRead()
+
 #define Z80Vector Z80.vector
 
 #define VERBOSE 0
@@ -921,7 +926,8 @@ Z80_INLINE void OUT(UINT16 port, UINT8 value)
 //#define RM(addr) (UINT8)Z80ProgramRead(addr)
 Z80_INLINE UINT8 RM(UINT16 addr)
 {
-	UINT8 res = Z80ProgramRead(addr);
+	UINT8 *p = Z80ProgramMap[addr >> 8];
+	UINT8 res = p ? p[addr & 0xff] : Z80ProgramRead(addr);
 	store_rwinfo(addr, res, RWINFO_READ|RWINFO_MEMORY, "rm");
 	return res;
 }
@@ -945,8 +951,21 @@ Z80_INLINE void WM(UINT16 addr, UINT8 value)
 	Z80ProgramWrite(addr,value);
 }
 
-#define cpu_readop(n) Z80CPUReadOp(n)
-#define cpu_readop_arg(n) Z80CPUReadOpArg(n)
+/***************************************************************
+ * Fetch an opcode / argument byte, straight from the page when
+ * the host mapped one
+ ***************************************************************/
+Z80_INLINE UINT8 cpu_readop(UINT16 addr)
+{
+	UINT8 *p = Z80CPUOpMap[0x000 | (addr >> 8)];
+	return p ? p[addr & 0xff] : Z80CPUReadOp(addr);
+}
+
+Z80_INLINE UINT8 cpu_readop_arg(UINT16 addr)
+{
+	UINT8 *p = Z80CPUOpMap[0x100 | (addr >> 8)];
+	return p ? p[addr & 0xff] : Z80CPUReadOpArg(addr);
+}
 
 /***************************************************************
  * Write a word to given memory location
@@ -4206,6 +4225,16 @@ void Z80SetCPUOpArgReadHandler(Z80ReadOpArgHandler handler)
 	Z80CPUReadOpArg = handler;
 }
 
+void Z80SetCPUOpMap(UINT8 **map)
+{
+	Z80CPUOpMap = map ? map : Z80NullMap;
+}
+
+void Z80SetProgramMap(UINT8 **map)
+{
+	Z80ProgramMap = map ? map : Z80NullMap;
+}
+
 void ActiveZ80EXAF()
 {
 	EX_AF;
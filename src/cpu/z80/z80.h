@@ -102,6 +102,10 @@ extern void Z80SetProgramReadHandler(unsigned char (*pread)(unsigned short));
 extern void Z80SetProgramWriteHandler(void (*pwrite)(unsigned short, unsigned char));
 extern void Z80SetCPUOpReadHandler(unsigned char (*pread)(unsigned short));
 extern void Z80SetCPUOpArgReadHandler(unsigned char (*pread)(unsigned short));
+// Optional host page tables (256 byte pages, NULL = use the handlers above)
+// op map: 0x100 opcode pages followed by 0x100 argument pages
+extern void Z80SetCPUOpMap(unsigned char **map);
+extern void Z80SetProgramMap(unsigned char **map);
 
 extern int nZ80ICount, nZ80Cycles;
 extern unsigned char **Z80CPUContext;
@@ -15,6 +15,7 @@ struct ZetExt {
 	Z80_Regs reg;
 	
 	UINT8* pZetMemMap[0x100 * 4];
+	UINT8* pZetPureMap[0x100];		// read pages mapped with ZET_MAP_PURE, the core reads these inline
 
 	pZetInHandler ZetIn;
 	pZetOutHandler ZetOut;
@@ -260,6 +261,9 @@ INT32 ZetInit(INT32 nCPU)
 		for (INT32 j = 0; j < (0x0100 * 4); j++) {
 			ZetCPUContext[nCPU]->pZetMemMap[j] = NULL;
 		}
+		for (INT32 j = 0; j < 0x0100; j++) {
+			ZetCPUContext[nCPU]->pZetPureMap[j] = NULL;
+		}
 	}
 
 	nZetCyclesTotal = 0;
@@ -324,6 +328,9 @@ void ZetClose()
 	Z80GetContext(&ZetCPUContext[nOpenedCPU]->reg);
 	nZetCyclesDone[nOpenedCPU] = nZetCyclesTotal;
 
+	Z80SetCPUOpMap(NULL);
+	Z80SetProgramMap(NULL);
+
 	nOpenedCPU = -1;
 }
 
@@ -339,6 +346,10 @@ void ZetOpen(INT32 nCPU)
 	Z80SetContext(&ZetCPUContext[nCPU]->reg);
 	nZetCyclesTotal = nZetCyclesDone[nCPU];
 
+	// mapped op / arg pages are fetched by the core directly, ZetReadOp() only sees the holes
+	Z80SetCPUOpMap(ZetCPUContext[nCPU]->pZetMemMap + 0x200);
+	Z80SetProgramMap(ZetCPUContext[nCPU]->pZetPureMap);
+
 	nOpenedCPU = nCPU;
 }
 
@@ -492,6 +503,7 @@ INT32 ZetMemCallback(INT32 nStart, INT32 nEnd, INT32 nMode)
 		switch (nMode) {
 			case 0:
 				pMemMap[0     + i] = NULL;
+				ZetCPUContext[nOpenedCPU]->pZetPureMap[i] = NULL;
 				break;
 			case 1:
 				pMemMap[0x100 + i] = NULL;
@@ -544,9 +556,11 @@ INT32 ZetUnmapMemory(INT32 nStart, INT32 nEnd, INT32 nFlags)
 
 	UINT8 cStart = (nStart >> 8);
 	UINT8 **pMemMap = ZetCPUContext[nOpenedCPU]->pZetMemMap;
+	UINT8 **pPureMap = ZetCPUContext[nOpenedCPU]->pZetPureMap;
+
 
 	for (UINT16 i = cStart; i <= (nEnd >> 8); i++) {
-		if (nFlags & (1 << 0)) pMemMap[0     + i] = NULL; // READ
+		if (nFlags & (1 << 0)) pMemMap[0     + i] = pPureMap[i] = NULL; // READ
 		if (nFlags & (1 << 1)) pMemMap[0x100 + i] = NULL; // WRITE
 		if (nFlags & (1 << 2)) pMemMap[0x200 + i] = NULL; // OP
 		if (nFlags & (1 << 3)) pMemMap[0x300 + i] = NULL; // ARG
@@ -564,9 +578,12 @@ void ZetMapMemory(UINT8 *Mem, INT32 nStart, INT32 nEnd, INT32 nFlags)
 
 	UINT8 cStart = (nStart >> 8);
 	UINT8 **pMemMap = ZetCPUContext[nOpenedCPU]->pZetMemMap;
+	UINT8 **pPureMap = ZetCPUContext[nOpenedCPU]->pZetPureMap;
+
 
 	for (UINT16 i = cStart; i <= (nEnd >> 8); i++) {
 		if (nFlags & (1 << 0)) pMemMap[0     + i] = Mem + ((i - cStart) << 8); // READ
+		if (nFlags & (1 << 0)) pPureMap[i] = (nFlags & ZET_MAP_PURE) ? pMemMap[i] : NULL;
 		if (nFlags & (1 << 1)) pMemMap[0x100 + i] = Mem + ((i - cStart) << 8); // WRITE
 		if (nFlags & (1 << 2)) pMemMap[0x200 + i] = Mem + ((i - cStart) << 8); // OP
 		if (nFlags & (1 << 3)) pMemMap[0x300 + i] = Mem + ((i - cStart) << 8); // ARG
@@ -587,6 +604,7 @@ INT32 ZetMapArea(INT32 nStart, INT32 nEnd, INT32 nMode, UINT8 *Mem)
 		switch (nMode) {
 			case 0: {
 				pMemMap[0     + i] = Mem + ((i - cStart) << 8);
+				ZetCPUContext[nOpenedCPU]->pZetPureMap[i] = NULL;
 				break;
 			}
 		
@@ -103,6 +103,9 @@ INT32 ZetMapArea(INT32 nStart, INT32 nEnd, INT32 nMode, UINT8* Mem);
 INT32 ZetMapArea(INT32 nStart, INT32 nEnd, INT32 nMode, UINT8* Mem01, UINT8* Mem02);
 #endif
 void ZetMapMemory(UINT8* Mem, INT32 nStart, INT32 nEnd, INT32 nMode);
+// OR into the ZetMapMemory() flags (with the read bit) to promise the page is plain rom / ram
+// whose reads have no side effects, the core then reads it inline instead of calling ZetReadProg()
+#define ZET_MAP_PURE		(1 << 4)
 INT32 ZetMemCallback(INT32 nStart, INT32 nEnd, INT32 nMode);
 INT32 ZetUnmapArea(INT32 nStart, INT32 nEnd, INT32 nMode);
 
@@ -1,10 +1,193 @@
 #include <iostream>
 #include <string>
+#include <fstream>
+#include <filesystem>
+#include <random>
+#include <algorithm>
+#include <vector>
 #include "burner/metal/ai/metal_ai_module.h"
+#include "ai/ai_prioritized_replay.h"
+#include "ai/ai_dataset_logger.h"
+
+static int nFailures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond << std::endl; \
+            nFailures++; \
+        } \
+    } while (0)
+
+static AI::AIInputFrame makeFrame(int frameNumber) {
+    AI::AIInputFrame frame;
+    frame.setFrameNumber(frameNumber);
+    return frame;
+}
+
+// Ring wrap, trajectory links and sum-tree sampling of AIPrioritizedReplay
+static void testPrioritizedReplay() {
+    AI::AIOutputAction action;
+    std::mt19937 rng(1234);
+    AI::AIReplayBatch batch;
+
+    // Overwrite the oldest transitions, next states must follow the stored trajectory
+    AI::AIPrioritizedReplay wrap(4, 1.0f, 1.0f);
+    for (int i = 0; i < 10; i++) {
+        wrap.add(makeFrame(i), action, 0.0f, makeFrame(i + 1), false);
+    }
+    CHECK(wrap.size() == 4);
+    for (size_t n = 0; n < wrap.size(); n++) {
+        CHECK(wrap.state(wrap.slot(n)).getFrameNumber() == (int)(6 + n));
+        CHECK(wrap.nextState(wrap.slot(n)).getFrameNumber() == (int)(7 + n));
+    }
+
+    // An episode end keeps its own next state
+    wrap.add(makeFrame(10), action, 0.0f, makeFrame(11), true);
+    wrap.add(makeFrame(100), action, 0.0f, makeFrame(101), false);
+    CHECK(wrap.nextState(wrap.slot(2)).getFrameNumber() == 11);
+    CHECK(wrap.nextState(wrap.slot(3)).getFrameNumber() == 101);
+
+    // alpha 1: draws are proportional to priority
+    AI::AIPrioritizedReplay replay(7, 1.0f, 1.0f);
+    for (int i = 0; i < 7; i++) {
+        replay.add(makeFrame(i * 10), action, 0.0f, makeFrame(i * 10 + 1), true);
+        replay.updatePriority(i, 1.0f);
+    }
+    replay.updatePriority(2, 0.0f);
+    replay.updatePriority(5, 94.0f);
+
+    std::vector<int> counts(7, 0);
+    for (int round = 0; round < 50; round++) {
+        replay.sample(100, rng, batch);
+        CHECK(batch.size() == 100);
+        for (size_t i = 0; i < batch.size(); i++) {
+            CHECK(batch.indices[i] < replay.size());
+            CHECK(batch.weights[i] > 0.0f && batch.weights[i] <= 1.0f);
+            counts[batch.indices[i]]++;
+        }
+    }
+    CHECK(counts[2] == 0);
+    CHECK(counts[5] > 4500 && counts[5] < 4900);   // 94 / 99.something of 5000 draws
+
+    // Lowering a priority has to update the sums on the way up
+    replay.updatePriority(5, 1.0f);
+    counts.assign(7, 0);
+    replay.sample(6000, rng, batch);
+    for (size_t i = 0; i < batch.size(); i++) {
+        counts[batch.indices[i]]++;
+    }
+    for (int i = 0; i < 7; i++) {
+        CHECK(i == 2 ? counts[i] == 0 : (counts[i] > 900 && counts[i] < 1100));
+    }
+}
+
+// Read the frame numbers back from the logger's .jsonl files, in file order
+static std::vector<long long> readLoggedFrames(const std::filesystem::path& dir) {
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+        files.push_back(entry.path());
+    }
+    std::sort(files.begin(), files.end());
+
+    std::vector<long long> frames;
+    for (const auto& file : files) {
+        std::ifstream in(file);
+        std::string line;
+        while (std::getline(in, line)) {
+            size_t pos = line.find("\"frame\":");
+            frames.push_back(pos == std::string::npos ? -1 : std::stoll(line.substr(pos + 8)));
+        }
+    }
+    return frames;
+}
+
+// SPSC ring between logFrame() and the writer: wrap-around and both backpressure modes
+static void testDatasetLoggerRing(AIDatasetBackpressure policy) {
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / "fbneo_ai_test_ring";
+    std::filesystem::remove_all(dir);
+
+    const int nFrames = 20000;
+    int nQueued = 0;
+    uint64_t nDropped = 0;
+    {
+        AIDatasetLogger logger(dir.string(), "ring", 1ull << 30, false, 4);
+        logger.setBackpressure(policy);
+        logger.setEnabled(true);
+
+        fbneo::ai::GameObservation obs = {};
+        fbneo::ai::InputAction action;
+        for (int i = 0; i < nFrames; i++) {
+            action.button1 = (i & 1) != 0;
+            nQueued += logger.logFrame(obs, action, i) ? 1 : 0;
+            CHECK(logger.getQueueDepth() <= 4);
+        }
+        logger.flush();
+        CHECK(logger.getQueueDepth() == 0);
+        nDropped = logger.getDroppedFrames();
+    }
+
+    std::vector<long long> frames = readLoggedFrames(dir);
+    CHECK((int)frames.size() == nQueued);
+    CHECK(frames.size() + nDropped == (size_t)nFrames);
+    if (policy == AI_DATASET_BLOCK_WHEN_FULL) {
+        CHECK(nDropped == 0);
+    }
+    for (size_t i = 1; i < frames.size(); i++) {
+        CHECK(frames[i] > frames[i - 1]);
+    }
+
+    std::filesystem::remove_all(dir);
+}
+
+// Files started by setEnabled() on this thread while the writer rotates them on its own
+static void testDatasetLoggerRotation() {
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / "fbneo_ai_test_rotate";
+    std::filesystem::remove_all(dir);
+
+    int nQueued = 0;
+    {
+        AIDatasetLogger logger(dir.string(), "rotate", 2000, false, 16);
+        logger.setBackpressure(AI_DATASET_BLOCK_WHEN_FULL);
+
+        fbneo::ai::GameObservation obs = {};
+        fbneo::ai::InputAction action;
+        for (int round = 0; round < 100; round++) {
+            logger.setEnabled(true);
+            for (int i = 0; i < 50; i++) {
+                nQueued += logger.logFrame(obs, action, round * 50 + i) ? 1 : 0;
+            }
+            logger.setEnabled(false);
+        }
+        logger.flush();
+    }
+
+    std::vector<long long> frames = readLoggedFrames(dir);
+    CHECK(nQueued == 5000);
+    CHECK((int)frames.size() == nQueued);
+    std::sort(frames.begin(), frames.end());
+    for (size_t i = 0; i < frames.size(); i++) {
+        CHECK(frames[i] == (long long)i);
+        if (frames[i] != (long long)i) {
+            break;
+        }
+    }
+
+    std::filesystem::remove_all(dir);
+}
 
 int main(int argc, char** argv) {
     std::cout << "FBNeo Metal AI Module Test" << std::endl;
     
+    testPrioritizedReplay();
+    testDatasetLoggerRing(AI_DATASET_BLOCK_WHEN_FULL);
+    testDatasetLoggerRing(AI_DATASET_DROP_WHEN_FULL);
+    testDatasetLoggerRotation();
+    std::cout << "Replay / logger ring checks: " << (nFailures ? "FAILED" : "passed") << std::endl;
+    if (nFailures) {
+        return 1;
+    }
+    
     // Initialize AI module
     if (!fbneo::metal::ai::initialize()) {
         std::cerr << "Failed to initialize AI module" << std::endl;
@@ -0,0 +1,281 @@
+// Two rollback peers over the UDP transport on 127.0.0.1
+//
+//   c++ -std=c++17 -Isrc/burner tests/rollback_test.cpp -o rollback_test && ./rollback_test
+//
+// Each peer is its own process (the session keeps its state in globals) running a
+// stand-in driver whose state mixes in both players' inputs and nCurrentFrame.  The
+// peers press different buttons at random and run at jittered speeds, so predictions
+// go wrong and frames get re-simulated.  At the end both must have the same state
+// for every frame that had all its inputs, and neither may have seen a desync.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdarg>
+#include <strings.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "burner.h"
+
+typedef short INT16;
+typedef unsigned short UINT16;
+
+#define _T(x) x
+#define PRINT_ERROR 3
+#define _strnicmp strncasecmp
+
+#define BIT_DIGITAL				0x01
+#define BIT_GROUP_ANALOG		0x04
+#define BIT_ANALOG_REL			0x04
+#define BIT_GROUP_CONSTANT		0x08
+#define BIT_DIPSWITCH			0x09
+
+struct BurnInputInfo {
+	char* szName;
+	UINT8 nType;
+	union {
+		UINT8* pVal;
+		UINT16* pShortVal;
+	};
+	char* szInfo;
+};
+
+static INT32 bprintf(INT32, const char* szFormat, ...)
+{
+	va_list vaList;
+	va_start(vaList, szFormat);
+	vfprintf(stderr, szFormat, vaList);
+	va_end(vaList);
+	return 0;
+}
+
+UINT8* pBurnDraw = NULL;
+INT16* pBurnSoundOut = NULL;
+UINT32 nCurrentFrame = 0;
+INT32 bBurnRunAheadFrame = 0;
+
+// ---------------------------------------------------------------------------
+// Stand-in driver: two buttons per player, a paddle for player 1, a service switch
+
+#define TEST_FRAMES		600
+#define TEST_DRAIN		64			// frames of no input at the end, so every prediction comes true
+#define TEST_HISTORY	(TEST_FRAMES + TEST_DRAIN + 2)
+
+static UINT8 DrvJoy[5];
+static UINT16 DrvPaddle;
+static UINT8 DrvDip;
+static UINT32 nDrvState;
+static UINT32 DrvHistory[TEST_HISTORY];		// state after each nCurrentFrame
+
+static struct BurnInputInfo DrvInputList[] = {
+	{ (char*)"P1 Button 1",	BIT_DIGITAL,	{ DrvJoy + 0 },				NULL },
+	{ (char*)"P1 Button 2",	BIT_DIGITAL,	{ DrvJoy + 1 },				NULL },
+	{ (char*)"P1 Paddle",	BIT_ANALOG_REL,	{ (UINT8*)&DrvPaddle },		NULL },
+	{ (char*)"P2 Button 1",	BIT_DIGITAL,	{ DrvJoy + 2 },				NULL },
+	{ (char*)"P2 Button 2",	BIT_DIGITAL,	{ DrvJoy + 3 },				NULL },
+	{ (char*)"Service",		BIT_DIGITAL,	{ DrvJoy + 4 },				NULL },
+	{ (char*)"Dip A",		BIT_DIPSWITCH,	{ &DrvDip },				NULL },
+};
+
+UINT32 nGameInpCount = sizeof(DrvInputList) / sizeof(DrvInputList[0]);
+
+static INT32 BurnDrvGetInputInfo(struct BurnInputInfo* pii, UINT32 i)
+{
+	if (i >= nGameInpCount) return 1;
+	*pii = DrvInputList[i];
+	return 0;
+}
+
+static INT32 BurnDrvFrame()
+{
+	nDrvState = nDrvState * 1664525 + 1013904223;
+	nDrvState ^= DrvJoy[0] | (DrvJoy[1] << 1) | (DrvJoy[2] << 2) | (DrvJoy[3] << 3) | (DrvJoy[4] << 4);
+	nDrvState += (DrvPaddle << 8) ^ (nCurrentFrame << 24);
+
+	if (nCurrentFrame < TEST_HISTORY) DrvHistory[nCurrentFrame] = nDrvState;
+
+	return 0;
+}
+
+extern "C" INT32 BurnStateDeltaInit(INT32) { return 0; }
+extern "C" INT32 BurnStateDeltaRebase() { return 0; }
+extern "C" INT32 BurnStateDeltaGetMaxLen() { return sizeof(nDrvState); }
+extern "C" void BurnStateDeltaExit() {}
+
+extern "C" INT32 BurnStateDeltaSave(UINT8* pDef, INT32 nDefMaxLen, INT32* pnDefLen)
+{
+	if (nDefMaxLen < (INT32)sizeof(nDrvState)) return 1;
+	memcpy(pDef, &nDrvState, sizeof(nDrvState));
+	*pnDefLen = sizeof(nDrvState);
+	return 0;
+}
+
+extern "C" INT32 BurnStateDeltaLoad(UINT8* Def, INT32 nDefLen)
+{
+	if (nDefLen != (INT32)sizeof(nDrvState)) return 1;
+	memcpy(&nDrvState, Def, sizeof(nDrvState));
+	return 0;
+}
+
+extern "C" UINT32 BurnStateDeltaChecksum(UINT8* Def, INT32 nDefLen)
+{
+	UINT32 nSum = 2166136261u;
+	for (INT32 i = 0; i < nDefLen; i++) nSum = (nSum ^ Def[i]) * 16777619u;
+	return nSum;
+}
+
+#include "rollback.mm"
+
+// ---------------------------------------------------------------------------
+
+struct PeerResult {
+	INT32 nFramesRun;
+	INT32 bDesynced;
+	RollbackStats Stats;
+	UINT32 History[TEST_HISTORY];
+};
+
+static void RunPeer(INT32 nPlayer, INT32 nLocalPort, INT32 nRemotePort, INT32 nPipe)
+{
+	alarm(60);
+	srand(1234 + nPlayer * 77);
+
+	RollbackTransport* pt = RollbackUdpOpen(nLocalPort, "127.0.0.1", nRemotePort);
+	if (pt == NULL || RollbackInit(nPlayer, 2, 8, pt)) _exit(2);
+
+	nDrvState = 0x5eed;
+	nCurrentFrame = 0;
+
+	UINT8 Held[2] = { 0, 0 };
+	UINT16 nPaddle = 0;
+	INT32 nFrames = 0;
+
+	// the loop mirrors RunFrame() in sdl/run.mm
+	while (nFrames < TEST_FRAMES + TEST_DRAIN) {
+		if (nFrames < TEST_FRAMES && (rand() % 6) == 0) {
+			Held[0] = rand() & 1;
+			Held[1] = rand() & 1;
+			nPaddle = rand() & 0x3ff;
+		}
+		if (nFrames == TEST_FRAMES) {
+			Held[0] = Held[1] = 0;
+			nPaddle = 0;
+		}
+
+		nCurrentFrame++;
+
+		memset(DrvJoy, 0, sizeof(DrvJoy));
+		DrvJoy[nPlayer * 2 + 0] = Held[0];
+		DrvJoy[nPlayer * 2 + 1] = Held[1];
+		DrvPaddle = (nPlayer == 0) ? nPaddle : 0;
+
+		if (RollbackFrame()) {
+			nCurrentFrame--;
+			usleep(200);
+			continue;
+		}
+
+		BurnDrvFrame();
+		nFrames++;
+
+		usleep((rand() % 30) ? rand() % 500 : 8000);	// now and then one side falls behind
+	}
+
+	PeerResult Result;
+	memset(&Result, 0, sizeof(Result));
+	Result.nFramesRun = nFrames;
+	Result.bDesynced = RollbackDesynced();
+	RollbackGetStats(&Result.Stats);
+	memcpy(Result.History, DrvHistory, sizeof(DrvHistory));
+
+	RollbackExit();
+	RollbackUdpClose();
+
+	if (write(nPipe, &Result, sizeof(Result)) != sizeof(Result)) _exit(3);
+	_exit(0);
+}
+
+static INT32 ReadResult(INT32 nPipe, PeerResult* pr)
+{
+	UINT8* p = (UINT8*)pr;
+	INT32 nLeft = sizeof(PeerResult);
+
+	while (nLeft > 0) {
+		INT32 n = read(nPipe, p, nLeft);
+		if (n <= 0) return 1;
+		p += n;
+		nLeft -= n;
+	}
+
+	return 0;
+}
+
+int main()
+{
+	INT32 nPort = 20000 + (getpid() % 20000);
+	INT32 nPipe[2][2];
+	pid_t nPid[2];
+
+	for (INT32 i = 0; i < 2; i++) {
+		if (pipe(nPipe[i])) return 1;
+
+		nPid[i] = fork();
+		if (nPid[i] == 0) {
+			close(nPipe[i][0]);
+			RunPeer(i, nPort + i, nPort + (i ^ 1), nPipe[i][1]);
+		}
+		close(nPipe[i][1]);
+	}
+
+	PeerResult* Result = (PeerResult*)calloc(2, sizeof(PeerResult));
+	INT32 nFailures = 0;
+
+	for (INT32 i = 0; i < 2; i++) {
+		INT32 nStatus = 0;
+		if (ReadResult(nPipe[i][0], &Result[i])) {
+			fprintf(stderr, "peer %d: no result\n", i + 1);
+			nFailures++;
+		}
+		waitpid(nPid[i], &nStatus, 0);
+		if (!WIFEXITED(nStatus) || WEXITSTATUS(nStatus) != 0) {
+			fprintf(stderr, "peer %d: exited abnormally (%x)\n", i + 1, nStatus);
+			nFailures++;
+		}
+	}
+
+	if (nFailures == 0) {
+		for (INT32 i = 0; i < 2; i++) {
+			printf("peer %d: %d rollbacks, %d frames re-simulated, %d predicted, %d stalls, %d checksums matched\n", i + 1,
+				Result[i].Stats.nRollbacks, Result[i].Stats.nFramesResimulated, Result[i].Stats.nPredicted, Result[i].Stats.nStalls, Result[i].Stats.nChecksMatched);
+
+			if (Result[i].bDesynced) {
+				fprintf(stderr, "peer %d: desynced\n", i + 1);
+				nFailures++;
+			}
+			if (Result[i].Stats.nChecksMatched == 0) {
+				fprintf(stderr, "peer %d: no checksums compared\n", i + 1);
+				nFailures++;
+			}
+		}
+
+		if (Result[0].Stats.nRollbacks + Result[1].Stats.nRollbacks == 0) {
+			fprintf(stderr, "no rollbacks happened, the test proves nothing\n");
+			nFailures++;
+		}
+
+		// the last few frames may still rest on predictions
+		for (INT32 f = 1; f <= TEST_FRAMES + TEST_DRAIN / 2; f++) {
+			if (Result[0].History[f] != Result[1].History[f]) {
+				fprintf(stderr, "frame %d: %08x vs %08x\n", f, Result[0].History[f], Result[1].History[f]);
+				nFailures++;
+				break;
+			}
+		}
+	}
+
+	free(Result);
+
+	printf("Rollback loopback test: %s\n", nFailures ? "FAILED" : "passed");
+
+	return nFailures ? 1 : 0;
+}
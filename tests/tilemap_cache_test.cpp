@@ -0,0 +1,122 @@
+// Draws the same tilemap with and without GenericTilemapUseCache() and compares
+// the pixels and the priority map, for plain scrolling, scroll per tile row and
+// line scroll, with offsets and with the screen flipped.  The uncached tile paths
+// only wrap the map once, so the offsets stay on the side that keeps them gap free.
+//
+// Link with src/burn/tilemap_generic.cpp and src/burn/tiles_generic.cpp.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "tiles_generic.h"
+
+#define MAP_COLS		64
+#define MAP_ROWS		32
+#define TILE_SIZE		8
+#define SCREEN_W		320
+#define SCREEN_H		224
+
+static UINT8 TestGfx[256 * TILE_SIZE * TILE_SIZE];
+static UINT16 Bitmap[2][SCREEN_W * SCREEN_H];
+static UINT8 Prio[2][SCREEN_W * SCREEN_H];
+
+static tilemap_callback( test )
+{
+	UINT32 h = offs * 2654435761u;
+
+	TILE_SET_INFO(0, (h >> 8) & 0xff, (h >> 16) & 0x0f, TILE_FLIPYX(h >> 28));
+}
+
+struct TestCase {
+	const char* szName;
+	INT32 nRows;			// scroll rows, 1 = none
+	INT32 nFlip;
+	INT32 nOffsetX, nOffsetY;
+};
+
+static const TestCase Cases[] = {
+	{ "plain",				1,							0,				0,	0 },
+	{ "plain, offsets",		1,							0,				-3,	-5 },
+	{ "tile rows",			MAP_ROWS / 4,				0,				-2,	-7 },
+	{ "tile rows",			MAP_ROWS,					0,				0,	0 },
+	{ "tile rows",			MAP_ROWS / 2,				TMAP_FLIPXY,	-1,	-6 },
+	{ "line scroll",		MAP_ROWS * TILE_SIZE,		0,				0,	0 },
+	{ "line scroll",		MAP_ROWS * TILE_SIZE,		0,				-5,	11 },
+	{ "line scroll",		MAP_ROWS * TILE_SIZE / 2,	0,				-7,	3 },
+	{ "line scroll",		MAP_ROWS * TILE_SIZE,		TMAP_FLIPX,		-4,	2 },
+	{ "line scroll",		MAP_ROWS * TILE_SIZE,		TMAP_FLIPY,		-4,	2 },
+	{ "line scroll",		MAP_ROWS * TILE_SIZE,		TMAP_FLIPXY,	-3,	9 },
+};
+
+static void TestSetup(INT32 nMap, const TestCase* pCase, INT32 nScrollX, INT32 nScrollY)
+{
+	GenericTilemapInit(nMap, TILEMAP_SCAN_ROWS, test_map_callback, TILE_SIZE, TILE_SIZE, MAP_COLS, MAP_ROWS);
+	GenericTilemapSetGfx(0, TestGfx, 4, TILE_SIZE, TILE_SIZE, sizeof(TestGfx), 0x100, 0x0f);
+	GenericTilemapSetTransparent(nMap, 0);
+	GenericTilemapSetOffsets(nMap, pCase->nOffsetX, pCase->nOffsetY);
+	GenericTilemapSetFlip(nMap, pCase->nFlip);
+	GenericTilemapSetScrollX(nMap, nScrollX);
+	GenericTilemapSetScrollY(nMap, nScrollY);
+
+	if (pCase->nRows > 1) {
+		GenericTilemapSetScrollRows(nMap, pCase->nRows);
+
+		srand(pCase->nRows);
+		for (INT32 i = 0; i < pCase->nRows; i++) {
+			GenericTilemapSetScrollRow(nMap, i, rand() % (MAP_COLS * TILE_SIZE));
+		}
+	}
+
+	if (nMap == 1) {
+		GenericTilemapUseCache(nMap);
+	}
+}
+
+int main()
+{
+	INT32 nFailures = 0;
+
+	srand(1);
+	for (UINT32 i = 0; i < sizeof(TestGfx); i++) {
+		TestGfx[i] = (rand() % 3) ? (rand() & 0x0f) : 0;
+	}
+
+	nScreenWidth = SCREEN_W;
+	nScreenHeight = SCREEN_H;
+	GenericTilesSetClipRaw(0, SCREEN_W, 0, SCREEN_H);
+
+	for (UINT32 c = 0; c < sizeof(Cases) / sizeof(Cases[0]); c++) {
+		const TestCase* pCase = &Cases[c];
+
+		for (INT32 nScroll = 0; nScroll < 4; nScroll++) {
+			INT32 nScrollX = nScroll * 37;
+			INT32 nScrollY = nScroll * 23;
+
+			for (INT32 nMap = 0; nMap < 2; nMap++) {
+				TestSetup(nMap, pCase, nScrollX, nScrollY);
+
+				memset(Bitmap[nMap], 0, sizeof(Bitmap[nMap]));
+				memset(Prio[nMap], 0, sizeof(Prio[nMap]));
+				pPrioDraw = Prio[nMap];
+
+				GenericTilemapDraw(nMap, Bitmap[nMap], 1);
+			}
+
+			for (INT32 i = 0; i < SCREEN_W * SCREEN_H; i++) {
+				if (Bitmap[0][i] != Bitmap[1][i] || Prio[0][i] != Prio[1][i]) {
+					printf("%s (%d rows, flip %d, offsets %d, %d, scroll %d, %d): pixel %d, %d is %04x uncached, %04x cached\n",
+						pCase->szName, pCase->nRows, pCase->nFlip, pCase->nOffsetX, pCase->nOffsetY, nScrollX, nScrollY,
+						i % SCREEN_W, i / SCREEN_W, Bitmap[0][i], Bitmap[1][i]);
+					nFailures++;
+					break;
+				}
+			}
+
+			GenericTilemapExit();
+		}
+	}
+
+	printf("Tilemap cache test: %s\n", nFailures ? "FAILED" : "passed");
+
+	return nFailures ? 1 : 0;
+}